@@ -0,0 +1,4643 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: params.proto
+
+#include "params.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Proto {
+PROTOBUF_CONSTEXPR Parameters_SmallRadar::Parameters_SmallRadar(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.radius_)*/0
+  , /*decltype(_impl_.view_angle_)*/0
+  , /*decltype(_impl_.frequency_)*/0
+  , /*decltype(_impl_.max_eps_)*/0
+  , /*decltype(_impl_.max_angle_speed_)*/0
+  , /*decltype(_impl_.rad_stddev_)*/0
+  , /*decltype(_impl_.ang_stddev_)*/0
+  , /*decltype(_impl_.h_stddev_)*/0
+  , /*decltype(_impl_.responsible_sector_start_)*/0
+  , /*decltype(_impl_.responsible_sector_end_)*/0} {}
+struct Parameters_SmallRadarDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Parameters_SmallRadarDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Parameters_SmallRadarDefaultTypeInternal() {}
+  union {
+    Parameters_SmallRadar _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Parameters_SmallRadarDefaultTypeInternal _Parameters_SmallRadar_default_instance_;
+PROTOBUF_CONSTEXPR Parameters_BigRadar::Parameters_BigRadar(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.radius_)*/0
+  , /*decltype(_impl_.frequency_)*/0
+  , /*decltype(_impl_.rad_stddev_)*/0
+  , /*decltype(_impl_.ang_stddev_)*/0
+  , /*decltype(_impl_.h_stddev_)*/0} {}
+struct Parameters_BigRadarDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Parameters_BigRadarDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Parameters_BigRadarDefaultTypeInternal() {}
+  union {
+    Parameters_BigRadar _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Parameters_BigRadarDefaultTypeInternal _Parameters_BigRadar_default_instance_;
+PROTOBUF_CONSTEXPR Parameters_Ship_DeadZone::Parameters_Ship_DeadZone(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.start_)*/0
+  , /*decltype(_impl_.end_)*/0} {}
+struct Parameters_Ship_DeadZoneDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Parameters_Ship_DeadZoneDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Parameters_Ship_DeadZoneDefaultTypeInternal() {}
+  union {
+    Parameters_Ship_DeadZone _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Parameters_Ship_DeadZoneDefaultTypeInternal _Parameters_Ship_DeadZone_default_instance_;
+PROTOBUF_CONSTEXPR Parameters_Ship::Parameters_Ship(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.dead_zones_)*/{}
+  , /*decltype(_impl_.max_eps_)*/0
+  , /*decltype(_impl_.max_angle_speed_)*/0} {}
+struct Parameters_ShipDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Parameters_ShipDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Parameters_ShipDefaultTypeInternal() {}
+  union {
+    Parameters_Ship _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Parameters_ShipDefaultTypeInternal _Parameters_Ship_default_instance_;
+PROTOBUF_CONSTEXPR Parameters_General::Parameters_General(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.process_budget_share_)*/0
+  , /*decltype(_impl_.geometry_pos_tolerance_)*/0
+  , /*decltype(_impl_.target_selection_)*/0
+  , /*decltype(_impl_.track_filter_)*/0
+  , /*decltype(_impl_.geometry_speed_tolerance_)*/0
+  , /*decltype(_impl_.scheduler_pin_threads_)*/false
+  , /*decltype(_impl_.scheduler_threads_)*/1
+  , /*decltype(_impl_.death_time_)*/5000
+  , /*decltype(_impl_.play_speed_)*/1
+  , /*decltype(_impl_.big_radar_measure_cnt_)*/30
+  , /*decltype(_impl_.small_radar_measure_cnt_)*/40
+  , /*decltype(_impl_.aprox_small_radar_measure_cnt_)*/10
+  , /*decltype(_impl_.margin_angle_)*/5
+  , /*decltype(_impl_.margin_time_)*/3000
+  , /*decltype(_impl_.kinematics_step_)*/5
+  , /*decltype(_impl_.rotation_cache_step_)*/0.1
+  , /*decltype(_impl_.kalman_measurement_stddev_)*/0.3
+  , /*decltype(_impl_.kalman_acceleration_stddev_)*/0.01
+  , /*decltype(_impl_.kalman_precise_speed_stddev_)*/0.05
+  , /*decltype(_impl_.planner_horizon_)*/10000
+  , /*decltype(_impl_.tick_arena_size_)*/262144
+  , /*decltype(_impl_.planner_beam_width_)*/8
+  , /*decltype(_impl_.association_gate_)*/10
+  , /*decltype(_impl_.planner_max_depth_)*/3
+  , /*decltype(_impl_.geometry_parallel_threshold_)*/64} {}
+struct Parameters_GeneralDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Parameters_GeneralDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Parameters_GeneralDefaultTypeInternal() {}
+  union {
+    Parameters_General _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Parameters_GeneralDefaultTypeInternal _Parameters_General_default_instance_;
+PROTOBUF_CONSTEXPR Parameters_Defense::Parameters_Defense(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.launchers_count_)*/0u
+  , /*decltype(_impl_.magazine_size_)*/0u
+  , /*decltype(_impl_.planned_launches_per_launcher_)*/3u
+  , /*decltype(_impl_.time_to_launch_rocket_)*/3000
+  , /*decltype(_impl_.rocket_speed_)*/5
+  , /*decltype(_impl_.reload_time_)*/5000
+  , /*decltype(_impl_.kill_radius_)*/10} {}
+struct Parameters_DefenseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Parameters_DefenseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Parameters_DefenseDefaultTypeInternal() {}
+  union {
+    Parameters_Defense _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Parameters_DefenseDefaultTypeInternal _Parameters_Defense_default_instance_;
+PROTOBUF_CONSTEXPR Parameters_Simulator::Parameters_Simulator(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.max_height_)*/0
+  , /*decltype(_impl_.random_seed_)*/0u
+  , /*decltype(_impl_.strip_ids_)*/false
+  , /*decltype(_impl_.targets_per_minute_)*/3u
+  , /*decltype(_impl_.min_target_speed_)*/1
+  , /*decltype(_impl_.max_target_speed_)*/2
+  , /*decltype(_impl_.max_deviation_angle_vertical_)*/15
+  , /*decltype(_impl_.probability_of_accurate_missile_)*/0.4} {}
+struct Parameters_SimulatorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Parameters_SimulatorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Parameters_SimulatorDefaultTypeInternal() {}
+  union {
+    Parameters_Simulator _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Parameters_SimulatorDefaultTypeInternal _Parameters_Simulator_default_instance_;
+PROTOBUF_CONSTEXPR Parameters_Visualizer::Parameters_Visualizer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.draw_entry_points_)*/false
+  , /*decltype(_impl_.fps_)*/60u
+  , /*decltype(_impl_.radars_outline_thickness_)*/1u
+  , /*decltype(_impl_.target_radius_)*/5u} {}
+struct Parameters_VisualizerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Parameters_VisualizerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Parameters_VisualizerDefaultTypeInternal() {}
+  union {
+    Parameters_Visualizer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Parameters_VisualizerDefaultTypeInternal _Parameters_Visualizer_default_instance_;
+PROTOBUF_CONSTEXPR Parameters::Parameters(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.extra_small_radars_)*/{}
+  , /*decltype(_impl_.small_radar_)*/nullptr
+  , /*decltype(_impl_.big_radar_)*/nullptr
+  , /*decltype(_impl_.ship_)*/nullptr
+  , /*decltype(_impl_.general_)*/nullptr
+  , /*decltype(_impl_.defense_)*/nullptr
+  , /*decltype(_impl_.simulator_)*/nullptr
+  , /*decltype(_impl_.visualizer_)*/nullptr} {}
+struct ParametersDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParametersDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParametersDefaultTypeInternal() {}
+  union {
+    Parameters _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParametersDefaultTypeInternal _Parameters_default_instance_;
+}  // namespace Proto
+static ::_pb::Metadata file_level_metadata_params_2eproto[9];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_params_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_params_2eproto = nullptr;
+
+const uint32_t TableStruct_params_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.radius_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.view_angle_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.frequency_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.max_eps_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.max_angle_speed_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.rad_stddev_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.ang_stddev_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.h_stddev_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.responsible_sector_start_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_SmallRadar, _impl_.responsible_sector_end_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_BigRadar, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_BigRadar, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_BigRadar, _impl_.radius_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_BigRadar, _impl_.frequency_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_BigRadar, _impl_.rad_stddev_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_BigRadar, _impl_.ang_stddev_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_BigRadar, _impl_.h_stddev_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship_DeadZone, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship_DeadZone, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship_DeadZone, _impl_.start_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship_DeadZone, _impl_.end_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship, _impl_.max_eps_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship, _impl_.max_angle_speed_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Ship, _impl_.dead_zones_),
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.death_time_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.play_speed_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.big_radar_measure_cnt_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.small_radar_measure_cnt_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.aprox_small_radar_measure_cnt_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.margin_angle_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.margin_time_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.kinematics_step_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.process_budget_share_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.target_selection_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.rotation_cache_step_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.geometry_pos_tolerance_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.geometry_speed_tolerance_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.track_filter_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.kalman_measurement_stddev_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.kalman_acceleration_stddev_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.kalman_precise_speed_stddev_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.tick_arena_size_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.planner_horizon_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.planner_beam_width_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.planner_max_depth_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.association_gate_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.geometry_parallel_threshold_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.scheduler_threads_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_General, _impl_.scheduler_pin_threads_),
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  0,
+  2,
+  15,
+  1,
+  4,
+  3,
+  16,
+  17,
+  18,
+  20,
+  19,
+  21,
+  23,
+  22,
+  24,
+  6,
+  5,
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _impl_.time_to_launch_rocket_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _impl_.rocket_speed_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _impl_.launchers_count_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _impl_.reload_time_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _impl_.magazine_size_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _impl_.planned_launches_per_launcher_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Defense, _impl_.kill_radius_),
+  3,
+  4,
+  0,
+  5,
+  1,
+  2,
+  6,
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_.targets_per_minute_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_.min_target_speed_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_.max_target_speed_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_.max_height_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_.max_deviation_angle_vertical_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_.probability_of_accurate_missile_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_.random_seed_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Simulator, _impl_.strip_ids_),
+  3,
+  4,
+  5,
+  0,
+  6,
+  7,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Visualizer, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Visualizer, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Visualizer, _impl_.radars_outline_thickness_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Visualizer, _impl_.target_radius_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Visualizer, _impl_.draw_entry_points_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters_Visualizer, _impl_.fps_),
+  2,
+  3,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_.small_radar_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_.big_radar_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_.ship_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_.general_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_.defense_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_.simulator_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_.visualizer_),
+  PROTOBUF_FIELD_OFFSET(::Proto::Parameters, _impl_.extra_small_radars_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 16, -1, sizeof(::Proto::Parameters_SmallRadar)},
+  { 26, 37, -1, sizeof(::Proto::Parameters_BigRadar)},
+  { 42, 50, -1, sizeof(::Proto::Parameters_Ship_DeadZone)},
+  { 52, 61, -1, sizeof(::Proto::Parameters_Ship)},
+  { 64, 95, -1, sizeof(::Proto::Parameters_General)},
+  { 120, 133, -1, sizeof(::Proto::Parameters_Defense)},
+  { 140, 154, -1, sizeof(::Proto::Parameters_Simulator)},
+  { 162, 172, -1, sizeof(::Proto::Parameters_Visualizer)},
+  { 176, 190, -1, sizeof(::Proto::Parameters)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Proto::_Parameters_SmallRadar_default_instance_._instance,
+  &::Proto::_Parameters_BigRadar_default_instance_._instance,
+  &::Proto::_Parameters_Ship_DeadZone_default_instance_._instance,
+  &::Proto::_Parameters_Ship_default_instance_._instance,
+  &::Proto::_Parameters_General_default_instance_._instance,
+  &::Proto::_Parameters_Defense_default_instance_._instance,
+  &::Proto::_Parameters_Simulator_default_instance_._instance,
+  &::Proto::_Parameters_Visualizer_default_instance_._instance,
+  &::Proto::_Parameters_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_params_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\014params.proto\022\005Proto\"\215\024\n\nParameters\0221\n\013"
+  "small_radar\030\001 \002(\0132\034.Proto.Parameters.Sma"
+  "llRadar\022-\n\tbig_radar\030\002 \002(\0132\032.Proto.Param"
+  "eters.BigRadar\022$\n\004ship\030\003 \002(\0132\026.Proto.Par"
+  "ameters.Ship\022*\n\007general\030\004 \002(\0132\031.Proto.Pa"
+  "rameters.General\022*\n\007defense\030\005 \002(\0132\031.Prot"
+  "o.Parameters.Defense\022.\n\tsimulator\030\006 \002(\0132"
+  "\033.Proto.Parameters.Simulator\0220\n\nvisualiz"
+  "er\030\007 \002(\0132\034.Proto.Parameters.Visualizer\0228"
+  "\n\022extra_small_radars\030\010 \003(\0132\034.Proto.Param"
+  "eters.SmallRadar\032\351\001\n\nSmallRadar\022\016\n\006radiu"
+  "s\030\001 \002(\001\022\022\n\nview_angle\030\002 \002(\001\022\021\n\tfrequency"
+  "\030\003 \002(\001\022\017\n\007max_eps\030\004 \002(\001\022\027\n\017max_angle_spe"
+  "ed\030\005 \002(\001\022\022\n\nrad_stddev\030\006 \002(\001\022\022\n\nang_stdd"
+  "ev\030\007 \002(\001\022\020\n\010h_stddev\030\010 \002(\001\022 \n\030responsibl"
+  "e_sector_start\030\t \002(\001\022\036\n\026responsible_sect"
+  "or_end\030\n \002(\001\032g\n\010BigRadar\022\016\n\006radius\030\001 \002(\001"
+  "\022\021\n\tfrequency\030\002 \002(\001\022\022\n\nrad_stddev\030\003 \002(\001\022"
+  "\022\n\nang_stddev\030\004 \002(\001\022\020\n\010h_stddev\030\005 \002(\001\032\215\001"
+  "\n\004Ship\022\017\n\007max_eps\030\001 \002(\001\022\027\n\017max_angle_spe"
+  "ed\030\002 \002(\001\0223\n\ndead_zones\030\003 \003(\0132\037.Proto.Par"
+  "ameters.Ship.DeadZone\032&\n\010DeadZone\022\r\n\005sta"
+  "rt\030\001 \002(\001\022\013\n\003end\030\002 \002(\001\032\300\010\n\007General\022\030\n\ndea"
+  "th_time\030\001 \001(\001:\0045000\022\025\n\nplay_speed\030\002 \001(\001:"
+  "\0011\022!\n\025big_radar_measure_cnt\030\003 \001(\001:\00230\022#\n"
+  "\027small_radar_measure_cnt\030\004 \001(\001:\00240\022)\n\035ap"
+  "rox_small_radar_measure_cnt\030\005 \001(\001:\00210\022\027\n"
+  "\014margin_angle\030\006 \001(\001:\0015\022\031\n\013margin_time\030\007 "
+  "\001(\001:\0043000\022\032\n\017kinematics_step\030\010 \001(\001:\0015\022\037\n"
+  "\024process_budget_share\030\t \001(\001:\0010\022K\n\020target"
+  "_selection\030\n \001(\0162).Proto.Parameters.Gene"
+  "ral.TargetSelection:\006GREEDY\022 \n\023rotation_"
+  "cache_step\030\013 \001(\001:\0030.1\022!\n\026geometry_pos_to"
+  "lerance\030\014 \001(\001:\0010\022#\n\030geometry_speed_toler"
+  "ance\030\r \001(\001:\0010\022F\n\014track_filter\030\016 \001(\0162%.Pr"
+  "oto.Parameters.General.TrackFilter:\tAB_F"
+  "ILTER\022&\n\031kalman_measurement_stddev\030\017 \001(\001"
+  ":\0030.3\022(\n\032kalman_acceleration_stddev\030\020 \001("
+  "\001:\0040.01\022)\n\033kalman_precise_speed_stddev\030\021"
+  " \001(\001:\0040.05\022\037\n\017tick_arena_size\030\022 \001(\005:\006262"
+  "144\022\036\n\017planner_horizon\030\023 \001(\001:\00510000\022\035\n\022p"
+  "lanner_beam_width\030\024 \001(\005:\0018\022\034\n\021planner_ma"
+  "x_depth\030\025 \001(\005:\0013\022\034\n\020association_gate\030\027 \001"
+  "(\001:\00210\022\'\n\033geometry_parallel_threshold\030\031 "
+  "\001(\005:\00264\022\034\n\021scheduler_threads\030\032 \001(\005:\0011\022$\n"
+  "\025scheduler_pin_threads\030\033 \001(\010:\005false\"e\n\017T"
+  "argetSelection\022\n\n\006GREEDY\020\000\022\033\n\027SWEEP_LINE"
+  "_MAX_PRIORITY\020\001\022\030\n\024SWEEP_LINE_MAX_COUNT\020"
+  "\002\022\017\n\013BEAM_SEARCH\020\003\"(\n\013TrackFilter\022\r\n\tAB_"
+  "FILTER\020\000\022\n\n\006KALMAN\020\001J\004\010\026\020\027J\004\010\030\020\031\032\330\001\n\007Def"
+  "ense\022#\n\025time_to_launch_rocket\030\001 \001(\001:\004300"
+  "0\022\027\n\014rocket_speed\030\002 \001(\001:\0015\022\027\n\017launchers_"
+  "count\030\003 \001(\r\022\031\n\013reload_time\030\004 \001(\001:\0045000\022\030"
+  "\n\rmagazine_size\030\005 \001(\r:\0010\022(\n\035planned_laun"
+  "ches_per_launcher\030\006 \001(\r:\0013\022\027\n\013kill_radiu"
+  "s\030\007 \001(\001:\00210\032\377\001\n\tSimulator\022\035\n\022targets_per"
+  "_minute\030\001 \001(\r:\0013\022\033\n\020min_target_speed\030\002 \001"
+  "(\001:\0011\022\033\n\020max_target_speed\030\003 \001(\001:\0012\022\022\n\nma"
+  "x_height\030\004 \002(\001\022(\n\034max_deviation_angle_ve"
+  "rtical\030\005 \001(\001:\00215\022,\n\037probability_of_accur"
+  "ate_missile\030\006 \001(\001:\0030.4\022\023\n\013random_seed\030\007 "
+  "\001(\r\022\030\n\tstrip_ids\030\010 \001(\010:\005false\032~\n\nVisuali"
+  "zer\022#\n\030radars_outline_thickness\030\001 \001(\r:\0011"
+  "\022\030\n\rtarget_radius\030\002 \001(\r:\0015\022 \n\021draw_entry"
+  "_points\030\003 \001(\010:\005false\022\017\n\003fps\030\004 \001(\r:\00260"
+  ;
+static ::_pbi::once_flag descriptor_table_params_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_params_2eproto = {
+    false, false, 2597, descriptor_table_protodef_params_2eproto,
+    "params.proto",
+    &descriptor_table_params_2eproto_once, nullptr, 0, 9,
+    schemas, file_default_instances, TableStruct_params_2eproto::offsets,
+    file_level_metadata_params_2eproto, file_level_enum_descriptors_params_2eproto,
+    file_level_service_descriptors_params_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_params_2eproto_getter() {
+  return &descriptor_table_params_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_params_2eproto(&descriptor_table_params_2eproto);
+namespace Proto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Parameters_General_TargetSelection_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_params_2eproto);
+  return file_level_enum_descriptors_params_2eproto[0];
+}
+bool Parameters_General_TargetSelection_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Parameters_General_TargetSelection Parameters_General::GREEDY;
+constexpr Parameters_General_TargetSelection Parameters_General::SWEEP_LINE_MAX_PRIORITY;
+constexpr Parameters_General_TargetSelection Parameters_General::SWEEP_LINE_MAX_COUNT;
+constexpr Parameters_General_TargetSelection Parameters_General::BEAM_SEARCH;
+constexpr Parameters_General_TargetSelection Parameters_General::TargetSelection_MIN;
+constexpr Parameters_General_TargetSelection Parameters_General::TargetSelection_MAX;
+constexpr int Parameters_General::TargetSelection_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Parameters_General_TrackFilter_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_params_2eproto);
+  return file_level_enum_descriptors_params_2eproto[1];
+}
+bool Parameters_General_TrackFilter_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Parameters_General_TrackFilter Parameters_General::AB_FILTER;
+constexpr Parameters_General_TrackFilter Parameters_General::KALMAN;
+constexpr Parameters_General_TrackFilter Parameters_General::TrackFilter_MIN;
+constexpr Parameters_General_TrackFilter Parameters_General::TrackFilter_MAX;
+constexpr int Parameters_General::TrackFilter_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class Parameters_SmallRadar::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters_SmallRadar>()._impl_._has_bits_);
+  static void set_has_radius(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_view_angle(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_frequency(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_max_eps(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_max_angle_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_rad_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_ang_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_h_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_responsible_sector_start(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_responsible_sector_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000003ff) ^ 0x000003ff) != 0;
+  }
+};
+
+Parameters_SmallRadar::Parameters_SmallRadar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters.SmallRadar)
+}
+Parameters_SmallRadar::Parameters_SmallRadar(const Parameters_SmallRadar& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters_SmallRadar* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.radius_){}
+    , decltype(_impl_.view_angle_){}
+    , decltype(_impl_.frequency_){}
+    , decltype(_impl_.max_eps_){}
+    , decltype(_impl_.max_angle_speed_){}
+    , decltype(_impl_.rad_stddev_){}
+    , decltype(_impl_.ang_stddev_){}
+    , decltype(_impl_.h_stddev_){}
+    , decltype(_impl_.responsible_sector_start_){}
+    , decltype(_impl_.responsible_sector_end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.radius_, &from._impl_.radius_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.responsible_sector_end_) -
+    reinterpret_cast<char*>(&_impl_.radius_)) + sizeof(_impl_.responsible_sector_end_));
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters.SmallRadar)
+}
+
+inline void Parameters_SmallRadar::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.radius_){0}
+    , decltype(_impl_.view_angle_){0}
+    , decltype(_impl_.frequency_){0}
+    , decltype(_impl_.max_eps_){0}
+    , decltype(_impl_.max_angle_speed_){0}
+    , decltype(_impl_.rad_stddev_){0}
+    , decltype(_impl_.ang_stddev_){0}
+    , decltype(_impl_.h_stddev_){0}
+    , decltype(_impl_.responsible_sector_start_){0}
+    , decltype(_impl_.responsible_sector_end_){0}
+  };
+}
+
+Parameters_SmallRadar::~Parameters_SmallRadar() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters.SmallRadar)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters_SmallRadar::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Parameters_SmallRadar::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters_SmallRadar::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters.SmallRadar)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.radius_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.h_stddev_) -
+        reinterpret_cast<char*>(&_impl_.radius_)) + sizeof(_impl_.h_stddev_));
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.responsible_sector_start_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.responsible_sector_end_) -
+        reinterpret_cast<char*>(&_impl_.responsible_sector_start_)) + sizeof(_impl_.responsible_sector_end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters_SmallRadar::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required double radius = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_radius(&has_bits);
+          _impl_.radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double view_angle = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_view_angle(&has_bits);
+          _impl_.view_angle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double frequency = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_frequency(&has_bits);
+          _impl_.frequency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double max_eps = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_max_eps(&has_bits);
+          _impl_.max_eps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double max_angle_speed = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_max_angle_speed(&has_bits);
+          _impl_.max_angle_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double rad_stddev = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_rad_stddev(&has_bits);
+          _impl_.rad_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double ang_stddev = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_ang_stddev(&has_bits);
+          _impl_.ang_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double h_stddev = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_h_stddev(&has_bits);
+          _impl_.h_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double responsible_sector_start = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_responsible_sector_start(&has_bits);
+          _impl_.responsible_sector_start_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double responsible_sector_end = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _Internal::set_has_responsible_sector_end(&has_bits);
+          _impl_.responsible_sector_end_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters_SmallRadar::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters.SmallRadar)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required double radius = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_radius(), target);
+  }
+
+  // required double view_angle = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_view_angle(), target);
+  }
+
+  // required double frequency = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_frequency(), target);
+  }
+
+  // required double max_eps = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_max_eps(), target);
+  }
+
+  // required double max_angle_speed = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_max_angle_speed(), target);
+  }
+
+  // required double rad_stddev = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_rad_stddev(), target);
+  }
+
+  // required double ang_stddev = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_ang_stddev(), target);
+  }
+
+  // required double h_stddev = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_h_stddev(), target);
+  }
+
+  // required double responsible_sector_start = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_responsible_sector_start(), target);
+  }
+
+  // required double responsible_sector_end = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_responsible_sector_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters.SmallRadar)
+  return target;
+}
+
+size_t Parameters_SmallRadar::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Proto.Parameters.SmallRadar)
+  size_t total_size = 0;
+
+  if (_internal_has_radius()) {
+    // required double radius = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_view_angle()) {
+    // required double view_angle = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_frequency()) {
+    // required double frequency = 3;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_max_eps()) {
+    // required double max_eps = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_max_angle_speed()) {
+    // required double max_angle_speed = 5;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_rad_stddev()) {
+    // required double rad_stddev = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_ang_stddev()) {
+    // required double ang_stddev = 7;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_h_stddev()) {
+    // required double h_stddev = 8;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_responsible_sector_start()) {
+    // required double responsible_sector_start = 9;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_responsible_sector_end()) {
+    // required double responsible_sector_end = 10;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t Parameters_SmallRadar::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters.SmallRadar)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x000003ff) ^ 0x000003ff) == 0) {  // All required fields are present.
+    // required double radius = 1;
+    total_size += 1 + 8;
+
+    // required double view_angle = 2;
+    total_size += 1 + 8;
+
+    // required double frequency = 3;
+    total_size += 1 + 8;
+
+    // required double max_eps = 4;
+    total_size += 1 + 8;
+
+    // required double max_angle_speed = 5;
+    total_size += 1 + 8;
+
+    // required double rad_stddev = 6;
+    total_size += 1 + 8;
+
+    // required double ang_stddev = 7;
+    total_size += 1 + 8;
+
+    // required double h_stddev = 8;
+    total_size += 1 + 8;
+
+    // required double responsible_sector_start = 9;
+    total_size += 1 + 8;
+
+    // required double responsible_sector_end = 10;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters_SmallRadar::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters_SmallRadar::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters_SmallRadar::GetClassData() const { return &_class_data_; }
+
+
+void Parameters_SmallRadar::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters_SmallRadar*>(&to_msg);
+  auto& from = static_cast<const Parameters_SmallRadar&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters.SmallRadar)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.radius_ = from._impl_.radius_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.view_angle_ = from._impl_.view_angle_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.frequency_ = from._impl_.frequency_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.max_eps_ = from._impl_.max_eps_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.max_angle_speed_ = from._impl_.max_angle_speed_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.rad_stddev_ = from._impl_.rad_stddev_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.ang_stddev_ = from._impl_.ang_stddev_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.h_stddev_ = from._impl_.h_stddev_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.responsible_sector_start_ = from._impl_.responsible_sector_start_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.responsible_sector_end_ = from._impl_.responsible_sector_end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters_SmallRadar::CopyFrom(const Parameters_SmallRadar& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters.SmallRadar)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters_SmallRadar::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Parameters_SmallRadar::InternalSwap(Parameters_SmallRadar* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Parameters_SmallRadar, _impl_.responsible_sector_end_)
+      + sizeof(Parameters_SmallRadar::_impl_.responsible_sector_end_)
+      - PROTOBUF_FIELD_OFFSET(Parameters_SmallRadar, _impl_.radius_)>(
+          reinterpret_cast<char*>(&_impl_.radius_),
+          reinterpret_cast<char*>(&other->_impl_.radius_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters_SmallRadar::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[0]);
+}
+
+// ===================================================================
+
+class Parameters_BigRadar::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters_BigRadar>()._impl_._has_bits_);
+  static void set_has_radius(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_frequency(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_rad_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ang_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_h_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+Parameters_BigRadar::Parameters_BigRadar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters.BigRadar)
+}
+Parameters_BigRadar::Parameters_BigRadar(const Parameters_BigRadar& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters_BigRadar* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.radius_){}
+    , decltype(_impl_.frequency_){}
+    , decltype(_impl_.rad_stddev_){}
+    , decltype(_impl_.ang_stddev_){}
+    , decltype(_impl_.h_stddev_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.radius_, &from._impl_.radius_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.h_stddev_) -
+    reinterpret_cast<char*>(&_impl_.radius_)) + sizeof(_impl_.h_stddev_));
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters.BigRadar)
+}
+
+inline void Parameters_BigRadar::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.radius_){0}
+    , decltype(_impl_.frequency_){0}
+    , decltype(_impl_.rad_stddev_){0}
+    , decltype(_impl_.ang_stddev_){0}
+    , decltype(_impl_.h_stddev_){0}
+  };
+}
+
+Parameters_BigRadar::~Parameters_BigRadar() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters.BigRadar)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters_BigRadar::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Parameters_BigRadar::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters_BigRadar::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters.BigRadar)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.radius_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.h_stddev_) -
+        reinterpret_cast<char*>(&_impl_.radius_)) + sizeof(_impl_.h_stddev_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters_BigRadar::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required double radius = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_radius(&has_bits);
+          _impl_.radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double frequency = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_frequency(&has_bits);
+          _impl_.frequency_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double rad_stddev = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_rad_stddev(&has_bits);
+          _impl_.rad_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double ang_stddev = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_ang_stddev(&has_bits);
+          _impl_.ang_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double h_stddev = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_h_stddev(&has_bits);
+          _impl_.h_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters_BigRadar::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters.BigRadar)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required double radius = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_radius(), target);
+  }
+
+  // required double frequency = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_frequency(), target);
+  }
+
+  // required double rad_stddev = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_rad_stddev(), target);
+  }
+
+  // required double ang_stddev = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_ang_stddev(), target);
+  }
+
+  // required double h_stddev = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_h_stddev(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters.BigRadar)
+  return target;
+}
+
+size_t Parameters_BigRadar::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Proto.Parameters.BigRadar)
+  size_t total_size = 0;
+
+  if (_internal_has_radius()) {
+    // required double radius = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_frequency()) {
+    // required double frequency = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_rad_stddev()) {
+    // required double rad_stddev = 3;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_ang_stddev()) {
+    // required double ang_stddev = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_h_stddev()) {
+    // required double h_stddev = 5;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t Parameters_BigRadar::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters.BigRadar)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required double radius = 1;
+    total_size += 1 + 8;
+
+    // required double frequency = 2;
+    total_size += 1 + 8;
+
+    // required double rad_stddev = 3;
+    total_size += 1 + 8;
+
+    // required double ang_stddev = 4;
+    total_size += 1 + 8;
+
+    // required double h_stddev = 5;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters_BigRadar::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters_BigRadar::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters_BigRadar::GetClassData() const { return &_class_data_; }
+
+
+void Parameters_BigRadar::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters_BigRadar*>(&to_msg);
+  auto& from = static_cast<const Parameters_BigRadar&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters.BigRadar)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.radius_ = from._impl_.radius_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.frequency_ = from._impl_.frequency_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.rad_stddev_ = from._impl_.rad_stddev_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.ang_stddev_ = from._impl_.ang_stddev_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.h_stddev_ = from._impl_.h_stddev_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters_BigRadar::CopyFrom(const Parameters_BigRadar& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters.BigRadar)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters_BigRadar::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Parameters_BigRadar::InternalSwap(Parameters_BigRadar* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Parameters_BigRadar, _impl_.h_stddev_)
+      + sizeof(Parameters_BigRadar::_impl_.h_stddev_)
+      - PROTOBUF_FIELD_OFFSET(Parameters_BigRadar, _impl_.radius_)>(
+          reinterpret_cast<char*>(&_impl_.radius_),
+          reinterpret_cast<char*>(&other->_impl_.radius_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters_BigRadar::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[1]);
+}
+
+// ===================================================================
+
+class Parameters_Ship_DeadZone::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters_Ship_DeadZone>()._impl_._has_bits_);
+  static void set_has_start(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Parameters_Ship_DeadZone::Parameters_Ship_DeadZone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters.Ship.DeadZone)
+}
+Parameters_Ship_DeadZone::Parameters_Ship_DeadZone(const Parameters_Ship_DeadZone& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters_Ship_DeadZone* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.start_, &from._impl_.start_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.start_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters.Ship.DeadZone)
+}
+
+inline void Parameters_Ship_DeadZone::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_){0}
+    , decltype(_impl_.end_){0}
+  };
+}
+
+Parameters_Ship_DeadZone::~Parameters_Ship_DeadZone() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters.Ship.DeadZone)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters_Ship_DeadZone::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Parameters_Ship_DeadZone::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters_Ship_DeadZone::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters.Ship.DeadZone)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.start_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.start_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters_Ship_DeadZone::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required double start = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_start(&has_bits);
+          _impl_.start_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double end = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters_Ship_DeadZone::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters.Ship.DeadZone)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required double start = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_start(), target);
+  }
+
+  // required double end = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_end(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters.Ship.DeadZone)
+  return target;
+}
+
+size_t Parameters_Ship_DeadZone::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Proto.Parameters.Ship.DeadZone)
+  size_t total_size = 0;
+
+  if (_internal_has_start()) {
+    // required double start = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_end()) {
+    // required double end = 2;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t Parameters_Ship_DeadZone::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters.Ship.DeadZone)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required double start = 1;
+    total_size += 1 + 8;
+
+    // required double end = 2;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters_Ship_DeadZone::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters_Ship_DeadZone::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters_Ship_DeadZone::GetClassData() const { return &_class_data_; }
+
+
+void Parameters_Ship_DeadZone::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters_Ship_DeadZone*>(&to_msg);
+  auto& from = static_cast<const Parameters_Ship_DeadZone&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters.Ship.DeadZone)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.start_ = from._impl_.start_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters_Ship_DeadZone::CopyFrom(const Parameters_Ship_DeadZone& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters.Ship.DeadZone)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters_Ship_DeadZone::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Parameters_Ship_DeadZone::InternalSwap(Parameters_Ship_DeadZone* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Parameters_Ship_DeadZone, _impl_.end_)
+      + sizeof(Parameters_Ship_DeadZone::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(Parameters_Ship_DeadZone, _impl_.start_)>(
+          reinterpret_cast<char*>(&_impl_.start_),
+          reinterpret_cast<char*>(&other->_impl_.start_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters_Ship_DeadZone::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[2]);
+}
+
+// ===================================================================
+
+class Parameters_Ship::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters_Ship>()._impl_._has_bits_);
+  static void set_has_max_eps(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_angle_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Parameters_Ship::Parameters_Ship(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters.Ship)
+}
+Parameters_Ship::Parameters_Ship(const Parameters_Ship& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters_Ship* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dead_zones_){from._impl_.dead_zones_}
+    , decltype(_impl_.max_eps_){}
+    , decltype(_impl_.max_angle_speed_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.max_eps_, &from._impl_.max_eps_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_angle_speed_) -
+    reinterpret_cast<char*>(&_impl_.max_eps_)) + sizeof(_impl_.max_angle_speed_));
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters.Ship)
+}
+
+inline void Parameters_Ship::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dead_zones_){arena}
+    , decltype(_impl_.max_eps_){0}
+    , decltype(_impl_.max_angle_speed_){0}
+  };
+}
+
+Parameters_Ship::~Parameters_Ship() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters.Ship)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters_Ship::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dead_zones_.~RepeatedPtrField();
+}
+
+void Parameters_Ship::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters_Ship::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters.Ship)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dead_zones_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.max_eps_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_angle_speed_) -
+        reinterpret_cast<char*>(&_impl_.max_eps_)) + sizeof(_impl_.max_angle_speed_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters_Ship::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required double max_eps = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_max_eps(&has_bits);
+          _impl_.max_eps_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double max_angle_speed = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_max_angle_speed(&has_bits);
+          _impl_.max_angle_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Proto.Parameters.Ship.DeadZone dead_zones = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dead_zones(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters_Ship::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters.Ship)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required double max_eps = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_max_eps(), target);
+  }
+
+  // required double max_angle_speed = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_max_angle_speed(), target);
+  }
+
+  // repeated .Proto.Parameters.Ship.DeadZone dead_zones = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dead_zones_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dead_zones(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters.Ship)
+  return target;
+}
+
+size_t Parameters_Ship::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Proto.Parameters.Ship)
+  size_t total_size = 0;
+
+  if (_internal_has_max_eps()) {
+    // required double max_eps = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_max_angle_speed()) {
+    // required double max_angle_speed = 2;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t Parameters_Ship::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters.Ship)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required double max_eps = 1;
+    total_size += 1 + 8;
+
+    // required double max_angle_speed = 2;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Proto.Parameters.Ship.DeadZone dead_zones = 3;
+  total_size += 1UL * this->_internal_dead_zones_size();
+  for (const auto& msg : this->_impl_.dead_zones_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters_Ship::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters_Ship::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters_Ship::GetClassData() const { return &_class_data_; }
+
+
+void Parameters_Ship::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters_Ship*>(&to_msg);
+  auto& from = static_cast<const Parameters_Ship&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters.Ship)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dead_zones_.MergeFrom(from._impl_.dead_zones_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.max_eps_ = from._impl_.max_eps_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_angle_speed_ = from._impl_.max_angle_speed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters_Ship::CopyFrom(const Parameters_Ship& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters.Ship)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters_Ship::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.dead_zones_))
+    return false;
+  return true;
+}
+
+void Parameters_Ship::InternalSwap(Parameters_Ship* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.dead_zones_.InternalSwap(&other->_impl_.dead_zones_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Parameters_Ship, _impl_.max_angle_speed_)
+      + sizeof(Parameters_Ship::_impl_.max_angle_speed_)
+      - PROTOBUF_FIELD_OFFSET(Parameters_Ship, _impl_.max_eps_)>(
+          reinterpret_cast<char*>(&_impl_.max_eps_),
+          reinterpret_cast<char*>(&other->_impl_.max_eps_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters_Ship::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[3]);
+}
+
+// ===================================================================
+
+class Parameters_General::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters_General>()._impl_._has_bits_);
+  static void set_has_death_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_play_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_big_radar_measure_cnt(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_small_radar_measure_cnt(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_aprox_small_radar_measure_cnt(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_margin_angle(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_margin_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_kinematics_step(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_process_budget_share(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_target_selection(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_rotation_cache_step(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_geometry_pos_tolerance(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_geometry_speed_tolerance(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_track_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_kalman_measurement_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_kalman_acceleration_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_kalman_precise_speed_stddev(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_tick_arena_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_planner_horizon(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_planner_beam_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static void set_has_planner_max_depth(HasBits* has_bits) {
+    (*has_bits)[0] |= 8388608u;
+  }
+  static void set_has_association_gate(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+  static void set_has_geometry_parallel_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 16777216u;
+  }
+  static void set_has_scheduler_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_scheduler_pin_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+Parameters_General::Parameters_General(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters.General)
+}
+Parameters_General::Parameters_General(const Parameters_General& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters_General* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.process_budget_share_){}
+    , decltype(_impl_.geometry_pos_tolerance_){}
+    , decltype(_impl_.target_selection_){}
+    , decltype(_impl_.track_filter_){}
+    , decltype(_impl_.geometry_speed_tolerance_){}
+    , decltype(_impl_.scheduler_pin_threads_){}
+    , decltype(_impl_.scheduler_threads_){}
+    , decltype(_impl_.death_time_){}
+    , decltype(_impl_.play_speed_){}
+    , decltype(_impl_.big_radar_measure_cnt_){}
+    , decltype(_impl_.small_radar_measure_cnt_){}
+    , decltype(_impl_.aprox_small_radar_measure_cnt_){}
+    , decltype(_impl_.margin_angle_){}
+    , decltype(_impl_.margin_time_){}
+    , decltype(_impl_.kinematics_step_){}
+    , decltype(_impl_.rotation_cache_step_){}
+    , decltype(_impl_.kalman_measurement_stddev_){}
+    , decltype(_impl_.kalman_acceleration_stddev_){}
+    , decltype(_impl_.kalman_precise_speed_stddev_){}
+    , decltype(_impl_.planner_horizon_){}
+    , decltype(_impl_.tick_arena_size_){}
+    , decltype(_impl_.planner_beam_width_){}
+    , decltype(_impl_.association_gate_){}
+    , decltype(_impl_.planner_max_depth_){}
+    , decltype(_impl_.geometry_parallel_threshold_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.process_budget_share_, &from._impl_.process_budget_share_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.geometry_parallel_threshold_) -
+    reinterpret_cast<char*>(&_impl_.process_budget_share_)) + sizeof(_impl_.geometry_parallel_threshold_));
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters.General)
+}
+
+inline void Parameters_General::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.process_budget_share_){0}
+    , decltype(_impl_.geometry_pos_tolerance_){0}
+    , decltype(_impl_.target_selection_){0}
+    , decltype(_impl_.track_filter_){0}
+    , decltype(_impl_.geometry_speed_tolerance_){0}
+    , decltype(_impl_.scheduler_pin_threads_){false}
+    , decltype(_impl_.scheduler_threads_){1}
+    , decltype(_impl_.death_time_){5000}
+    , decltype(_impl_.play_speed_){1}
+    , decltype(_impl_.big_radar_measure_cnt_){30}
+    , decltype(_impl_.small_radar_measure_cnt_){40}
+    , decltype(_impl_.aprox_small_radar_measure_cnt_){10}
+    , decltype(_impl_.margin_angle_){5}
+    , decltype(_impl_.margin_time_){3000}
+    , decltype(_impl_.kinematics_step_){5}
+    , decltype(_impl_.rotation_cache_step_){0.1}
+    , decltype(_impl_.kalman_measurement_stddev_){0.3}
+    , decltype(_impl_.kalman_acceleration_stddev_){0.01}
+    , decltype(_impl_.kalman_precise_speed_stddev_){0.05}
+    , decltype(_impl_.planner_horizon_){10000}
+    , decltype(_impl_.tick_arena_size_){262144}
+    , decltype(_impl_.planner_beam_width_){8}
+    , decltype(_impl_.association_gate_){10}
+    , decltype(_impl_.planner_max_depth_){3}
+    , decltype(_impl_.geometry_parallel_threshold_){64}
+  };
+}
+
+Parameters_General::~Parameters_General() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters.General)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters_General::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Parameters_General::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters_General::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters.General)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.process_budget_share_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.scheduler_pin_threads_) -
+        reinterpret_cast<char*>(&_impl_.process_budget_share_)) + sizeof(_impl_.scheduler_pin_threads_));
+    _impl_.scheduler_threads_ = 1;
+    _impl_.death_time_ = 5000;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    _impl_.play_speed_ = 1;
+    _impl_.big_radar_measure_cnt_ = 30;
+    _impl_.small_radar_measure_cnt_ = 40;
+    _impl_.aprox_small_radar_measure_cnt_ = 10;
+    _impl_.margin_angle_ = 5;
+    _impl_.margin_time_ = 3000;
+    _impl_.kinematics_step_ = 5;
+    _impl_.rotation_cache_step_ = 0.1;
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    _impl_.kalman_measurement_stddev_ = 0.3;
+    _impl_.kalman_acceleration_stddev_ = 0.01;
+    _impl_.kalman_precise_speed_stddev_ = 0.05;
+    _impl_.planner_horizon_ = 10000;
+    _impl_.tick_arena_size_ = 262144;
+    _impl_.planner_beam_width_ = 8;
+    _impl_.association_gate_ = 10;
+    _impl_.planner_max_depth_ = 3;
+  }
+  _impl_.geometry_parallel_threshold_ = 64;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters_General::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double death_time = 1 [default = 5000];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_death_time(&has_bits);
+          _impl_.death_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double play_speed = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_play_speed(&has_bits);
+          _impl_.play_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double big_radar_measure_cnt = 3 [default = 30];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_big_radar_measure_cnt(&has_bits);
+          _impl_.big_radar_measure_cnt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double small_radar_measure_cnt = 4 [default = 40];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_small_radar_measure_cnt(&has_bits);
+          _impl_.small_radar_measure_cnt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double aprox_small_radar_measure_cnt = 5 [default = 10];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_aprox_small_radar_measure_cnt(&has_bits);
+          _impl_.aprox_small_radar_measure_cnt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double margin_angle = 6 [default = 5];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_margin_angle(&has_bits);
+          _impl_.margin_angle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double margin_time = 7 [default = 3000];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_margin_time(&has_bits);
+          _impl_.margin_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double kinematics_step = 8 [default = 5];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_kinematics_step(&has_bits);
+          _impl_.kinematics_step_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double process_budget_share = 9 [default = 0];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_process_budget_share(&has_bits);
+          _impl_.process_budget_share_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Proto.Parameters.General.TargetSelection target_selection = 10 [default = GREEDY];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::Proto::Parameters_General_TargetSelection_IsValid(val))) {
+            _internal_set_target_selection(static_cast<::Proto::Parameters_General_TargetSelection>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(10, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rotation_cache_step = 11 [default = 0.1];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _Internal::set_has_rotation_cache_step(&has_bits);
+          _impl_.rotation_cache_step_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double geometry_pos_tolerance = 12 [default = 0];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_geometry_pos_tolerance(&has_bits);
+          _impl_.geometry_pos_tolerance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double geometry_speed_tolerance = 13 [default = 0];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_geometry_speed_tolerance(&has_bits);
+          _impl_.geometry_speed_tolerance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Proto.Parameters.General.TrackFilter track_filter = 14 [default = AB_FILTER];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::Proto::Parameters_General_TrackFilter_IsValid(val))) {
+            _internal_set_track_filter(static_cast<::Proto::Parameters_General_TrackFilter>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(14, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double kalman_measurement_stddev = 15 [default = 0.3];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          _Internal::set_has_kalman_measurement_stddev(&has_bits);
+          _impl_.kalman_measurement_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double kalman_acceleration_stddev = 16 [default = 0.01];
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          _Internal::set_has_kalman_acceleration_stddev(&has_bits);
+          _impl_.kalman_acceleration_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double kalman_precise_speed_stddev = 17 [default = 0.05];
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 137)) {
+          _Internal::set_has_kalman_precise_speed_stddev(&has_bits);
+          _impl_.kalman_precise_speed_stddev_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 tick_arena_size = 18 [default = 262144];
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_tick_arena_size(&has_bits);
+          _impl_.tick_arena_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double planner_horizon = 19 [default = 10000];
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 153)) {
+          _Internal::set_has_planner_horizon(&has_bits);
+          _impl_.planner_horizon_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 planner_beam_width = 20 [default = 8];
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _Internal::set_has_planner_beam_width(&has_bits);
+          _impl_.planner_beam_width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 planner_max_depth = 21 [default = 3];
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _Internal::set_has_planner_max_depth(&has_bits);
+          _impl_.planner_max_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double association_gate = 23 [default = 10];
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 185)) {
+          _Internal::set_has_association_gate(&has_bits);
+          _impl_.association_gate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 geometry_parallel_threshold = 25 [default = 64];
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 200)) {
+          _Internal::set_has_geometry_parallel_threshold(&has_bits);
+          _impl_.geometry_parallel_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 scheduler_threads = 26 [default = 1];
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 208)) {
+          _Internal::set_has_scheduler_threads(&has_bits);
+          _impl_.scheduler_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool scheduler_pin_threads = 27 [default = false];
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 216)) {
+          _Internal::set_has_scheduler_pin_threads(&has_bits);
+          _impl_.scheduler_pin_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters_General::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters.General)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double death_time = 1 [default = 5000];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_death_time(), target);
+  }
+
+  // optional double play_speed = 2 [default = 1];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_play_speed(), target);
+  }
+
+  // optional double big_radar_measure_cnt = 3 [default = 30];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_big_radar_measure_cnt(), target);
+  }
+
+  // optional double small_radar_measure_cnt = 4 [default = 40];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_small_radar_measure_cnt(), target);
+  }
+
+  // optional double aprox_small_radar_measure_cnt = 5 [default = 10];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_aprox_small_radar_measure_cnt(), target);
+  }
+
+  // optional double margin_angle = 6 [default = 5];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_margin_angle(), target);
+  }
+
+  // optional double margin_time = 7 [default = 3000];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_margin_time(), target);
+  }
+
+  // optional double kinematics_step = 8 [default = 5];
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_kinematics_step(), target);
+  }
+
+  // optional double process_budget_share = 9 [default = 0];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_process_budget_share(), target);
+  }
+
+  // optional .Proto.Parameters.General.TargetSelection target_selection = 10 [default = GREEDY];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      10, this->_internal_target_selection(), target);
+  }
+
+  // optional double rotation_cache_step = 11 [default = 0.1];
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_rotation_cache_step(), target);
+  }
+
+  // optional double geometry_pos_tolerance = 12 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_geometry_pos_tolerance(), target);
+  }
+
+  // optional double geometry_speed_tolerance = 13 [default = 0];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_geometry_speed_tolerance(), target);
+  }
+
+  // optional .Proto.Parameters.General.TrackFilter track_filter = 14 [default = AB_FILTER];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      14, this->_internal_track_filter(), target);
+  }
+
+  // optional double kalman_measurement_stddev = 15 [default = 0.3];
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(15, this->_internal_kalman_measurement_stddev(), target);
+  }
+
+  // optional double kalman_acceleration_stddev = 16 [default = 0.01];
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(16, this->_internal_kalman_acceleration_stddev(), target);
+  }
+
+  // optional double kalman_precise_speed_stddev = 17 [default = 0.05];
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(17, this->_internal_kalman_precise_speed_stddev(), target);
+  }
+
+  // optional int32 tick_arena_size = 18 [default = 262144];
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_tick_arena_size(), target);
+  }
+
+  // optional double planner_horizon = 19 [default = 10000];
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(19, this->_internal_planner_horizon(), target);
+  }
+
+  // optional int32 planner_beam_width = 20 [default = 8];
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(20, this->_internal_planner_beam_width(), target);
+  }
+
+  // optional int32 planner_max_depth = 21 [default = 3];
+  if (cached_has_bits & 0x00800000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(21, this->_internal_planner_max_depth(), target);
+  }
+
+  // optional double association_gate = 23 [default = 10];
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(23, this->_internal_association_gate(), target);
+  }
+
+  // optional int32 geometry_parallel_threshold = 25 [default = 64];
+  if (cached_has_bits & 0x01000000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(25, this->_internal_geometry_parallel_threshold(), target);
+  }
+
+  // optional int32 scheduler_threads = 26 [default = 1];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(26, this->_internal_scheduler_threads(), target);
+  }
+
+  // optional bool scheduler_pin_threads = 27 [default = false];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(27, this->_internal_scheduler_pin_threads(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters.General)
+  return target;
+}
+
+size_t Parameters_General::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters.General)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional double process_budget_share = 9 [default = 0];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double geometry_pos_tolerance = 12 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional .Proto.Parameters.General.TargetSelection target_selection = 10 [default = GREEDY];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_target_selection());
+    }
+
+    // optional .Proto.Parameters.General.TrackFilter track_filter = 14 [default = AB_FILTER];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_track_filter());
+    }
+
+    // optional double geometry_speed_tolerance = 13 [default = 0];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional bool scheduler_pin_threads = 27 [default = false];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 + 1;
+    }
+
+    // optional int32 scheduler_threads = 26 [default = 1];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_scheduler_threads());
+    }
+
+    // optional double death_time = 1 [default = 5000];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional double play_speed = 2 [default = 1];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double big_radar_measure_cnt = 3 [default = 30];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double small_radar_measure_cnt = 4 [default = 40];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double aprox_small_radar_measure_cnt = 5 [default = 10];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double margin_angle = 6 [default = 5];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double margin_time = 7 [default = 3000];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double kinematics_step = 8 [default = 5];
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rotation_cache_step = 11 [default = 0.1];
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    // optional double kalman_measurement_stddev = 15 [default = 0.3];
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double kalman_acceleration_stddev = 16 [default = 0.01];
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double kalman_precise_speed_stddev = 17 [default = 0.05];
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional double planner_horizon = 19 [default = 10000];
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional int32 tick_arena_size = 18 [default = 262144];
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_tick_arena_size());
+    }
+
+    // optional int32 planner_beam_width = 20 [default = 8];
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_planner_beam_width());
+    }
+
+    // optional double association_gate = 23 [default = 10];
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 2 + 8;
+    }
+
+    // optional int32 planner_max_depth = 21 [default = 3];
+    if (cached_has_bits & 0x00800000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(
+          this->_internal_planner_max_depth());
+    }
+
+  }
+  // optional int32 geometry_parallel_threshold = 25 [default = 64];
+  if (cached_has_bits & 0x01000000u) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_geometry_parallel_threshold());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters_General::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters_General::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters_General::GetClassData() const { return &_class_data_; }
+
+
+void Parameters_General::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters_General*>(&to_msg);
+  auto& from = static_cast<const Parameters_General&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters.General)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.process_budget_share_ = from._impl_.process_budget_share_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.geometry_pos_tolerance_ = from._impl_.geometry_pos_tolerance_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.target_selection_ = from._impl_.target_selection_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.track_filter_ = from._impl_.track_filter_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.geometry_speed_tolerance_ = from._impl_.geometry_speed_tolerance_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.scheduler_pin_threads_ = from._impl_.scheduler_pin_threads_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.scheduler_threads_ = from._impl_.scheduler_threads_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.death_time_ = from._impl_.death_time_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.play_speed_ = from._impl_.play_speed_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.big_radar_measure_cnt_ = from._impl_.big_radar_measure_cnt_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.small_radar_measure_cnt_ = from._impl_.small_radar_measure_cnt_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.aprox_small_radar_measure_cnt_ = from._impl_.aprox_small_radar_measure_cnt_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.margin_angle_ = from._impl_.margin_angle_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.margin_time_ = from._impl_.margin_time_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.kinematics_step_ = from._impl_.kinematics_step_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.rotation_cache_step_ = from._impl_.rotation_cache_step_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00ff0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.kalman_measurement_stddev_ = from._impl_.kalman_measurement_stddev_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.kalman_acceleration_stddev_ = from._impl_.kalman_acceleration_stddev_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.kalman_precise_speed_stddev_ = from._impl_.kalman_precise_speed_stddev_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.planner_horizon_ = from._impl_.planner_horizon_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.tick_arena_size_ = from._impl_.tick_arena_size_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.planner_beam_width_ = from._impl_.planner_beam_width_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      _this->_impl_.association_gate_ = from._impl_.association_gate_;
+    }
+    if (cached_has_bits & 0x00800000u) {
+      _this->_impl_.planner_max_depth_ = from._impl_.planner_max_depth_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x01000000u) {
+    _this->_internal_set_geometry_parallel_threshold(from._internal_geometry_parallel_threshold());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters_General::CopyFrom(const Parameters_General& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters.General)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters_General::IsInitialized() const {
+  return true;
+}
+
+void Parameters_General::InternalSwap(Parameters_General* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Parameters_General, _impl_.scheduler_pin_threads_)
+      + sizeof(Parameters_General::_impl_.scheduler_pin_threads_)
+      - PROTOBUF_FIELD_OFFSET(Parameters_General, _impl_.process_budget_share_)>(
+          reinterpret_cast<char*>(&_impl_.process_budget_share_),
+          reinterpret_cast<char*>(&other->_impl_.process_budget_share_));
+  swap(_impl_.scheduler_threads_, other->_impl_.scheduler_threads_);
+  swap(_impl_.death_time_, other->_impl_.death_time_);
+  swap(_impl_.play_speed_, other->_impl_.play_speed_);
+  swap(_impl_.big_radar_measure_cnt_, other->_impl_.big_radar_measure_cnt_);
+  swap(_impl_.small_radar_measure_cnt_, other->_impl_.small_radar_measure_cnt_);
+  swap(_impl_.aprox_small_radar_measure_cnt_, other->_impl_.aprox_small_radar_measure_cnt_);
+  swap(_impl_.margin_angle_, other->_impl_.margin_angle_);
+  swap(_impl_.margin_time_, other->_impl_.margin_time_);
+  swap(_impl_.kinematics_step_, other->_impl_.kinematics_step_);
+  swap(_impl_.rotation_cache_step_, other->_impl_.rotation_cache_step_);
+  swap(_impl_.kalman_measurement_stddev_, other->_impl_.kalman_measurement_stddev_);
+  swap(_impl_.kalman_acceleration_stddev_, other->_impl_.kalman_acceleration_stddev_);
+  swap(_impl_.kalman_precise_speed_stddev_, other->_impl_.kalman_precise_speed_stddev_);
+  swap(_impl_.planner_horizon_, other->_impl_.planner_horizon_);
+  swap(_impl_.tick_arena_size_, other->_impl_.tick_arena_size_);
+  swap(_impl_.planner_beam_width_, other->_impl_.planner_beam_width_);
+  swap(_impl_.association_gate_, other->_impl_.association_gate_);
+  swap(_impl_.planner_max_depth_, other->_impl_.planner_max_depth_);
+  swap(_impl_.geometry_parallel_threshold_, other->_impl_.geometry_parallel_threshold_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters_General::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[4]);
+}
+
+// ===================================================================
+
+class Parameters_Defense::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters_Defense>()._impl_._has_bits_);
+  static void set_has_time_to_launch_rocket(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_rocket_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_launchers_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_reload_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_magazine_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_planned_launches_per_launcher(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_kill_radius(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+Parameters_Defense::Parameters_Defense(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters.Defense)
+}
+Parameters_Defense::Parameters_Defense(const Parameters_Defense& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters_Defense* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.launchers_count_){}
+    , decltype(_impl_.magazine_size_){}
+    , decltype(_impl_.planned_launches_per_launcher_){}
+    , decltype(_impl_.time_to_launch_rocket_){}
+    , decltype(_impl_.rocket_speed_){}
+    , decltype(_impl_.reload_time_){}
+    , decltype(_impl_.kill_radius_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.launchers_count_, &from._impl_.launchers_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.kill_radius_) -
+    reinterpret_cast<char*>(&_impl_.launchers_count_)) + sizeof(_impl_.kill_radius_));
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters.Defense)
+}
+
+inline void Parameters_Defense::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.launchers_count_){0u}
+    , decltype(_impl_.magazine_size_){0u}
+    , decltype(_impl_.planned_launches_per_launcher_){3u}
+    , decltype(_impl_.time_to_launch_rocket_){3000}
+    , decltype(_impl_.rocket_speed_){5}
+    , decltype(_impl_.reload_time_){5000}
+    , decltype(_impl_.kill_radius_){10}
+  };
+}
+
+Parameters_Defense::~Parameters_Defense() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters.Defense)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters_Defense::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Parameters_Defense::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters_Defense::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters.Defense)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    ::memset(&_impl_.launchers_count_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.magazine_size_) -
+        reinterpret_cast<char*>(&_impl_.launchers_count_)) + sizeof(_impl_.magazine_size_));
+    _impl_.planned_launches_per_launcher_ = 3u;
+    _impl_.time_to_launch_rocket_ = 3000;
+    _impl_.rocket_speed_ = 5;
+    _impl_.reload_time_ = 5000;
+    _impl_.kill_radius_ = 10;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters_Defense::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double time_to_launch_rocket = 1 [default = 3000];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_time_to_launch_rocket(&has_bits);
+          _impl_.time_to_launch_rocket_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rocket_speed = 2 [default = 5];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_rocket_speed(&has_bits);
+          _impl_.rocket_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 launchers_count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_launchers_count(&has_bits);
+          _impl_.launchers_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double reload_time = 4 [default = 5000];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_reload_time(&has_bits);
+          _impl_.reload_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 magazine_size = 5 [default = 0];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_magazine_size(&has_bits);
+          _impl_.magazine_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 planned_launches_per_launcher = 6 [default = 3];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_planned_launches_per_launcher(&has_bits);
+          _impl_.planned_launches_per_launcher_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double kill_radius = 7 [default = 10];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_kill_radius(&has_bits);
+          _impl_.kill_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters_Defense::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters.Defense)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double time_to_launch_rocket = 1 [default = 3000];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_time_to_launch_rocket(), target);
+  }
+
+  // optional double rocket_speed = 2 [default = 5];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_rocket_speed(), target);
+  }
+
+  // optional uint32 launchers_count = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_launchers_count(), target);
+  }
+
+  // optional double reload_time = 4 [default = 5000];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_reload_time(), target);
+  }
+
+  // optional uint32 magazine_size = 5 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_magazine_size(), target);
+  }
+
+  // optional uint32 planned_launches_per_launcher = 6 [default = 3];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_planned_launches_per_launcher(), target);
+  }
+
+  // optional double kill_radius = 7 [default = 10];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_kill_radius(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters.Defense)
+  return target;
+}
+
+size_t Parameters_Defense::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters.Defense)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional uint32 launchers_count = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_launchers_count());
+    }
+
+    // optional uint32 magazine_size = 5 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_magazine_size());
+    }
+
+    // optional uint32 planned_launches_per_launcher = 6 [default = 3];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_planned_launches_per_launcher());
+    }
+
+    // optional double time_to_launch_rocket = 1 [default = 3000];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double rocket_speed = 2 [default = 5];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double reload_time = 4 [default = 5000];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double kill_radius = 7 [default = 10];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters_Defense::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters_Defense::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters_Defense::GetClassData() const { return &_class_data_; }
+
+
+void Parameters_Defense::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters_Defense*>(&to_msg);
+  auto& from = static_cast<const Parameters_Defense&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters.Defense)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.launchers_count_ = from._impl_.launchers_count_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.magazine_size_ = from._impl_.magazine_size_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.planned_launches_per_launcher_ = from._impl_.planned_launches_per_launcher_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.time_to_launch_rocket_ = from._impl_.time_to_launch_rocket_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.rocket_speed_ = from._impl_.rocket_speed_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.reload_time_ = from._impl_.reload_time_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.kill_radius_ = from._impl_.kill_radius_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters_Defense::CopyFrom(const Parameters_Defense& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters.Defense)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters_Defense::IsInitialized() const {
+  return true;
+}
+
+void Parameters_Defense::InternalSwap(Parameters_Defense* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Parameters_Defense, _impl_.magazine_size_)
+      + sizeof(Parameters_Defense::_impl_.magazine_size_)
+      - PROTOBUF_FIELD_OFFSET(Parameters_Defense, _impl_.launchers_count_)>(
+          reinterpret_cast<char*>(&_impl_.launchers_count_),
+          reinterpret_cast<char*>(&other->_impl_.launchers_count_));
+  swap(_impl_.planned_launches_per_launcher_, other->_impl_.planned_launches_per_launcher_);
+  swap(_impl_.time_to_launch_rocket_, other->_impl_.time_to_launch_rocket_);
+  swap(_impl_.rocket_speed_, other->_impl_.rocket_speed_);
+  swap(_impl_.reload_time_, other->_impl_.reload_time_);
+  swap(_impl_.kill_radius_, other->_impl_.kill_radius_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters_Defense::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[5]);
+}
+
+// ===================================================================
+
+class Parameters_Simulator::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters_Simulator>()._impl_._has_bits_);
+  static void set_has_targets_per_minute(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_min_target_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_max_target_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_max_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_deviation_angle_vertical(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_probability_of_accurate_missile(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_random_seed(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_strip_ids(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+Parameters_Simulator::Parameters_Simulator(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters.Simulator)
+}
+Parameters_Simulator::Parameters_Simulator(const Parameters_Simulator& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters_Simulator* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.max_height_){}
+    , decltype(_impl_.random_seed_){}
+    , decltype(_impl_.strip_ids_){}
+    , decltype(_impl_.targets_per_minute_){}
+    , decltype(_impl_.min_target_speed_){}
+    , decltype(_impl_.max_target_speed_){}
+    , decltype(_impl_.max_deviation_angle_vertical_){}
+    , decltype(_impl_.probability_of_accurate_missile_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.max_height_, &from._impl_.max_height_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.probability_of_accurate_missile_) -
+    reinterpret_cast<char*>(&_impl_.max_height_)) + sizeof(_impl_.probability_of_accurate_missile_));
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters.Simulator)
+}
+
+inline void Parameters_Simulator::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.max_height_){0}
+    , decltype(_impl_.random_seed_){0u}
+    , decltype(_impl_.strip_ids_){false}
+    , decltype(_impl_.targets_per_minute_){3u}
+    , decltype(_impl_.min_target_speed_){1}
+    , decltype(_impl_.max_target_speed_){2}
+    , decltype(_impl_.max_deviation_angle_vertical_){15}
+    , decltype(_impl_.probability_of_accurate_missile_){0.4}
+  };
+}
+
+Parameters_Simulator::~Parameters_Simulator() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters.Simulator)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters_Simulator::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Parameters_Simulator::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters_Simulator::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters.Simulator)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.max_height_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.strip_ids_) -
+        reinterpret_cast<char*>(&_impl_.max_height_)) + sizeof(_impl_.strip_ids_));
+    _impl_.targets_per_minute_ = 3u;
+    _impl_.min_target_speed_ = 1;
+    _impl_.max_target_speed_ = 2;
+    _impl_.max_deviation_angle_vertical_ = 15;
+    _impl_.probability_of_accurate_missile_ = 0.4;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters_Simulator::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 targets_per_minute = 1 [default = 3];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_targets_per_minute(&has_bits);
+          _impl_.targets_per_minute_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double min_target_speed = 2 [default = 1];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_min_target_speed(&has_bits);
+          _impl_.min_target_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double max_target_speed = 3 [default = 2];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_max_target_speed(&has_bits);
+          _impl_.max_target_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double max_height = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_max_height(&has_bits);
+          _impl_.max_height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double max_deviation_angle_vertical = 5 [default = 15];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_max_deviation_angle_vertical(&has_bits);
+          _impl_.max_deviation_angle_vertical_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double probability_of_accurate_missile = 6 [default = 0.4];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_probability_of_accurate_missile(&has_bits);
+          _impl_.probability_of_accurate_missile_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 random_seed = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_random_seed(&has_bits);
+          _impl_.random_seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool strip_ids = 8 [default = false];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_strip_ids(&has_bits);
+          _impl_.strip_ids_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters_Simulator::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters.Simulator)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 targets_per_minute = 1 [default = 3];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_targets_per_minute(), target);
+  }
+
+  // optional double min_target_speed = 2 [default = 1];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_min_target_speed(), target);
+  }
+
+  // optional double max_target_speed = 3 [default = 2];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_max_target_speed(), target);
+  }
+
+  // required double max_height = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_max_height(), target);
+  }
+
+  // optional double max_deviation_angle_vertical = 5 [default = 15];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_max_deviation_angle_vertical(), target);
+  }
+
+  // optional double probability_of_accurate_missile = 6 [default = 0.4];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_probability_of_accurate_missile(), target);
+  }
+
+  // optional uint32 random_seed = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_random_seed(), target);
+  }
+
+  // optional bool strip_ids = 8 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_strip_ids(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters.Simulator)
+  return target;
+}
+
+size_t Parameters_Simulator::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters.Simulator)
+  size_t total_size = 0;
+
+  // required double max_height = 4;
+  if (_internal_has_max_height()) {
+    total_size += 1 + 8;
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000feu) {
+    // optional uint32 random_seed = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_random_seed());
+    }
+
+    // optional bool strip_ids = 8 [default = false];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 targets_per_minute = 1 [default = 3];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_targets_per_minute());
+    }
+
+    // optional double min_target_speed = 2 [default = 1];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double max_target_speed = 3 [default = 2];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double max_deviation_angle_vertical = 5 [default = 15];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double probability_of_accurate_missile = 6 [default = 0.4];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters_Simulator::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters_Simulator::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters_Simulator::GetClassData() const { return &_class_data_; }
+
+
+void Parameters_Simulator::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters_Simulator*>(&to_msg);
+  auto& from = static_cast<const Parameters_Simulator&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters.Simulator)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.max_height_ = from._impl_.max_height_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.random_seed_ = from._impl_.random_seed_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.strip_ids_ = from._impl_.strip_ids_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.targets_per_minute_ = from._impl_.targets_per_minute_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.min_target_speed_ = from._impl_.min_target_speed_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.max_target_speed_ = from._impl_.max_target_speed_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.max_deviation_angle_vertical_ = from._impl_.max_deviation_angle_vertical_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.probability_of_accurate_missile_ = from._impl_.probability_of_accurate_missile_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters_Simulator::CopyFrom(const Parameters_Simulator& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters.Simulator)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters_Simulator::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Parameters_Simulator::InternalSwap(Parameters_Simulator* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Parameters_Simulator, _impl_.strip_ids_)
+      + sizeof(Parameters_Simulator::_impl_.strip_ids_)
+      - PROTOBUF_FIELD_OFFSET(Parameters_Simulator, _impl_.max_height_)>(
+          reinterpret_cast<char*>(&_impl_.max_height_),
+          reinterpret_cast<char*>(&other->_impl_.max_height_));
+  swap(_impl_.targets_per_minute_, other->_impl_.targets_per_minute_);
+  swap(_impl_.min_target_speed_, other->_impl_.min_target_speed_);
+  swap(_impl_.max_target_speed_, other->_impl_.max_target_speed_);
+  swap(_impl_.max_deviation_angle_vertical_, other->_impl_.max_deviation_angle_vertical_);
+  swap(_impl_.probability_of_accurate_missile_, other->_impl_.probability_of_accurate_missile_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters_Simulator::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[6]);
+}
+
+// ===================================================================
+
+class Parameters_Visualizer::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters_Visualizer>()._impl_._has_bits_);
+  static void set_has_radars_outline_thickness(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_target_radius(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_draw_entry_points(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_fps(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Parameters_Visualizer::Parameters_Visualizer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters.Visualizer)
+}
+Parameters_Visualizer::Parameters_Visualizer(const Parameters_Visualizer& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters_Visualizer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.draw_entry_points_){}
+    , decltype(_impl_.fps_){}
+    , decltype(_impl_.radars_outline_thickness_){}
+    , decltype(_impl_.target_radius_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.draw_entry_points_, &from._impl_.draw_entry_points_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.target_radius_) -
+    reinterpret_cast<char*>(&_impl_.draw_entry_points_)) + sizeof(_impl_.target_radius_));
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters.Visualizer)
+}
+
+inline void Parameters_Visualizer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.draw_entry_points_){false}
+    , decltype(_impl_.fps_){60u}
+    , decltype(_impl_.radars_outline_thickness_){1u}
+    , decltype(_impl_.target_radius_){5u}
+  };
+}
+
+Parameters_Visualizer::~Parameters_Visualizer() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters.Visualizer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters_Visualizer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Parameters_Visualizer::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters_Visualizer::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters.Visualizer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    _impl_.draw_entry_points_ = false;
+    _impl_.fps_ = 60u;
+    _impl_.radars_outline_thickness_ = 1u;
+    _impl_.target_radius_ = 5u;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters_Visualizer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 radars_outline_thickness = 1 [default = 1];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_radars_outline_thickness(&has_bits);
+          _impl_.radars_outline_thickness_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 target_radius = 2 [default = 5];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_target_radius(&has_bits);
+          _impl_.target_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool draw_entry_points = 3 [default = false];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_draw_entry_points(&has_bits);
+          _impl_.draw_entry_points_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 fps = 4 [default = 60];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_fps(&has_bits);
+          _impl_.fps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters_Visualizer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters.Visualizer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 radars_outline_thickness = 1 [default = 1];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_radars_outline_thickness(), target);
+  }
+
+  // optional uint32 target_radius = 2 [default = 5];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_target_radius(), target);
+  }
+
+  // optional bool draw_entry_points = 3 [default = false];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_draw_entry_points(), target);
+  }
+
+  // optional uint32 fps = 4 [default = 60];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_fps(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters.Visualizer)
+  return target;
+}
+
+size_t Parameters_Visualizer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters.Visualizer)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional bool draw_entry_points = 3 [default = false];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 fps = 4 [default = 60];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_fps());
+    }
+
+    // optional uint32 radars_outline_thickness = 1 [default = 1];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_radars_outline_thickness());
+    }
+
+    // optional uint32 target_radius = 2 [default = 5];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_target_radius());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters_Visualizer::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters_Visualizer::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters_Visualizer::GetClassData() const { return &_class_data_; }
+
+
+void Parameters_Visualizer::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters_Visualizer*>(&to_msg);
+  auto& from = static_cast<const Parameters_Visualizer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters.Visualizer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.draw_entry_points_ = from._impl_.draw_entry_points_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.fps_ = from._impl_.fps_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.radars_outline_thickness_ = from._impl_.radars_outline_thickness_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.target_radius_ = from._impl_.target_radius_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters_Visualizer::CopyFrom(const Parameters_Visualizer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters.Visualizer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters_Visualizer::IsInitialized() const {
+  return true;
+}
+
+void Parameters_Visualizer::InternalSwap(Parameters_Visualizer* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.draw_entry_points_, other->_impl_.draw_entry_points_);
+  swap(_impl_.fps_, other->_impl_.fps_);
+  swap(_impl_.radars_outline_thickness_, other->_impl_.radars_outline_thickness_);
+  swap(_impl_.target_radius_, other->_impl_.target_radius_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters_Visualizer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[7]);
+}
+
+// ===================================================================
+
+class Parameters::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Parameters>()._impl_._has_bits_);
+  static const ::Proto::Parameters_SmallRadar& small_radar(const Parameters* msg);
+  static void set_has_small_radar(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Proto::Parameters_BigRadar& big_radar(const Parameters* msg);
+  static void set_has_big_radar(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Proto::Parameters_Ship& ship(const Parameters* msg);
+  static void set_has_ship(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::Proto::Parameters_General& general(const Parameters* msg);
+  static void set_has_general(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::Proto::Parameters_Defense& defense(const Parameters* msg);
+  static void set_has_defense(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::Proto::Parameters_Simulator& simulator(const Parameters* msg);
+  static void set_has_simulator(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::Proto::Parameters_Visualizer& visualizer(const Parameters* msg);
+  static void set_has_visualizer(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007f) ^ 0x0000007f) != 0;
+  }
+};
+
+const ::Proto::Parameters_SmallRadar&
+Parameters::_Internal::small_radar(const Parameters* msg) {
+  return *msg->_impl_.small_radar_;
+}
+const ::Proto::Parameters_BigRadar&
+Parameters::_Internal::big_radar(const Parameters* msg) {
+  return *msg->_impl_.big_radar_;
+}
+const ::Proto::Parameters_Ship&
+Parameters::_Internal::ship(const Parameters* msg) {
+  return *msg->_impl_.ship_;
+}
+const ::Proto::Parameters_General&
+Parameters::_Internal::general(const Parameters* msg) {
+  return *msg->_impl_.general_;
+}
+const ::Proto::Parameters_Defense&
+Parameters::_Internal::defense(const Parameters* msg) {
+  return *msg->_impl_.defense_;
+}
+const ::Proto::Parameters_Simulator&
+Parameters::_Internal::simulator(const Parameters* msg) {
+  return *msg->_impl_.simulator_;
+}
+const ::Proto::Parameters_Visualizer&
+Parameters::_Internal::visualizer(const Parameters* msg) {
+  return *msg->_impl_.visualizer_;
+}
+Parameters::Parameters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.Parameters)
+}
+Parameters::Parameters(const Parameters& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Parameters* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.extra_small_radars_){from._impl_.extra_small_radars_}
+    , decltype(_impl_.small_radar_){nullptr}
+    , decltype(_impl_.big_radar_){nullptr}
+    , decltype(_impl_.ship_){nullptr}
+    , decltype(_impl_.general_){nullptr}
+    , decltype(_impl_.defense_){nullptr}
+    , decltype(_impl_.simulator_){nullptr}
+    , decltype(_impl_.visualizer_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_small_radar()) {
+    _this->_impl_.small_radar_ = new ::Proto::Parameters_SmallRadar(*from._impl_.small_radar_);
+  }
+  if (from._internal_has_big_radar()) {
+    _this->_impl_.big_radar_ = new ::Proto::Parameters_BigRadar(*from._impl_.big_radar_);
+  }
+  if (from._internal_has_ship()) {
+    _this->_impl_.ship_ = new ::Proto::Parameters_Ship(*from._impl_.ship_);
+  }
+  if (from._internal_has_general()) {
+    _this->_impl_.general_ = new ::Proto::Parameters_General(*from._impl_.general_);
+  }
+  if (from._internal_has_defense()) {
+    _this->_impl_.defense_ = new ::Proto::Parameters_Defense(*from._impl_.defense_);
+  }
+  if (from._internal_has_simulator()) {
+    _this->_impl_.simulator_ = new ::Proto::Parameters_Simulator(*from._impl_.simulator_);
+  }
+  if (from._internal_has_visualizer()) {
+    _this->_impl_.visualizer_ = new ::Proto::Parameters_Visualizer(*from._impl_.visualizer_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Proto.Parameters)
+}
+
+inline void Parameters::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.extra_small_radars_){arena}
+    , decltype(_impl_.small_radar_){nullptr}
+    , decltype(_impl_.big_radar_){nullptr}
+    , decltype(_impl_.ship_){nullptr}
+    , decltype(_impl_.general_){nullptr}
+    , decltype(_impl_.defense_){nullptr}
+    , decltype(_impl_.simulator_){nullptr}
+    , decltype(_impl_.visualizer_){nullptr}
+  };
+}
+
+Parameters::~Parameters() {
+  // @@protoc_insertion_point(destructor:Proto.Parameters)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Parameters::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.extra_small_radars_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.small_radar_;
+  if (this != internal_default_instance()) delete _impl_.big_radar_;
+  if (this != internal_default_instance()) delete _impl_.ship_;
+  if (this != internal_default_instance()) delete _impl_.general_;
+  if (this != internal_default_instance()) delete _impl_.defense_;
+  if (this != internal_default_instance()) delete _impl_.simulator_;
+  if (this != internal_default_instance()) delete _impl_.visualizer_;
+}
+
+void Parameters::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Parameters::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.Parameters)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.extra_small_radars_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.small_radar_ != nullptr);
+      _impl_.small_radar_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.big_radar_ != nullptr);
+      _impl_.big_radar_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.ship_ != nullptr);
+      _impl_.ship_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.general_ != nullptr);
+      _impl_.general_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.defense_ != nullptr);
+      _impl_.defense_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.simulator_ != nullptr);
+      _impl_.simulator_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.visualizer_ != nullptr);
+      _impl_.visualizer_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Parameters::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Proto.Parameters.SmallRadar small_radar = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_small_radar(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Proto.Parameters.BigRadar big_radar = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_big_radar(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Proto.Parameters.Ship ship = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ship(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Proto.Parameters.General general = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_general(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Proto.Parameters.Defense defense = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_defense(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Proto.Parameters.Simulator simulator = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_simulator(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Proto.Parameters.Visualizer visualizer = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_visualizer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Proto.Parameters.SmallRadar extra_small_radars = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_extra_small_radars(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Parameters::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.Parameters)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Proto.Parameters.SmallRadar small_radar = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::small_radar(this),
+        _Internal::small_radar(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Proto.Parameters.BigRadar big_radar = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::big_radar(this),
+        _Internal::big_radar(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Proto.Parameters.Ship ship = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::ship(this),
+        _Internal::ship(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Proto.Parameters.General general = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::general(this),
+        _Internal::general(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Proto.Parameters.Defense defense = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::defense(this),
+        _Internal::defense(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Proto.Parameters.Simulator simulator = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::simulator(this),
+        _Internal::simulator(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Proto.Parameters.Visualizer visualizer = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::visualizer(this),
+        _Internal::visualizer(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .Proto.Parameters.SmallRadar extra_small_radars = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_extra_small_radars_size()); i < n; i++) {
+    const auto& repfield = this->_internal_extra_small_radars(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.Parameters)
+  return target;
+}
+
+size_t Parameters::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Proto.Parameters)
+  size_t total_size = 0;
+
+  if (_internal_has_small_radar()) {
+    // required .Proto.Parameters.SmallRadar small_radar = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.small_radar_);
+  }
+
+  if (_internal_has_big_radar()) {
+    // required .Proto.Parameters.BigRadar big_radar = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.big_radar_);
+  }
+
+  if (_internal_has_ship()) {
+    // required .Proto.Parameters.Ship ship = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.ship_);
+  }
+
+  if (_internal_has_general()) {
+    // required .Proto.Parameters.General general = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.general_);
+  }
+
+  if (_internal_has_defense()) {
+    // required .Proto.Parameters.Defense defense = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.defense_);
+  }
+
+  if (_internal_has_simulator()) {
+    // required .Proto.Parameters.Simulator simulator = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.simulator_);
+  }
+
+  if (_internal_has_visualizer()) {
+    // required .Proto.Parameters.Visualizer visualizer = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.visualizer_);
+  }
+
+  return total_size;
+}
+size_t Parameters::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.Parameters)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007f) ^ 0x0000007f) == 0) {  // All required fields are present.
+    // required .Proto.Parameters.SmallRadar small_radar = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.small_radar_);
+
+    // required .Proto.Parameters.BigRadar big_radar = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.big_radar_);
+
+    // required .Proto.Parameters.Ship ship = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.ship_);
+
+    // required .Proto.Parameters.General general = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.general_);
+
+    // required .Proto.Parameters.Defense defense = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.defense_);
+
+    // required .Proto.Parameters.Simulator simulator = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.simulator_);
+
+    // required .Proto.Parameters.Visualizer visualizer = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.visualizer_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Proto.Parameters.SmallRadar extra_small_radars = 8;
+  total_size += 1UL * this->_internal_extra_small_radars_size();
+  for (const auto& msg : this->_impl_.extra_small_radars_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Parameters::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Parameters::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Parameters::GetClassData() const { return &_class_data_; }
+
+
+void Parameters::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Parameters*>(&to_msg);
+  auto& from = static_cast<const Parameters&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.Parameters)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.extra_small_radars_.MergeFrom(from._impl_.extra_small_radars_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_small_radar()->::Proto::Parameters_SmallRadar::MergeFrom(
+          from._internal_small_radar());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_big_radar()->::Proto::Parameters_BigRadar::MergeFrom(
+          from._internal_big_radar());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_ship()->::Proto::Parameters_Ship::MergeFrom(
+          from._internal_ship());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_general()->::Proto::Parameters_General::MergeFrom(
+          from._internal_general());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_defense()->::Proto::Parameters_Defense::MergeFrom(
+          from._internal_defense());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_simulator()->::Proto::Parameters_Simulator::MergeFrom(
+          from._internal_simulator());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_visualizer()->::Proto::Parameters_Visualizer::MergeFrom(
+          from._internal_visualizer());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Parameters::CopyFrom(const Parameters& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.Parameters)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Parameters::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.extra_small_radars_))
+    return false;
+  if (_internal_has_small_radar()) {
+    if (!_impl_.small_radar_->IsInitialized()) return false;
+  }
+  if (_internal_has_big_radar()) {
+    if (!_impl_.big_radar_->IsInitialized()) return false;
+  }
+  if (_internal_has_ship()) {
+    if (!_impl_.ship_->IsInitialized()) return false;
+  }
+  if (_internal_has_simulator()) {
+    if (!_impl_.simulator_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Parameters::InternalSwap(Parameters* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.extra_small_radars_.InternalSwap(&other->_impl_.extra_small_radars_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Parameters, _impl_.visualizer_)
+      + sizeof(Parameters::_impl_.visualizer_)
+      - PROTOBUF_FIELD_OFFSET(Parameters, _impl_.small_radar_)>(
+          reinterpret_cast<char*>(&_impl_.small_radar_),
+          reinterpret_cast<char*>(&other->_impl_.small_radar_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Parameters::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_params_2eproto_getter, &descriptor_table_params_2eproto_once,
+      file_level_metadata_params_2eproto[8]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Proto
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Proto::Parameters_SmallRadar*
+Arena::CreateMaybeMessage< ::Proto::Parameters_SmallRadar >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters_SmallRadar >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::Parameters_BigRadar*
+Arena::CreateMaybeMessage< ::Proto::Parameters_BigRadar >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters_BigRadar >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::Parameters_Ship_DeadZone*
+Arena::CreateMaybeMessage< ::Proto::Parameters_Ship_DeadZone >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters_Ship_DeadZone >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::Parameters_Ship*
+Arena::CreateMaybeMessage< ::Proto::Parameters_Ship >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters_Ship >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::Parameters_General*
+Arena::CreateMaybeMessage< ::Proto::Parameters_General >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters_General >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::Parameters_Defense*
+Arena::CreateMaybeMessage< ::Proto::Parameters_Defense >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters_Defense >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::Parameters_Simulator*
+Arena::CreateMaybeMessage< ::Proto::Parameters_Simulator >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters_Simulator >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::Parameters_Visualizer*
+Arena::CreateMaybeMessage< ::Proto::Parameters_Visualizer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters_Visualizer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::Parameters*
+Arena::CreateMaybeMessage< ::Proto::Parameters >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::Parameters >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,5218 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: params.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_params_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_params_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_params_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_params_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_params_2eproto;
+namespace Proto {
+class Parameters;
+struct ParametersDefaultTypeInternal;
+extern ParametersDefaultTypeInternal _Parameters_default_instance_;
+class Parameters_BigRadar;
+struct Parameters_BigRadarDefaultTypeInternal;
+extern Parameters_BigRadarDefaultTypeInternal _Parameters_BigRadar_default_instance_;
+class Parameters_Defense;
+struct Parameters_DefenseDefaultTypeInternal;
+extern Parameters_DefenseDefaultTypeInternal _Parameters_Defense_default_instance_;
+class Parameters_General;
+struct Parameters_GeneralDefaultTypeInternal;
+extern Parameters_GeneralDefaultTypeInternal _Parameters_General_default_instance_;
+class Parameters_Ship;
+struct Parameters_ShipDefaultTypeInternal;
+extern Parameters_ShipDefaultTypeInternal _Parameters_Ship_default_instance_;
+class Parameters_Ship_DeadZone;
+struct Parameters_Ship_DeadZoneDefaultTypeInternal;
+extern Parameters_Ship_DeadZoneDefaultTypeInternal _Parameters_Ship_DeadZone_default_instance_;
+class Parameters_Simulator;
+struct Parameters_SimulatorDefaultTypeInternal;
+extern Parameters_SimulatorDefaultTypeInternal _Parameters_Simulator_default_instance_;
+class Parameters_SmallRadar;
+struct Parameters_SmallRadarDefaultTypeInternal;
+extern Parameters_SmallRadarDefaultTypeInternal _Parameters_SmallRadar_default_instance_;
+class Parameters_Visualizer;
+struct Parameters_VisualizerDefaultTypeInternal;
+extern Parameters_VisualizerDefaultTypeInternal _Parameters_Visualizer_default_instance_;
+}  // namespace Proto
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Proto::Parameters* Arena::CreateMaybeMessage<::Proto::Parameters>(Arena*);
+template<> ::Proto::Parameters_BigRadar* Arena::CreateMaybeMessage<::Proto::Parameters_BigRadar>(Arena*);
+template<> ::Proto::Parameters_Defense* Arena::CreateMaybeMessage<::Proto::Parameters_Defense>(Arena*);
+template<> ::Proto::Parameters_General* Arena::CreateMaybeMessage<::Proto::Parameters_General>(Arena*);
+template<> ::Proto::Parameters_Ship* Arena::CreateMaybeMessage<::Proto::Parameters_Ship>(Arena*);
+template<> ::Proto::Parameters_Ship_DeadZone* Arena::CreateMaybeMessage<::Proto::Parameters_Ship_DeadZone>(Arena*);
+template<> ::Proto::Parameters_Simulator* Arena::CreateMaybeMessage<::Proto::Parameters_Simulator>(Arena*);
+template<> ::Proto::Parameters_SmallRadar* Arena::CreateMaybeMessage<::Proto::Parameters_SmallRadar>(Arena*);
+template<> ::Proto::Parameters_Visualizer* Arena::CreateMaybeMessage<::Proto::Parameters_Visualizer>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Proto {
+
+enum Parameters_General_TargetSelection : int {
+  Parameters_General_TargetSelection_GREEDY = 0,
+  Parameters_General_TargetSelection_SWEEP_LINE_MAX_PRIORITY = 1,
+  Parameters_General_TargetSelection_SWEEP_LINE_MAX_COUNT = 2,
+  Parameters_General_TargetSelection_BEAM_SEARCH = 3
+};
+bool Parameters_General_TargetSelection_IsValid(int value);
+constexpr Parameters_General_TargetSelection Parameters_General_TargetSelection_TargetSelection_MIN = Parameters_General_TargetSelection_GREEDY;
+constexpr Parameters_General_TargetSelection Parameters_General_TargetSelection_TargetSelection_MAX = Parameters_General_TargetSelection_BEAM_SEARCH;
+constexpr int Parameters_General_TargetSelection_TargetSelection_ARRAYSIZE = Parameters_General_TargetSelection_TargetSelection_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Parameters_General_TargetSelection_descriptor();
+template<typename T>
+inline const std::string& Parameters_General_TargetSelection_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Parameters_General_TargetSelection>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Parameters_General_TargetSelection_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Parameters_General_TargetSelection_descriptor(), enum_t_value);
+}
+inline bool Parameters_General_TargetSelection_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Parameters_General_TargetSelection* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Parameters_General_TargetSelection>(
+    Parameters_General_TargetSelection_descriptor(), name, value);
+}
+enum Parameters_General_TrackFilter : int {
+  Parameters_General_TrackFilter_AB_FILTER = 0,
+  Parameters_General_TrackFilter_KALMAN = 1
+};
+bool Parameters_General_TrackFilter_IsValid(int value);
+constexpr Parameters_General_TrackFilter Parameters_General_TrackFilter_TrackFilter_MIN = Parameters_General_TrackFilter_AB_FILTER;
+constexpr Parameters_General_TrackFilter Parameters_General_TrackFilter_TrackFilter_MAX = Parameters_General_TrackFilter_KALMAN;
+constexpr int Parameters_General_TrackFilter_TrackFilter_ARRAYSIZE = Parameters_General_TrackFilter_TrackFilter_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Parameters_General_TrackFilter_descriptor();
+template<typename T>
+inline const std::string& Parameters_General_TrackFilter_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Parameters_General_TrackFilter>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Parameters_General_TrackFilter_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Parameters_General_TrackFilter_descriptor(), enum_t_value);
+}
+inline bool Parameters_General_TrackFilter_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Parameters_General_TrackFilter* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Parameters_General_TrackFilter>(
+    Parameters_General_TrackFilter_descriptor(), name, value);
+}
+// ===================================================================
+
+class Parameters_SmallRadar final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters.SmallRadar) */ {
+ public:
+  inline Parameters_SmallRadar() : Parameters_SmallRadar(nullptr) {}
+  ~Parameters_SmallRadar() override;
+  explicit PROTOBUF_CONSTEXPR Parameters_SmallRadar(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters_SmallRadar(const Parameters_SmallRadar& from);
+  Parameters_SmallRadar(Parameters_SmallRadar&& from) noexcept
+    : Parameters_SmallRadar() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters_SmallRadar& operator=(const Parameters_SmallRadar& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters_SmallRadar& operator=(Parameters_SmallRadar&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters_SmallRadar& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters_SmallRadar* internal_default_instance() {
+    return reinterpret_cast<const Parameters_SmallRadar*>(
+               &_Parameters_SmallRadar_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Parameters_SmallRadar& a, Parameters_SmallRadar& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters_SmallRadar* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters_SmallRadar* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters_SmallRadar* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters_SmallRadar>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters_SmallRadar& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters_SmallRadar& from) {
+    Parameters_SmallRadar::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters_SmallRadar* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters.SmallRadar";
+  }
+  protected:
+  explicit Parameters_SmallRadar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRadiusFieldNumber = 1,
+    kViewAngleFieldNumber = 2,
+    kFrequencyFieldNumber = 3,
+    kMaxEpsFieldNumber = 4,
+    kMaxAngleSpeedFieldNumber = 5,
+    kRadStddevFieldNumber = 6,
+    kAngStddevFieldNumber = 7,
+    kHStddevFieldNumber = 8,
+    kResponsibleSectorStartFieldNumber = 9,
+    kResponsibleSectorEndFieldNumber = 10,
+  };
+  // required double radius = 1;
+  bool has_radius() const;
+  private:
+  bool _internal_has_radius() const;
+  public:
+  void clear_radius();
+  double radius() const;
+  void set_radius(double value);
+  private:
+  double _internal_radius() const;
+  void _internal_set_radius(double value);
+  public:
+
+  // required double view_angle = 2;
+  bool has_view_angle() const;
+  private:
+  bool _internal_has_view_angle() const;
+  public:
+  void clear_view_angle();
+  double view_angle() const;
+  void set_view_angle(double value);
+  private:
+  double _internal_view_angle() const;
+  void _internal_set_view_angle(double value);
+  public:
+
+  // required double frequency = 3;
+  bool has_frequency() const;
+  private:
+  bool _internal_has_frequency() const;
+  public:
+  void clear_frequency();
+  double frequency() const;
+  void set_frequency(double value);
+  private:
+  double _internal_frequency() const;
+  void _internal_set_frequency(double value);
+  public:
+
+  // required double max_eps = 4;
+  bool has_max_eps() const;
+  private:
+  bool _internal_has_max_eps() const;
+  public:
+  void clear_max_eps();
+  double max_eps() const;
+  void set_max_eps(double value);
+  private:
+  double _internal_max_eps() const;
+  void _internal_set_max_eps(double value);
+  public:
+
+  // required double max_angle_speed = 5;
+  bool has_max_angle_speed() const;
+  private:
+  bool _internal_has_max_angle_speed() const;
+  public:
+  void clear_max_angle_speed();
+  double max_angle_speed() const;
+  void set_max_angle_speed(double value);
+  private:
+  double _internal_max_angle_speed() const;
+  void _internal_set_max_angle_speed(double value);
+  public:
+
+  // required double rad_stddev = 6;
+  bool has_rad_stddev() const;
+  private:
+  bool _internal_has_rad_stddev() const;
+  public:
+  void clear_rad_stddev();
+  double rad_stddev() const;
+  void set_rad_stddev(double value);
+  private:
+  double _internal_rad_stddev() const;
+  void _internal_set_rad_stddev(double value);
+  public:
+
+  // required double ang_stddev = 7;
+  bool has_ang_stddev() const;
+  private:
+  bool _internal_has_ang_stddev() const;
+  public:
+  void clear_ang_stddev();
+  double ang_stddev() const;
+  void set_ang_stddev(double value);
+  private:
+  double _internal_ang_stddev() const;
+  void _internal_set_ang_stddev(double value);
+  public:
+
+  // required double h_stddev = 8;
+  bool has_h_stddev() const;
+  private:
+  bool _internal_has_h_stddev() const;
+  public:
+  void clear_h_stddev();
+  double h_stddev() const;
+  void set_h_stddev(double value);
+  private:
+  double _internal_h_stddev() const;
+  void _internal_set_h_stddev(double value);
+  public:
+
+  // required double responsible_sector_start = 9;
+  bool has_responsible_sector_start() const;
+  private:
+  bool _internal_has_responsible_sector_start() const;
+  public:
+  void clear_responsible_sector_start();
+  double responsible_sector_start() const;
+  void set_responsible_sector_start(double value);
+  private:
+  double _internal_responsible_sector_start() const;
+  void _internal_set_responsible_sector_start(double value);
+  public:
+
+  // required double responsible_sector_end = 10;
+  bool has_responsible_sector_end() const;
+  private:
+  bool _internal_has_responsible_sector_end() const;
+  public:
+  void clear_responsible_sector_end();
+  double responsible_sector_end() const;
+  void set_responsible_sector_end(double value);
+  private:
+  double _internal_responsible_sector_end() const;
+  void _internal_set_responsible_sector_end(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters.SmallRadar)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double radius_;
+    double view_angle_;
+    double frequency_;
+    double max_eps_;
+    double max_angle_speed_;
+    double rad_stddev_;
+    double ang_stddev_;
+    double h_stddev_;
+    double responsible_sector_start_;
+    double responsible_sector_end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Parameters_BigRadar final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters.BigRadar) */ {
+ public:
+  inline Parameters_BigRadar() : Parameters_BigRadar(nullptr) {}
+  ~Parameters_BigRadar() override;
+  explicit PROTOBUF_CONSTEXPR Parameters_BigRadar(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters_BigRadar(const Parameters_BigRadar& from);
+  Parameters_BigRadar(Parameters_BigRadar&& from) noexcept
+    : Parameters_BigRadar() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters_BigRadar& operator=(const Parameters_BigRadar& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters_BigRadar& operator=(Parameters_BigRadar&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters_BigRadar& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters_BigRadar* internal_default_instance() {
+    return reinterpret_cast<const Parameters_BigRadar*>(
+               &_Parameters_BigRadar_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Parameters_BigRadar& a, Parameters_BigRadar& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters_BigRadar* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters_BigRadar* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters_BigRadar* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters_BigRadar>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters_BigRadar& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters_BigRadar& from) {
+    Parameters_BigRadar::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters_BigRadar* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters.BigRadar";
+  }
+  protected:
+  explicit Parameters_BigRadar(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRadiusFieldNumber = 1,
+    kFrequencyFieldNumber = 2,
+    kRadStddevFieldNumber = 3,
+    kAngStddevFieldNumber = 4,
+    kHStddevFieldNumber = 5,
+  };
+  // required double radius = 1;
+  bool has_radius() const;
+  private:
+  bool _internal_has_radius() const;
+  public:
+  void clear_radius();
+  double radius() const;
+  void set_radius(double value);
+  private:
+  double _internal_radius() const;
+  void _internal_set_radius(double value);
+  public:
+
+  // required double frequency = 2;
+  bool has_frequency() const;
+  private:
+  bool _internal_has_frequency() const;
+  public:
+  void clear_frequency();
+  double frequency() const;
+  void set_frequency(double value);
+  private:
+  double _internal_frequency() const;
+  void _internal_set_frequency(double value);
+  public:
+
+  // required double rad_stddev = 3;
+  bool has_rad_stddev() const;
+  private:
+  bool _internal_has_rad_stddev() const;
+  public:
+  void clear_rad_stddev();
+  double rad_stddev() const;
+  void set_rad_stddev(double value);
+  private:
+  double _internal_rad_stddev() const;
+  void _internal_set_rad_stddev(double value);
+  public:
+
+  // required double ang_stddev = 4;
+  bool has_ang_stddev() const;
+  private:
+  bool _internal_has_ang_stddev() const;
+  public:
+  void clear_ang_stddev();
+  double ang_stddev() const;
+  void set_ang_stddev(double value);
+  private:
+  double _internal_ang_stddev() const;
+  void _internal_set_ang_stddev(double value);
+  public:
+
+  // required double h_stddev = 5;
+  bool has_h_stddev() const;
+  private:
+  bool _internal_has_h_stddev() const;
+  public:
+  void clear_h_stddev();
+  double h_stddev() const;
+  void set_h_stddev(double value);
+  private:
+  double _internal_h_stddev() const;
+  void _internal_set_h_stddev(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters.BigRadar)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double radius_;
+    double frequency_;
+    double rad_stddev_;
+    double ang_stddev_;
+    double h_stddev_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Parameters_Ship_DeadZone final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters.Ship.DeadZone) */ {
+ public:
+  inline Parameters_Ship_DeadZone() : Parameters_Ship_DeadZone(nullptr) {}
+  ~Parameters_Ship_DeadZone() override;
+  explicit PROTOBUF_CONSTEXPR Parameters_Ship_DeadZone(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters_Ship_DeadZone(const Parameters_Ship_DeadZone& from);
+  Parameters_Ship_DeadZone(Parameters_Ship_DeadZone&& from) noexcept
+    : Parameters_Ship_DeadZone() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters_Ship_DeadZone& operator=(const Parameters_Ship_DeadZone& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters_Ship_DeadZone& operator=(Parameters_Ship_DeadZone&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters_Ship_DeadZone& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters_Ship_DeadZone* internal_default_instance() {
+    return reinterpret_cast<const Parameters_Ship_DeadZone*>(
+               &_Parameters_Ship_DeadZone_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Parameters_Ship_DeadZone& a, Parameters_Ship_DeadZone& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters_Ship_DeadZone* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters_Ship_DeadZone* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters_Ship_DeadZone* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters_Ship_DeadZone>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters_Ship_DeadZone& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters_Ship_DeadZone& from) {
+    Parameters_Ship_DeadZone::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters_Ship_DeadZone* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters.Ship.DeadZone";
+  }
+  protected:
+  explicit Parameters_Ship_DeadZone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartFieldNumber = 1,
+    kEndFieldNumber = 2,
+  };
+  // required double start = 1;
+  bool has_start() const;
+  private:
+  bool _internal_has_start() const;
+  public:
+  void clear_start();
+  double start() const;
+  void set_start(double value);
+  private:
+  double _internal_start() const;
+  void _internal_set_start(double value);
+  public:
+
+  // required double end = 2;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  double end() const;
+  void set_end(double value);
+  private:
+  double _internal_end() const;
+  void _internal_set_end(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters.Ship.DeadZone)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double start_;
+    double end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Parameters_Ship final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters.Ship) */ {
+ public:
+  inline Parameters_Ship() : Parameters_Ship(nullptr) {}
+  ~Parameters_Ship() override;
+  explicit PROTOBUF_CONSTEXPR Parameters_Ship(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters_Ship(const Parameters_Ship& from);
+  Parameters_Ship(Parameters_Ship&& from) noexcept
+    : Parameters_Ship() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters_Ship& operator=(const Parameters_Ship& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters_Ship& operator=(Parameters_Ship&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters_Ship& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters_Ship* internal_default_instance() {
+    return reinterpret_cast<const Parameters_Ship*>(
+               &_Parameters_Ship_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Parameters_Ship& a, Parameters_Ship& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters_Ship* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters_Ship* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters_Ship* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters_Ship>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters_Ship& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters_Ship& from) {
+    Parameters_Ship::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters_Ship* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters.Ship";
+  }
+  protected:
+  explicit Parameters_Ship(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Parameters_Ship_DeadZone DeadZone;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeadZonesFieldNumber = 3,
+    kMaxEpsFieldNumber = 1,
+    kMaxAngleSpeedFieldNumber = 2,
+  };
+  // repeated .Proto.Parameters.Ship.DeadZone dead_zones = 3;
+  int dead_zones_size() const;
+  private:
+  int _internal_dead_zones_size() const;
+  public:
+  void clear_dead_zones();
+  ::Proto::Parameters_Ship_DeadZone* mutable_dead_zones(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_Ship_DeadZone >*
+      mutable_dead_zones();
+  private:
+  const ::Proto::Parameters_Ship_DeadZone& _internal_dead_zones(int index) const;
+  ::Proto::Parameters_Ship_DeadZone* _internal_add_dead_zones();
+  public:
+  const ::Proto::Parameters_Ship_DeadZone& dead_zones(int index) const;
+  ::Proto::Parameters_Ship_DeadZone* add_dead_zones();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_Ship_DeadZone >&
+      dead_zones() const;
+
+  // required double max_eps = 1;
+  bool has_max_eps() const;
+  private:
+  bool _internal_has_max_eps() const;
+  public:
+  void clear_max_eps();
+  double max_eps() const;
+  void set_max_eps(double value);
+  private:
+  double _internal_max_eps() const;
+  void _internal_set_max_eps(double value);
+  public:
+
+  // required double max_angle_speed = 2;
+  bool has_max_angle_speed() const;
+  private:
+  bool _internal_has_max_angle_speed() const;
+  public:
+  void clear_max_angle_speed();
+  double max_angle_speed() const;
+  void set_max_angle_speed(double value);
+  private:
+  double _internal_max_angle_speed() const;
+  void _internal_set_max_angle_speed(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters.Ship)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_Ship_DeadZone > dead_zones_;
+    double max_eps_;
+    double max_angle_speed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Parameters_General final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters.General) */ {
+ public:
+  inline Parameters_General() : Parameters_General(nullptr) {}
+  ~Parameters_General() override;
+  explicit PROTOBUF_CONSTEXPR Parameters_General(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters_General(const Parameters_General& from);
+  Parameters_General(Parameters_General&& from) noexcept
+    : Parameters_General() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters_General& operator=(const Parameters_General& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters_General& operator=(Parameters_General&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters_General& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters_General* internal_default_instance() {
+    return reinterpret_cast<const Parameters_General*>(
+               &_Parameters_General_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Parameters_General& a, Parameters_General& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters_General* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters_General* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters_General* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters_General>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters_General& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters_General& from) {
+    Parameters_General::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters_General* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters.General";
+  }
+  protected:
+  explicit Parameters_General(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Parameters_General_TargetSelection TargetSelection;
+  static constexpr TargetSelection GREEDY =
+    Parameters_General_TargetSelection_GREEDY;
+  static constexpr TargetSelection SWEEP_LINE_MAX_PRIORITY =
+    Parameters_General_TargetSelection_SWEEP_LINE_MAX_PRIORITY;
+  static constexpr TargetSelection SWEEP_LINE_MAX_COUNT =
+    Parameters_General_TargetSelection_SWEEP_LINE_MAX_COUNT;
+  static constexpr TargetSelection BEAM_SEARCH =
+    Parameters_General_TargetSelection_BEAM_SEARCH;
+  static inline bool TargetSelection_IsValid(int value) {
+    return Parameters_General_TargetSelection_IsValid(value);
+  }
+  static constexpr TargetSelection TargetSelection_MIN =
+    Parameters_General_TargetSelection_TargetSelection_MIN;
+  static constexpr TargetSelection TargetSelection_MAX =
+    Parameters_General_TargetSelection_TargetSelection_MAX;
+  static constexpr int TargetSelection_ARRAYSIZE =
+    Parameters_General_TargetSelection_TargetSelection_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  TargetSelection_descriptor() {
+    return Parameters_General_TargetSelection_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& TargetSelection_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, TargetSelection>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function TargetSelection_Name.");
+    return Parameters_General_TargetSelection_Name(enum_t_value);
+  }
+  static inline bool TargetSelection_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      TargetSelection* value) {
+    return Parameters_General_TargetSelection_Parse(name, value);
+  }
+
+  typedef Parameters_General_TrackFilter TrackFilter;
+  static constexpr TrackFilter AB_FILTER =
+    Parameters_General_TrackFilter_AB_FILTER;
+  static constexpr TrackFilter KALMAN =
+    Parameters_General_TrackFilter_KALMAN;
+  static inline bool TrackFilter_IsValid(int value) {
+    return Parameters_General_TrackFilter_IsValid(value);
+  }
+  static constexpr TrackFilter TrackFilter_MIN =
+    Parameters_General_TrackFilter_TrackFilter_MIN;
+  static constexpr TrackFilter TrackFilter_MAX =
+    Parameters_General_TrackFilter_TrackFilter_MAX;
+  static constexpr int TrackFilter_ARRAYSIZE =
+    Parameters_General_TrackFilter_TrackFilter_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  TrackFilter_descriptor() {
+    return Parameters_General_TrackFilter_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& TrackFilter_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, TrackFilter>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function TrackFilter_Name.");
+    return Parameters_General_TrackFilter_Name(enum_t_value);
+  }
+  static inline bool TrackFilter_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      TrackFilter* value) {
+    return Parameters_General_TrackFilter_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProcessBudgetShareFieldNumber = 9,
+    kGeometryPosToleranceFieldNumber = 12,
+    kTargetSelectionFieldNumber = 10,
+    kTrackFilterFieldNumber = 14,
+    kGeometrySpeedToleranceFieldNumber = 13,
+    kSchedulerPinThreadsFieldNumber = 27,
+    kSchedulerThreadsFieldNumber = 26,
+    kDeathTimeFieldNumber = 1,
+    kPlaySpeedFieldNumber = 2,
+    kBigRadarMeasureCntFieldNumber = 3,
+    kSmallRadarMeasureCntFieldNumber = 4,
+    kAproxSmallRadarMeasureCntFieldNumber = 5,
+    kMarginAngleFieldNumber = 6,
+    kMarginTimeFieldNumber = 7,
+    kKinematicsStepFieldNumber = 8,
+    kRotationCacheStepFieldNumber = 11,
+    kKalmanMeasurementStddevFieldNumber = 15,
+    kKalmanAccelerationStddevFieldNumber = 16,
+    kKalmanPreciseSpeedStddevFieldNumber = 17,
+    kPlannerHorizonFieldNumber = 19,
+    kTickArenaSizeFieldNumber = 18,
+    kPlannerBeamWidthFieldNumber = 20,
+    kAssociationGateFieldNumber = 23,
+    kPlannerMaxDepthFieldNumber = 21,
+    kGeometryParallelThresholdFieldNumber = 25,
+  };
+  // optional double process_budget_share = 9 [default = 0];
+  bool has_process_budget_share() const;
+  private:
+  bool _internal_has_process_budget_share() const;
+  public:
+  void clear_process_budget_share();
+  double process_budget_share() const;
+  void set_process_budget_share(double value);
+  private:
+  double _internal_process_budget_share() const;
+  void _internal_set_process_budget_share(double value);
+  public:
+
+  // optional double geometry_pos_tolerance = 12 [default = 0];
+  bool has_geometry_pos_tolerance() const;
+  private:
+  bool _internal_has_geometry_pos_tolerance() const;
+  public:
+  void clear_geometry_pos_tolerance();
+  double geometry_pos_tolerance() const;
+  void set_geometry_pos_tolerance(double value);
+  private:
+  double _internal_geometry_pos_tolerance() const;
+  void _internal_set_geometry_pos_tolerance(double value);
+  public:
+
+  // optional .Proto.Parameters.General.TargetSelection target_selection = 10 [default = GREEDY];
+  bool has_target_selection() const;
+  private:
+  bool _internal_has_target_selection() const;
+  public:
+  void clear_target_selection();
+  ::Proto::Parameters_General_TargetSelection target_selection() const;
+  void set_target_selection(::Proto::Parameters_General_TargetSelection value);
+  private:
+  ::Proto::Parameters_General_TargetSelection _internal_target_selection() const;
+  void _internal_set_target_selection(::Proto::Parameters_General_TargetSelection value);
+  public:
+
+  // optional .Proto.Parameters.General.TrackFilter track_filter = 14 [default = AB_FILTER];
+  bool has_track_filter() const;
+  private:
+  bool _internal_has_track_filter() const;
+  public:
+  void clear_track_filter();
+  ::Proto::Parameters_General_TrackFilter track_filter() const;
+  void set_track_filter(::Proto::Parameters_General_TrackFilter value);
+  private:
+  ::Proto::Parameters_General_TrackFilter _internal_track_filter() const;
+  void _internal_set_track_filter(::Proto::Parameters_General_TrackFilter value);
+  public:
+
+  // optional double geometry_speed_tolerance = 13 [default = 0];
+  bool has_geometry_speed_tolerance() const;
+  private:
+  bool _internal_has_geometry_speed_tolerance() const;
+  public:
+  void clear_geometry_speed_tolerance();
+  double geometry_speed_tolerance() const;
+  void set_geometry_speed_tolerance(double value);
+  private:
+  double _internal_geometry_speed_tolerance() const;
+  void _internal_set_geometry_speed_tolerance(double value);
+  public:
+
+  // optional bool scheduler_pin_threads = 27 [default = false];
+  bool has_scheduler_pin_threads() const;
+  private:
+  bool _internal_has_scheduler_pin_threads() const;
+  public:
+  void clear_scheduler_pin_threads();
+  bool scheduler_pin_threads() const;
+  void set_scheduler_pin_threads(bool value);
+  private:
+  bool _internal_scheduler_pin_threads() const;
+  void _internal_set_scheduler_pin_threads(bool value);
+  public:
+
+  // optional int32 scheduler_threads = 26 [default = 1];
+  bool has_scheduler_threads() const;
+  private:
+  bool _internal_has_scheduler_threads() const;
+  public:
+  void clear_scheduler_threads();
+  int32_t scheduler_threads() const;
+  void set_scheduler_threads(int32_t value);
+  private:
+  int32_t _internal_scheduler_threads() const;
+  void _internal_set_scheduler_threads(int32_t value);
+  public:
+
+  // optional double death_time = 1 [default = 5000];
+  bool has_death_time() const;
+  private:
+  bool _internal_has_death_time() const;
+  public:
+  void clear_death_time();
+  double death_time() const;
+  void set_death_time(double value);
+  private:
+  double _internal_death_time() const;
+  void _internal_set_death_time(double value);
+  public:
+
+  // optional double play_speed = 2 [default = 1];
+  bool has_play_speed() const;
+  private:
+  bool _internal_has_play_speed() const;
+  public:
+  void clear_play_speed();
+  double play_speed() const;
+  void set_play_speed(double value);
+  private:
+  double _internal_play_speed() const;
+  void _internal_set_play_speed(double value);
+  public:
+
+  // optional double big_radar_measure_cnt = 3 [default = 30];
+  bool has_big_radar_measure_cnt() const;
+  private:
+  bool _internal_has_big_radar_measure_cnt() const;
+  public:
+  void clear_big_radar_measure_cnt();
+  double big_radar_measure_cnt() const;
+  void set_big_radar_measure_cnt(double value);
+  private:
+  double _internal_big_radar_measure_cnt() const;
+  void _internal_set_big_radar_measure_cnt(double value);
+  public:
+
+  // optional double small_radar_measure_cnt = 4 [default = 40];
+  bool has_small_radar_measure_cnt() const;
+  private:
+  bool _internal_has_small_radar_measure_cnt() const;
+  public:
+  void clear_small_radar_measure_cnt();
+  double small_radar_measure_cnt() const;
+  void set_small_radar_measure_cnt(double value);
+  private:
+  double _internal_small_radar_measure_cnt() const;
+  void _internal_set_small_radar_measure_cnt(double value);
+  public:
+
+  // optional double aprox_small_radar_measure_cnt = 5 [default = 10];
+  bool has_aprox_small_radar_measure_cnt() const;
+  private:
+  bool _internal_has_aprox_small_radar_measure_cnt() const;
+  public:
+  void clear_aprox_small_radar_measure_cnt();
+  double aprox_small_radar_measure_cnt() const;
+  void set_aprox_small_radar_measure_cnt(double value);
+  private:
+  double _internal_aprox_small_radar_measure_cnt() const;
+  void _internal_set_aprox_small_radar_measure_cnt(double value);
+  public:
+
+  // optional double margin_angle = 6 [default = 5];
+  bool has_margin_angle() const;
+  private:
+  bool _internal_has_margin_angle() const;
+  public:
+  void clear_margin_angle();
+  double margin_angle() const;
+  void set_margin_angle(double value);
+  private:
+  double _internal_margin_angle() const;
+  void _internal_set_margin_angle(double value);
+  public:
+
+  // optional double margin_time = 7 [default = 3000];
+  bool has_margin_time() const;
+  private:
+  bool _internal_has_margin_time() const;
+  public:
+  void clear_margin_time();
+  double margin_time() const;
+  void set_margin_time(double value);
+  private:
+  double _internal_margin_time() const;
+  void _internal_set_margin_time(double value);
+  public:
+
+  // optional double kinematics_step = 8 [default = 5];
+  bool has_kinematics_step() const;
+  private:
+  bool _internal_has_kinematics_step() const;
+  public:
+  void clear_kinematics_step();
+  double kinematics_step() const;
+  void set_kinematics_step(double value);
+  private:
+  double _internal_kinematics_step() const;
+  void _internal_set_kinematics_step(double value);
+  public:
+
+  // optional double rotation_cache_step = 11 [default = 0.1];
+  bool has_rotation_cache_step() const;
+  private:
+  bool _internal_has_rotation_cache_step() const;
+  public:
+  void clear_rotation_cache_step();
+  double rotation_cache_step() const;
+  void set_rotation_cache_step(double value);
+  private:
+  double _internal_rotation_cache_step() const;
+  void _internal_set_rotation_cache_step(double value);
+  public:
+
+  // optional double kalman_measurement_stddev = 15 [default = 0.3];
+  bool has_kalman_measurement_stddev() const;
+  private:
+  bool _internal_has_kalman_measurement_stddev() const;
+  public:
+  void clear_kalman_measurement_stddev();
+  double kalman_measurement_stddev() const;
+  void set_kalman_measurement_stddev(double value);
+  private:
+  double _internal_kalman_measurement_stddev() const;
+  void _internal_set_kalman_measurement_stddev(double value);
+  public:
+
+  // optional double kalman_acceleration_stddev = 16 [default = 0.01];
+  bool has_kalman_acceleration_stddev() const;
+  private:
+  bool _internal_has_kalman_acceleration_stddev() const;
+  public:
+  void clear_kalman_acceleration_stddev();
+  double kalman_acceleration_stddev() const;
+  void set_kalman_acceleration_stddev(double value);
+  private:
+  double _internal_kalman_acceleration_stddev() const;
+  void _internal_set_kalman_acceleration_stddev(double value);
+  public:
+
+  // optional double kalman_precise_speed_stddev = 17 [default = 0.05];
+  bool has_kalman_precise_speed_stddev() const;
+  private:
+  bool _internal_has_kalman_precise_speed_stddev() const;
+  public:
+  void clear_kalman_precise_speed_stddev();
+  double kalman_precise_speed_stddev() const;
+  void set_kalman_precise_speed_stddev(double value);
+  private:
+  double _internal_kalman_precise_speed_stddev() const;
+  void _internal_set_kalman_precise_speed_stddev(double value);
+  public:
+
+  // optional double planner_horizon = 19 [default = 10000];
+  bool has_planner_horizon() const;
+  private:
+  bool _internal_has_planner_horizon() const;
+  public:
+  void clear_planner_horizon();
+  double planner_horizon() const;
+  void set_planner_horizon(double value);
+  private:
+  double _internal_planner_horizon() const;
+  void _internal_set_planner_horizon(double value);
+  public:
+
+  // optional int32 tick_arena_size = 18 [default = 262144];
+  bool has_tick_arena_size() const;
+  private:
+  bool _internal_has_tick_arena_size() const;
+  public:
+  void clear_tick_arena_size();
+  int32_t tick_arena_size() const;
+  void set_tick_arena_size(int32_t value);
+  private:
+  int32_t _internal_tick_arena_size() const;
+  void _internal_set_tick_arena_size(int32_t value);
+  public:
+
+  // optional int32 planner_beam_width = 20 [default = 8];
+  bool has_planner_beam_width() const;
+  private:
+  bool _internal_has_planner_beam_width() const;
+  public:
+  void clear_planner_beam_width();
+  int32_t planner_beam_width() const;
+  void set_planner_beam_width(int32_t value);
+  private:
+  int32_t _internal_planner_beam_width() const;
+  void _internal_set_planner_beam_width(int32_t value);
+  public:
+
+  // optional double association_gate = 23 [default = 10];
+  bool has_association_gate() const;
+  private:
+  bool _internal_has_association_gate() const;
+  public:
+  void clear_association_gate();
+  double association_gate() const;
+  void set_association_gate(double value);
+  private:
+  double _internal_association_gate() const;
+  void _internal_set_association_gate(double value);
+  public:
+
+  // optional int32 planner_max_depth = 21 [default = 3];
+  bool has_planner_max_depth() const;
+  private:
+  bool _internal_has_planner_max_depth() const;
+  public:
+  void clear_planner_max_depth();
+  int32_t planner_max_depth() const;
+  void set_planner_max_depth(int32_t value);
+  private:
+  int32_t _internal_planner_max_depth() const;
+  void _internal_set_planner_max_depth(int32_t value);
+  public:
+
+  // optional int32 geometry_parallel_threshold = 25 [default = 64];
+  bool has_geometry_parallel_threshold() const;
+  private:
+  bool _internal_has_geometry_parallel_threshold() const;
+  public:
+  void clear_geometry_parallel_threshold();
+  int32_t geometry_parallel_threshold() const;
+  void set_geometry_parallel_threshold(int32_t value);
+  private:
+  int32_t _internal_geometry_parallel_threshold() const;
+  void _internal_set_geometry_parallel_threshold(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters.General)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double process_budget_share_;
+    double geometry_pos_tolerance_;
+    int target_selection_;
+    int track_filter_;
+    double geometry_speed_tolerance_;
+    bool scheduler_pin_threads_;
+    int32_t scheduler_threads_;
+    double death_time_;
+    double play_speed_;
+    double big_radar_measure_cnt_;
+    double small_radar_measure_cnt_;
+    double aprox_small_radar_measure_cnt_;
+    double margin_angle_;
+    double margin_time_;
+    double kinematics_step_;
+    double rotation_cache_step_;
+    double kalman_measurement_stddev_;
+    double kalman_acceleration_stddev_;
+    double kalman_precise_speed_stddev_;
+    double planner_horizon_;
+    int32_t tick_arena_size_;
+    int32_t planner_beam_width_;
+    double association_gate_;
+    int32_t planner_max_depth_;
+    int32_t geometry_parallel_threshold_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Parameters_Defense final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters.Defense) */ {
+ public:
+  inline Parameters_Defense() : Parameters_Defense(nullptr) {}
+  ~Parameters_Defense() override;
+  explicit PROTOBUF_CONSTEXPR Parameters_Defense(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters_Defense(const Parameters_Defense& from);
+  Parameters_Defense(Parameters_Defense&& from) noexcept
+    : Parameters_Defense() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters_Defense& operator=(const Parameters_Defense& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters_Defense& operator=(Parameters_Defense&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters_Defense& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters_Defense* internal_default_instance() {
+    return reinterpret_cast<const Parameters_Defense*>(
+               &_Parameters_Defense_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Parameters_Defense& a, Parameters_Defense& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters_Defense* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters_Defense* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters_Defense* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters_Defense>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters_Defense& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters_Defense& from) {
+    Parameters_Defense::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters_Defense* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters.Defense";
+  }
+  protected:
+  explicit Parameters_Defense(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLaunchersCountFieldNumber = 3,
+    kMagazineSizeFieldNumber = 5,
+    kPlannedLaunchesPerLauncherFieldNumber = 6,
+    kTimeToLaunchRocketFieldNumber = 1,
+    kRocketSpeedFieldNumber = 2,
+    kReloadTimeFieldNumber = 4,
+    kKillRadiusFieldNumber = 7,
+  };
+  // optional uint32 launchers_count = 3;
+  bool has_launchers_count() const;
+  private:
+  bool _internal_has_launchers_count() const;
+  public:
+  void clear_launchers_count();
+  uint32_t launchers_count() const;
+  void set_launchers_count(uint32_t value);
+  private:
+  uint32_t _internal_launchers_count() const;
+  void _internal_set_launchers_count(uint32_t value);
+  public:
+
+  // optional uint32 magazine_size = 5 [default = 0];
+  bool has_magazine_size() const;
+  private:
+  bool _internal_has_magazine_size() const;
+  public:
+  void clear_magazine_size();
+  uint32_t magazine_size() const;
+  void set_magazine_size(uint32_t value);
+  private:
+  uint32_t _internal_magazine_size() const;
+  void _internal_set_magazine_size(uint32_t value);
+  public:
+
+  // optional uint32 planned_launches_per_launcher = 6 [default = 3];
+  bool has_planned_launches_per_launcher() const;
+  private:
+  bool _internal_has_planned_launches_per_launcher() const;
+  public:
+  void clear_planned_launches_per_launcher();
+  uint32_t planned_launches_per_launcher() const;
+  void set_planned_launches_per_launcher(uint32_t value);
+  private:
+  uint32_t _internal_planned_launches_per_launcher() const;
+  void _internal_set_planned_launches_per_launcher(uint32_t value);
+  public:
+
+  // optional double time_to_launch_rocket = 1 [default = 3000];
+  bool has_time_to_launch_rocket() const;
+  private:
+  bool _internal_has_time_to_launch_rocket() const;
+  public:
+  void clear_time_to_launch_rocket();
+  double time_to_launch_rocket() const;
+  void set_time_to_launch_rocket(double value);
+  private:
+  double _internal_time_to_launch_rocket() const;
+  void _internal_set_time_to_launch_rocket(double value);
+  public:
+
+  // optional double rocket_speed = 2 [default = 5];
+  bool has_rocket_speed() const;
+  private:
+  bool _internal_has_rocket_speed() const;
+  public:
+  void clear_rocket_speed();
+  double rocket_speed() const;
+  void set_rocket_speed(double value);
+  private:
+  double _internal_rocket_speed() const;
+  void _internal_set_rocket_speed(double value);
+  public:
+
+  // optional double reload_time = 4 [default = 5000];
+  bool has_reload_time() const;
+  private:
+  bool _internal_has_reload_time() const;
+  public:
+  void clear_reload_time();
+  double reload_time() const;
+  void set_reload_time(double value);
+  private:
+  double _internal_reload_time() const;
+  void _internal_set_reload_time(double value);
+  public:
+
+  // optional double kill_radius = 7 [default = 10];
+  bool has_kill_radius() const;
+  private:
+  bool _internal_has_kill_radius() const;
+  public:
+  void clear_kill_radius();
+  double kill_radius() const;
+  void set_kill_radius(double value);
+  private:
+  double _internal_kill_radius() const;
+  void _internal_set_kill_radius(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters.Defense)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t launchers_count_;
+    uint32_t magazine_size_;
+    uint32_t planned_launches_per_launcher_;
+    double time_to_launch_rocket_;
+    double rocket_speed_;
+    double reload_time_;
+    double kill_radius_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Parameters_Simulator final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters.Simulator) */ {
+ public:
+  inline Parameters_Simulator() : Parameters_Simulator(nullptr) {}
+  ~Parameters_Simulator() override;
+  explicit PROTOBUF_CONSTEXPR Parameters_Simulator(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters_Simulator(const Parameters_Simulator& from);
+  Parameters_Simulator(Parameters_Simulator&& from) noexcept
+    : Parameters_Simulator() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters_Simulator& operator=(const Parameters_Simulator& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters_Simulator& operator=(Parameters_Simulator&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters_Simulator& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters_Simulator* internal_default_instance() {
+    return reinterpret_cast<const Parameters_Simulator*>(
+               &_Parameters_Simulator_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Parameters_Simulator& a, Parameters_Simulator& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters_Simulator* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters_Simulator* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters_Simulator* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters_Simulator>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters_Simulator& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters_Simulator& from) {
+    Parameters_Simulator::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters_Simulator* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters.Simulator";
+  }
+  protected:
+  explicit Parameters_Simulator(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMaxHeightFieldNumber = 4,
+    kRandomSeedFieldNumber = 7,
+    kStripIdsFieldNumber = 8,
+    kTargetsPerMinuteFieldNumber = 1,
+    kMinTargetSpeedFieldNumber = 2,
+    kMaxTargetSpeedFieldNumber = 3,
+    kMaxDeviationAngleVerticalFieldNumber = 5,
+    kProbabilityOfAccurateMissileFieldNumber = 6,
+  };
+  // required double max_height = 4;
+  bool has_max_height() const;
+  private:
+  bool _internal_has_max_height() const;
+  public:
+  void clear_max_height();
+  double max_height() const;
+  void set_max_height(double value);
+  private:
+  double _internal_max_height() const;
+  void _internal_set_max_height(double value);
+  public:
+
+  // optional uint32 random_seed = 7;
+  bool has_random_seed() const;
+  private:
+  bool _internal_has_random_seed() const;
+  public:
+  void clear_random_seed();
+  uint32_t random_seed() const;
+  void set_random_seed(uint32_t value);
+  private:
+  uint32_t _internal_random_seed() const;
+  void _internal_set_random_seed(uint32_t value);
+  public:
+
+  // optional bool strip_ids = 8 [default = false];
+  bool has_strip_ids() const;
+  private:
+  bool _internal_has_strip_ids() const;
+  public:
+  void clear_strip_ids();
+  bool strip_ids() const;
+  void set_strip_ids(bool value);
+  private:
+  bool _internal_strip_ids() const;
+  void _internal_set_strip_ids(bool value);
+  public:
+
+  // optional uint32 targets_per_minute = 1 [default = 3];
+  bool has_targets_per_minute() const;
+  private:
+  bool _internal_has_targets_per_minute() const;
+  public:
+  void clear_targets_per_minute();
+  uint32_t targets_per_minute() const;
+  void set_targets_per_minute(uint32_t value);
+  private:
+  uint32_t _internal_targets_per_minute() const;
+  void _internal_set_targets_per_minute(uint32_t value);
+  public:
+
+  // optional double min_target_speed = 2 [default = 1];
+  bool has_min_target_speed() const;
+  private:
+  bool _internal_has_min_target_speed() const;
+  public:
+  void clear_min_target_speed();
+  double min_target_speed() const;
+  void set_min_target_speed(double value);
+  private:
+  double _internal_min_target_speed() const;
+  void _internal_set_min_target_speed(double value);
+  public:
+
+  // optional double max_target_speed = 3 [default = 2];
+  bool has_max_target_speed() const;
+  private:
+  bool _internal_has_max_target_speed() const;
+  public:
+  void clear_max_target_speed();
+  double max_target_speed() const;
+  void set_max_target_speed(double value);
+  private:
+  double _internal_max_target_speed() const;
+  void _internal_set_max_target_speed(double value);
+  public:
+
+  // optional double max_deviation_angle_vertical = 5 [default = 15];
+  bool has_max_deviation_angle_vertical() const;
+  private:
+  bool _internal_has_max_deviation_angle_vertical() const;
+  public:
+  void clear_max_deviation_angle_vertical();
+  double max_deviation_angle_vertical() const;
+  void set_max_deviation_angle_vertical(double value);
+  private:
+  double _internal_max_deviation_angle_vertical() const;
+  void _internal_set_max_deviation_angle_vertical(double value);
+  public:
+
+  // optional double probability_of_accurate_missile = 6 [default = 0.4];
+  bool has_probability_of_accurate_missile() const;
+  private:
+  bool _internal_has_probability_of_accurate_missile() const;
+  public:
+  void clear_probability_of_accurate_missile();
+  double probability_of_accurate_missile() const;
+  void set_probability_of_accurate_missile(double value);
+  private:
+  double _internal_probability_of_accurate_missile() const;
+  void _internal_set_probability_of_accurate_missile(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters.Simulator)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double max_height_;
+    uint32_t random_seed_;
+    bool strip_ids_;
+    uint32_t targets_per_minute_;
+    double min_target_speed_;
+    double max_target_speed_;
+    double max_deviation_angle_vertical_;
+    double probability_of_accurate_missile_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Parameters_Visualizer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters.Visualizer) */ {
+ public:
+  inline Parameters_Visualizer() : Parameters_Visualizer(nullptr) {}
+  ~Parameters_Visualizer() override;
+  explicit PROTOBUF_CONSTEXPR Parameters_Visualizer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters_Visualizer(const Parameters_Visualizer& from);
+  Parameters_Visualizer(Parameters_Visualizer&& from) noexcept
+    : Parameters_Visualizer() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters_Visualizer& operator=(const Parameters_Visualizer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters_Visualizer& operator=(Parameters_Visualizer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters_Visualizer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters_Visualizer* internal_default_instance() {
+    return reinterpret_cast<const Parameters_Visualizer*>(
+               &_Parameters_Visualizer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Parameters_Visualizer& a, Parameters_Visualizer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters_Visualizer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters_Visualizer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters_Visualizer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters_Visualizer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters_Visualizer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters_Visualizer& from) {
+    Parameters_Visualizer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters_Visualizer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters.Visualizer";
+  }
+  protected:
+  explicit Parameters_Visualizer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDrawEntryPointsFieldNumber = 3,
+    kFpsFieldNumber = 4,
+    kRadarsOutlineThicknessFieldNumber = 1,
+    kTargetRadiusFieldNumber = 2,
+  };
+  // optional bool draw_entry_points = 3 [default = false];
+  bool has_draw_entry_points() const;
+  private:
+  bool _internal_has_draw_entry_points() const;
+  public:
+  void clear_draw_entry_points();
+  bool draw_entry_points() const;
+  void set_draw_entry_points(bool value);
+  private:
+  bool _internal_draw_entry_points() const;
+  void _internal_set_draw_entry_points(bool value);
+  public:
+
+  // optional uint32 fps = 4 [default = 60];
+  bool has_fps() const;
+  private:
+  bool _internal_has_fps() const;
+  public:
+  void clear_fps();
+  uint32_t fps() const;
+  void set_fps(uint32_t value);
+  private:
+  uint32_t _internal_fps() const;
+  void _internal_set_fps(uint32_t value);
+  public:
+
+  // optional uint32 radars_outline_thickness = 1 [default = 1];
+  bool has_radars_outline_thickness() const;
+  private:
+  bool _internal_has_radars_outline_thickness() const;
+  public:
+  void clear_radars_outline_thickness();
+  uint32_t radars_outline_thickness() const;
+  void set_radars_outline_thickness(uint32_t value);
+  private:
+  uint32_t _internal_radars_outline_thickness() const;
+  void _internal_set_radars_outline_thickness(uint32_t value);
+  public:
+
+  // optional uint32 target_radius = 2 [default = 5];
+  bool has_target_radius() const;
+  private:
+  bool _internal_has_target_radius() const;
+  public:
+  void clear_target_radius();
+  uint32_t target_radius() const;
+  void set_target_radius(uint32_t value);
+  private:
+  uint32_t _internal_target_radius() const;
+  void _internal_set_target_radius(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters.Visualizer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool draw_entry_points_;
+    uint32_t fps_;
+    uint32_t radars_outline_thickness_;
+    uint32_t target_radius_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Parameters final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.Parameters) */ {
+ public:
+  inline Parameters() : Parameters(nullptr) {}
+  ~Parameters() override;
+  explicit PROTOBUF_CONSTEXPR Parameters(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Parameters(const Parameters& from);
+  Parameters(Parameters&& from) noexcept
+    : Parameters() {
+    *this = ::std::move(from);
+  }
+
+  inline Parameters& operator=(const Parameters& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Parameters& operator=(Parameters&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Parameters& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Parameters* internal_default_instance() {
+    return reinterpret_cast<const Parameters*>(
+               &_Parameters_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(Parameters& a, Parameters& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Parameters* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Parameters* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Parameters* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Parameters>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Parameters& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Parameters& from) {
+    Parameters::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Parameters* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.Parameters";
+  }
+  protected:
+  explicit Parameters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Parameters_SmallRadar SmallRadar;
+  typedef Parameters_BigRadar BigRadar;
+  typedef Parameters_Ship Ship;
+  typedef Parameters_General General;
+  typedef Parameters_Defense Defense;
+  typedef Parameters_Simulator Simulator;
+  typedef Parameters_Visualizer Visualizer;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExtraSmallRadarsFieldNumber = 8,
+    kSmallRadarFieldNumber = 1,
+    kBigRadarFieldNumber = 2,
+    kShipFieldNumber = 3,
+    kGeneralFieldNumber = 4,
+    kDefenseFieldNumber = 5,
+    kSimulatorFieldNumber = 6,
+    kVisualizerFieldNumber = 7,
+  };
+  // repeated .Proto.Parameters.SmallRadar extra_small_radars = 8;
+  int extra_small_radars_size() const;
+  private:
+  int _internal_extra_small_radars_size() const;
+  public:
+  void clear_extra_small_radars();
+  ::Proto::Parameters_SmallRadar* mutable_extra_small_radars(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_SmallRadar >*
+      mutable_extra_small_radars();
+  private:
+  const ::Proto::Parameters_SmallRadar& _internal_extra_small_radars(int index) const;
+  ::Proto::Parameters_SmallRadar* _internal_add_extra_small_radars();
+  public:
+  const ::Proto::Parameters_SmallRadar& extra_small_radars(int index) const;
+  ::Proto::Parameters_SmallRadar* add_extra_small_radars();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_SmallRadar >&
+      extra_small_radars() const;
+
+  // required .Proto.Parameters.SmallRadar small_radar = 1;
+  bool has_small_radar() const;
+  private:
+  bool _internal_has_small_radar() const;
+  public:
+  void clear_small_radar();
+  const ::Proto::Parameters_SmallRadar& small_radar() const;
+  PROTOBUF_NODISCARD ::Proto::Parameters_SmallRadar* release_small_radar();
+  ::Proto::Parameters_SmallRadar* mutable_small_radar();
+  void set_allocated_small_radar(::Proto::Parameters_SmallRadar* small_radar);
+  private:
+  const ::Proto::Parameters_SmallRadar& _internal_small_radar() const;
+  ::Proto::Parameters_SmallRadar* _internal_mutable_small_radar();
+  public:
+  void unsafe_arena_set_allocated_small_radar(
+      ::Proto::Parameters_SmallRadar* small_radar);
+  ::Proto::Parameters_SmallRadar* unsafe_arena_release_small_radar();
+
+  // required .Proto.Parameters.BigRadar big_radar = 2;
+  bool has_big_radar() const;
+  private:
+  bool _internal_has_big_radar() const;
+  public:
+  void clear_big_radar();
+  const ::Proto::Parameters_BigRadar& big_radar() const;
+  PROTOBUF_NODISCARD ::Proto::Parameters_BigRadar* release_big_radar();
+  ::Proto::Parameters_BigRadar* mutable_big_radar();
+  void set_allocated_big_radar(::Proto::Parameters_BigRadar* big_radar);
+  private:
+  const ::Proto::Parameters_BigRadar& _internal_big_radar() const;
+  ::Proto::Parameters_BigRadar* _internal_mutable_big_radar();
+  public:
+  void unsafe_arena_set_allocated_big_radar(
+      ::Proto::Parameters_BigRadar* big_radar);
+  ::Proto::Parameters_BigRadar* unsafe_arena_release_big_radar();
+
+  // required .Proto.Parameters.Ship ship = 3;
+  bool has_ship() const;
+  private:
+  bool _internal_has_ship() const;
+  public:
+  void clear_ship();
+  const ::Proto::Parameters_Ship& ship() const;
+  PROTOBUF_NODISCARD ::Proto::Parameters_Ship* release_ship();
+  ::Proto::Parameters_Ship* mutable_ship();
+  void set_allocated_ship(::Proto::Parameters_Ship* ship);
+  private:
+  const ::Proto::Parameters_Ship& _internal_ship() const;
+  ::Proto::Parameters_Ship* _internal_mutable_ship();
+  public:
+  void unsafe_arena_set_allocated_ship(
+      ::Proto::Parameters_Ship* ship);
+  ::Proto::Parameters_Ship* unsafe_arena_release_ship();
+
+  // required .Proto.Parameters.General general = 4;
+  bool has_general() const;
+  private:
+  bool _internal_has_general() const;
+  public:
+  void clear_general();
+  const ::Proto::Parameters_General& general() const;
+  PROTOBUF_NODISCARD ::Proto::Parameters_General* release_general();
+  ::Proto::Parameters_General* mutable_general();
+  void set_allocated_general(::Proto::Parameters_General* general);
+  private:
+  const ::Proto::Parameters_General& _internal_general() const;
+  ::Proto::Parameters_General* _internal_mutable_general();
+  public:
+  void unsafe_arena_set_allocated_general(
+      ::Proto::Parameters_General* general);
+  ::Proto::Parameters_General* unsafe_arena_release_general();
+
+  // required .Proto.Parameters.Defense defense = 5;
+  bool has_defense() const;
+  private:
+  bool _internal_has_defense() const;
+  public:
+  void clear_defense();
+  const ::Proto::Parameters_Defense& defense() const;
+  PROTOBUF_NODISCARD ::Proto::Parameters_Defense* release_defense();
+  ::Proto::Parameters_Defense* mutable_defense();
+  void set_allocated_defense(::Proto::Parameters_Defense* defense);
+  private:
+  const ::Proto::Parameters_Defense& _internal_defense() const;
+  ::Proto::Parameters_Defense* _internal_mutable_defense();
+  public:
+  void unsafe_arena_set_allocated_defense(
+      ::Proto::Parameters_Defense* defense);
+  ::Proto::Parameters_Defense* unsafe_arena_release_defense();
+
+  // required .Proto.Parameters.Simulator simulator = 6;
+  bool has_simulator() const;
+  private:
+  bool _internal_has_simulator() const;
+  public:
+  void clear_simulator();
+  const ::Proto::Parameters_Simulator& simulator() const;
+  PROTOBUF_NODISCARD ::Proto::Parameters_Simulator* release_simulator();
+  ::Proto::Parameters_Simulator* mutable_simulator();
+  void set_allocated_simulator(::Proto::Parameters_Simulator* simulator);
+  private:
+  const ::Proto::Parameters_Simulator& _internal_simulator() const;
+  ::Proto::Parameters_Simulator* _internal_mutable_simulator();
+  public:
+  void unsafe_arena_set_allocated_simulator(
+      ::Proto::Parameters_Simulator* simulator);
+  ::Proto::Parameters_Simulator* unsafe_arena_release_simulator();
+
+  // required .Proto.Parameters.Visualizer visualizer = 7;
+  bool has_visualizer() const;
+  private:
+  bool _internal_has_visualizer() const;
+  public:
+  void clear_visualizer();
+  const ::Proto::Parameters_Visualizer& visualizer() const;
+  PROTOBUF_NODISCARD ::Proto::Parameters_Visualizer* release_visualizer();
+  ::Proto::Parameters_Visualizer* mutable_visualizer();
+  void set_allocated_visualizer(::Proto::Parameters_Visualizer* visualizer);
+  private:
+  const ::Proto::Parameters_Visualizer& _internal_visualizer() const;
+  ::Proto::Parameters_Visualizer* _internal_mutable_visualizer();
+  public:
+  void unsafe_arena_set_allocated_visualizer(
+      ::Proto::Parameters_Visualizer* visualizer);
+  ::Proto::Parameters_Visualizer* unsafe_arena_release_visualizer();
+
+  // @@protoc_insertion_point(class_scope:Proto.Parameters)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_SmallRadar > extra_small_radars_;
+    ::Proto::Parameters_SmallRadar* small_radar_;
+    ::Proto::Parameters_BigRadar* big_radar_;
+    ::Proto::Parameters_Ship* ship_;
+    ::Proto::Parameters_General* general_;
+    ::Proto::Parameters_Defense* defense_;
+    ::Proto::Parameters_Simulator* simulator_;
+    ::Proto::Parameters_Visualizer* visualizer_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_params_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Parameters_SmallRadar
+
+// required double radius = 1;
+inline bool Parameters_SmallRadar::_internal_has_radius() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_radius() const {
+  return _internal_has_radius();
+}
+inline void Parameters_SmallRadar::clear_radius() {
+  _impl_.radius_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Parameters_SmallRadar::_internal_radius() const {
+  return _impl_.radius_;
+}
+inline double Parameters_SmallRadar::radius() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.radius)
+  return _internal_radius();
+}
+inline void Parameters_SmallRadar::_internal_set_radius(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.radius_ = value;
+}
+inline void Parameters_SmallRadar::set_radius(double value) {
+  _internal_set_radius(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.radius)
+}
+
+// required double view_angle = 2;
+inline bool Parameters_SmallRadar::_internal_has_view_angle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_view_angle() const {
+  return _internal_has_view_angle();
+}
+inline void Parameters_SmallRadar::clear_view_angle() {
+  _impl_.view_angle_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double Parameters_SmallRadar::_internal_view_angle() const {
+  return _impl_.view_angle_;
+}
+inline double Parameters_SmallRadar::view_angle() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.view_angle)
+  return _internal_view_angle();
+}
+inline void Parameters_SmallRadar::_internal_set_view_angle(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.view_angle_ = value;
+}
+inline void Parameters_SmallRadar::set_view_angle(double value) {
+  _internal_set_view_angle(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.view_angle)
+}
+
+// required double frequency = 3;
+inline bool Parameters_SmallRadar::_internal_has_frequency() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_frequency() const {
+  return _internal_has_frequency();
+}
+inline void Parameters_SmallRadar::clear_frequency() {
+  _impl_.frequency_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double Parameters_SmallRadar::_internal_frequency() const {
+  return _impl_.frequency_;
+}
+inline double Parameters_SmallRadar::frequency() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.frequency)
+  return _internal_frequency();
+}
+inline void Parameters_SmallRadar::_internal_set_frequency(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.frequency_ = value;
+}
+inline void Parameters_SmallRadar::set_frequency(double value) {
+  _internal_set_frequency(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.frequency)
+}
+
+// required double max_eps = 4;
+inline bool Parameters_SmallRadar::_internal_has_max_eps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_max_eps() const {
+  return _internal_has_max_eps();
+}
+inline void Parameters_SmallRadar::clear_max_eps() {
+  _impl_.max_eps_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double Parameters_SmallRadar::_internal_max_eps() const {
+  return _impl_.max_eps_;
+}
+inline double Parameters_SmallRadar::max_eps() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.max_eps)
+  return _internal_max_eps();
+}
+inline void Parameters_SmallRadar::_internal_set_max_eps(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.max_eps_ = value;
+}
+inline void Parameters_SmallRadar::set_max_eps(double value) {
+  _internal_set_max_eps(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.max_eps)
+}
+
+// required double max_angle_speed = 5;
+inline bool Parameters_SmallRadar::_internal_has_max_angle_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_max_angle_speed() const {
+  return _internal_has_max_angle_speed();
+}
+inline void Parameters_SmallRadar::clear_max_angle_speed() {
+  _impl_.max_angle_speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Parameters_SmallRadar::_internal_max_angle_speed() const {
+  return _impl_.max_angle_speed_;
+}
+inline double Parameters_SmallRadar::max_angle_speed() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.max_angle_speed)
+  return _internal_max_angle_speed();
+}
+inline void Parameters_SmallRadar::_internal_set_max_angle_speed(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.max_angle_speed_ = value;
+}
+inline void Parameters_SmallRadar::set_max_angle_speed(double value) {
+  _internal_set_max_angle_speed(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.max_angle_speed)
+}
+
+// required double rad_stddev = 6;
+inline bool Parameters_SmallRadar::_internal_has_rad_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_rad_stddev() const {
+  return _internal_has_rad_stddev();
+}
+inline void Parameters_SmallRadar::clear_rad_stddev() {
+  _impl_.rad_stddev_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double Parameters_SmallRadar::_internal_rad_stddev() const {
+  return _impl_.rad_stddev_;
+}
+inline double Parameters_SmallRadar::rad_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.rad_stddev)
+  return _internal_rad_stddev();
+}
+inline void Parameters_SmallRadar::_internal_set_rad_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.rad_stddev_ = value;
+}
+inline void Parameters_SmallRadar::set_rad_stddev(double value) {
+  _internal_set_rad_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.rad_stddev)
+}
+
+// required double ang_stddev = 7;
+inline bool Parameters_SmallRadar::_internal_has_ang_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_ang_stddev() const {
+  return _internal_has_ang_stddev();
+}
+inline void Parameters_SmallRadar::clear_ang_stddev() {
+  _impl_.ang_stddev_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double Parameters_SmallRadar::_internal_ang_stddev() const {
+  return _impl_.ang_stddev_;
+}
+inline double Parameters_SmallRadar::ang_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.ang_stddev)
+  return _internal_ang_stddev();
+}
+inline void Parameters_SmallRadar::_internal_set_ang_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.ang_stddev_ = value;
+}
+inline void Parameters_SmallRadar::set_ang_stddev(double value) {
+  _internal_set_ang_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.ang_stddev)
+}
+
+// required double h_stddev = 8;
+inline bool Parameters_SmallRadar::_internal_has_h_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_h_stddev() const {
+  return _internal_has_h_stddev();
+}
+inline void Parameters_SmallRadar::clear_h_stddev() {
+  _impl_.h_stddev_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double Parameters_SmallRadar::_internal_h_stddev() const {
+  return _impl_.h_stddev_;
+}
+inline double Parameters_SmallRadar::h_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.h_stddev)
+  return _internal_h_stddev();
+}
+inline void Parameters_SmallRadar::_internal_set_h_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.h_stddev_ = value;
+}
+inline void Parameters_SmallRadar::set_h_stddev(double value) {
+  _internal_set_h_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.h_stddev)
+}
+
+// required double responsible_sector_start = 9;
+inline bool Parameters_SmallRadar::_internal_has_responsible_sector_start() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_responsible_sector_start() const {
+  return _internal_has_responsible_sector_start();
+}
+inline void Parameters_SmallRadar::clear_responsible_sector_start() {
+  _impl_.responsible_sector_start_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double Parameters_SmallRadar::_internal_responsible_sector_start() const {
+  return _impl_.responsible_sector_start_;
+}
+inline double Parameters_SmallRadar::responsible_sector_start() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.responsible_sector_start)
+  return _internal_responsible_sector_start();
+}
+inline void Parameters_SmallRadar::_internal_set_responsible_sector_start(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.responsible_sector_start_ = value;
+}
+inline void Parameters_SmallRadar::set_responsible_sector_start(double value) {
+  _internal_set_responsible_sector_start(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.responsible_sector_start)
+}
+
+// required double responsible_sector_end = 10;
+inline bool Parameters_SmallRadar::_internal_has_responsible_sector_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Parameters_SmallRadar::has_responsible_sector_end() const {
+  return _internal_has_responsible_sector_end();
+}
+inline void Parameters_SmallRadar::clear_responsible_sector_end() {
+  _impl_.responsible_sector_end_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double Parameters_SmallRadar::_internal_responsible_sector_end() const {
+  return _impl_.responsible_sector_end_;
+}
+inline double Parameters_SmallRadar::responsible_sector_end() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.SmallRadar.responsible_sector_end)
+  return _internal_responsible_sector_end();
+}
+inline void Parameters_SmallRadar::_internal_set_responsible_sector_end(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.responsible_sector_end_ = value;
+}
+inline void Parameters_SmallRadar::set_responsible_sector_end(double value) {
+  _internal_set_responsible_sector_end(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.SmallRadar.responsible_sector_end)
+}
+
+// -------------------------------------------------------------------
+
+// Parameters_BigRadar
+
+// required double radius = 1;
+inline bool Parameters_BigRadar::_internal_has_radius() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Parameters_BigRadar::has_radius() const {
+  return _internal_has_radius();
+}
+inline void Parameters_BigRadar::clear_radius() {
+  _impl_.radius_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Parameters_BigRadar::_internal_radius() const {
+  return _impl_.radius_;
+}
+inline double Parameters_BigRadar::radius() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.BigRadar.radius)
+  return _internal_radius();
+}
+inline void Parameters_BigRadar::_internal_set_radius(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.radius_ = value;
+}
+inline void Parameters_BigRadar::set_radius(double value) {
+  _internal_set_radius(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.BigRadar.radius)
+}
+
+// required double frequency = 2;
+inline bool Parameters_BigRadar::_internal_has_frequency() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Parameters_BigRadar::has_frequency() const {
+  return _internal_has_frequency();
+}
+inline void Parameters_BigRadar::clear_frequency() {
+  _impl_.frequency_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double Parameters_BigRadar::_internal_frequency() const {
+  return _impl_.frequency_;
+}
+inline double Parameters_BigRadar::frequency() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.BigRadar.frequency)
+  return _internal_frequency();
+}
+inline void Parameters_BigRadar::_internal_set_frequency(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.frequency_ = value;
+}
+inline void Parameters_BigRadar::set_frequency(double value) {
+  _internal_set_frequency(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.BigRadar.frequency)
+}
+
+// required double rad_stddev = 3;
+inline bool Parameters_BigRadar::_internal_has_rad_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Parameters_BigRadar::has_rad_stddev() const {
+  return _internal_has_rad_stddev();
+}
+inline void Parameters_BigRadar::clear_rad_stddev() {
+  _impl_.rad_stddev_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double Parameters_BigRadar::_internal_rad_stddev() const {
+  return _impl_.rad_stddev_;
+}
+inline double Parameters_BigRadar::rad_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.BigRadar.rad_stddev)
+  return _internal_rad_stddev();
+}
+inline void Parameters_BigRadar::_internal_set_rad_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.rad_stddev_ = value;
+}
+inline void Parameters_BigRadar::set_rad_stddev(double value) {
+  _internal_set_rad_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.BigRadar.rad_stddev)
+}
+
+// required double ang_stddev = 4;
+inline bool Parameters_BigRadar::_internal_has_ang_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Parameters_BigRadar::has_ang_stddev() const {
+  return _internal_has_ang_stddev();
+}
+inline void Parameters_BigRadar::clear_ang_stddev() {
+  _impl_.ang_stddev_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double Parameters_BigRadar::_internal_ang_stddev() const {
+  return _impl_.ang_stddev_;
+}
+inline double Parameters_BigRadar::ang_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.BigRadar.ang_stddev)
+  return _internal_ang_stddev();
+}
+inline void Parameters_BigRadar::_internal_set_ang_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.ang_stddev_ = value;
+}
+inline void Parameters_BigRadar::set_ang_stddev(double value) {
+  _internal_set_ang_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.BigRadar.ang_stddev)
+}
+
+// required double h_stddev = 5;
+inline bool Parameters_BigRadar::_internal_has_h_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Parameters_BigRadar::has_h_stddev() const {
+  return _internal_has_h_stddev();
+}
+inline void Parameters_BigRadar::clear_h_stddev() {
+  _impl_.h_stddev_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Parameters_BigRadar::_internal_h_stddev() const {
+  return _impl_.h_stddev_;
+}
+inline double Parameters_BigRadar::h_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.BigRadar.h_stddev)
+  return _internal_h_stddev();
+}
+inline void Parameters_BigRadar::_internal_set_h_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.h_stddev_ = value;
+}
+inline void Parameters_BigRadar::set_h_stddev(double value) {
+  _internal_set_h_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.BigRadar.h_stddev)
+}
+
+// -------------------------------------------------------------------
+
+// Parameters_Ship_DeadZone
+
+// required double start = 1;
+inline bool Parameters_Ship_DeadZone::_internal_has_start() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Parameters_Ship_DeadZone::has_start() const {
+  return _internal_has_start();
+}
+inline void Parameters_Ship_DeadZone::clear_start() {
+  _impl_.start_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Parameters_Ship_DeadZone::_internal_start() const {
+  return _impl_.start_;
+}
+inline double Parameters_Ship_DeadZone::start() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Ship.DeadZone.start)
+  return _internal_start();
+}
+inline void Parameters_Ship_DeadZone::_internal_set_start(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.start_ = value;
+}
+inline void Parameters_Ship_DeadZone::set_start(double value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Ship.DeadZone.start)
+}
+
+// required double end = 2;
+inline bool Parameters_Ship_DeadZone::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Parameters_Ship_DeadZone::has_end() const {
+  return _internal_has_end();
+}
+inline void Parameters_Ship_DeadZone::clear_end() {
+  _impl_.end_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double Parameters_Ship_DeadZone::_internal_end() const {
+  return _impl_.end_;
+}
+inline double Parameters_Ship_DeadZone::end() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Ship.DeadZone.end)
+  return _internal_end();
+}
+inline void Parameters_Ship_DeadZone::_internal_set_end(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.end_ = value;
+}
+inline void Parameters_Ship_DeadZone::set_end(double value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Ship.DeadZone.end)
+}
+
+// -------------------------------------------------------------------
+
+// Parameters_Ship
+
+// required double max_eps = 1;
+inline bool Parameters_Ship::_internal_has_max_eps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Parameters_Ship::has_max_eps() const {
+  return _internal_has_max_eps();
+}
+inline void Parameters_Ship::clear_max_eps() {
+  _impl_.max_eps_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Parameters_Ship::_internal_max_eps() const {
+  return _impl_.max_eps_;
+}
+inline double Parameters_Ship::max_eps() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Ship.max_eps)
+  return _internal_max_eps();
+}
+inline void Parameters_Ship::_internal_set_max_eps(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.max_eps_ = value;
+}
+inline void Parameters_Ship::set_max_eps(double value) {
+  _internal_set_max_eps(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Ship.max_eps)
+}
+
+// required double max_angle_speed = 2;
+inline bool Parameters_Ship::_internal_has_max_angle_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Parameters_Ship::has_max_angle_speed() const {
+  return _internal_has_max_angle_speed();
+}
+inline void Parameters_Ship::clear_max_angle_speed() {
+  _impl_.max_angle_speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double Parameters_Ship::_internal_max_angle_speed() const {
+  return _impl_.max_angle_speed_;
+}
+inline double Parameters_Ship::max_angle_speed() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Ship.max_angle_speed)
+  return _internal_max_angle_speed();
+}
+inline void Parameters_Ship::_internal_set_max_angle_speed(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_angle_speed_ = value;
+}
+inline void Parameters_Ship::set_max_angle_speed(double value) {
+  _internal_set_max_angle_speed(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Ship.max_angle_speed)
+}
+
+// repeated .Proto.Parameters.Ship.DeadZone dead_zones = 3;
+inline int Parameters_Ship::_internal_dead_zones_size() const {
+  return _impl_.dead_zones_.size();
+}
+inline int Parameters_Ship::dead_zones_size() const {
+  return _internal_dead_zones_size();
+}
+inline void Parameters_Ship::clear_dead_zones() {
+  _impl_.dead_zones_.Clear();
+}
+inline ::Proto::Parameters_Ship_DeadZone* Parameters_Ship::mutable_dead_zones(int index) {
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.Ship.dead_zones)
+  return _impl_.dead_zones_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_Ship_DeadZone >*
+Parameters_Ship::mutable_dead_zones() {
+  // @@protoc_insertion_point(field_mutable_list:Proto.Parameters.Ship.dead_zones)
+  return &_impl_.dead_zones_;
+}
+inline const ::Proto::Parameters_Ship_DeadZone& Parameters_Ship::_internal_dead_zones(int index) const {
+  return _impl_.dead_zones_.Get(index);
+}
+inline const ::Proto::Parameters_Ship_DeadZone& Parameters_Ship::dead_zones(int index) const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Ship.dead_zones)
+  return _internal_dead_zones(index);
+}
+inline ::Proto::Parameters_Ship_DeadZone* Parameters_Ship::_internal_add_dead_zones() {
+  return _impl_.dead_zones_.Add();
+}
+inline ::Proto::Parameters_Ship_DeadZone* Parameters_Ship::add_dead_zones() {
+  ::Proto::Parameters_Ship_DeadZone* _add = _internal_add_dead_zones();
+  // @@protoc_insertion_point(field_add:Proto.Parameters.Ship.dead_zones)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_Ship_DeadZone >&
+Parameters_Ship::dead_zones() const {
+  // @@protoc_insertion_point(field_list:Proto.Parameters.Ship.dead_zones)
+  return _impl_.dead_zones_;
+}
+
+// -------------------------------------------------------------------
+
+// Parameters_General
+
+// optional double death_time = 1 [default = 5000];
+inline bool Parameters_General::_internal_has_death_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_death_time() const {
+  return _internal_has_death_time();
+}
+inline void Parameters_General::clear_death_time() {
+  _impl_.death_time_ = 5000;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double Parameters_General::_internal_death_time() const {
+  return _impl_.death_time_;
+}
+inline double Parameters_General::death_time() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.death_time)
+  return _internal_death_time();
+}
+inline void Parameters_General::_internal_set_death_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.death_time_ = value;
+}
+inline void Parameters_General::set_death_time(double value) {
+  _internal_set_death_time(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.death_time)
+}
+
+// optional double play_speed = 2 [default = 1];
+inline bool Parameters_General::_internal_has_play_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_play_speed() const {
+  return _internal_has_play_speed();
+}
+inline void Parameters_General::clear_play_speed() {
+  _impl_.play_speed_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double Parameters_General::_internal_play_speed() const {
+  return _impl_.play_speed_;
+}
+inline double Parameters_General::play_speed() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.play_speed)
+  return _internal_play_speed();
+}
+inline void Parameters_General::_internal_set_play_speed(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.play_speed_ = value;
+}
+inline void Parameters_General::set_play_speed(double value) {
+  _internal_set_play_speed(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.play_speed)
+}
+
+// optional double big_radar_measure_cnt = 3 [default = 30];
+inline bool Parameters_General::_internal_has_big_radar_measure_cnt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_big_radar_measure_cnt() const {
+  return _internal_has_big_radar_measure_cnt();
+}
+inline void Parameters_General::clear_big_radar_measure_cnt() {
+  _impl_.big_radar_measure_cnt_ = 30;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline double Parameters_General::_internal_big_radar_measure_cnt() const {
+  return _impl_.big_radar_measure_cnt_;
+}
+inline double Parameters_General::big_radar_measure_cnt() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.big_radar_measure_cnt)
+  return _internal_big_radar_measure_cnt();
+}
+inline void Parameters_General::_internal_set_big_radar_measure_cnt(double value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.big_radar_measure_cnt_ = value;
+}
+inline void Parameters_General::set_big_radar_measure_cnt(double value) {
+  _internal_set_big_radar_measure_cnt(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.big_radar_measure_cnt)
+}
+
+// optional double small_radar_measure_cnt = 4 [default = 40];
+inline bool Parameters_General::_internal_has_small_radar_measure_cnt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_small_radar_measure_cnt() const {
+  return _internal_has_small_radar_measure_cnt();
+}
+inline void Parameters_General::clear_small_radar_measure_cnt() {
+  _impl_.small_radar_measure_cnt_ = 40;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double Parameters_General::_internal_small_radar_measure_cnt() const {
+  return _impl_.small_radar_measure_cnt_;
+}
+inline double Parameters_General::small_radar_measure_cnt() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.small_radar_measure_cnt)
+  return _internal_small_radar_measure_cnt();
+}
+inline void Parameters_General::_internal_set_small_radar_measure_cnt(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.small_radar_measure_cnt_ = value;
+}
+inline void Parameters_General::set_small_radar_measure_cnt(double value) {
+  _internal_set_small_radar_measure_cnt(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.small_radar_measure_cnt)
+}
+
+// optional double aprox_small_radar_measure_cnt = 5 [default = 10];
+inline bool Parameters_General::_internal_has_aprox_small_radar_measure_cnt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_aprox_small_radar_measure_cnt() const {
+  return _internal_has_aprox_small_radar_measure_cnt();
+}
+inline void Parameters_General::clear_aprox_small_radar_measure_cnt() {
+  _impl_.aprox_small_radar_measure_cnt_ = 10;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double Parameters_General::_internal_aprox_small_radar_measure_cnt() const {
+  return _impl_.aprox_small_radar_measure_cnt_;
+}
+inline double Parameters_General::aprox_small_radar_measure_cnt() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.aprox_small_radar_measure_cnt)
+  return _internal_aprox_small_radar_measure_cnt();
+}
+inline void Parameters_General::_internal_set_aprox_small_radar_measure_cnt(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.aprox_small_radar_measure_cnt_ = value;
+}
+inline void Parameters_General::set_aprox_small_radar_measure_cnt(double value) {
+  _internal_set_aprox_small_radar_measure_cnt(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.aprox_small_radar_measure_cnt)
+}
+
+// optional double margin_angle = 6 [default = 5];
+inline bool Parameters_General::_internal_has_margin_angle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_margin_angle() const {
+  return _internal_has_margin_angle();
+}
+inline void Parameters_General::clear_margin_angle() {
+  _impl_.margin_angle_ = 5;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double Parameters_General::_internal_margin_angle() const {
+  return _impl_.margin_angle_;
+}
+inline double Parameters_General::margin_angle() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.margin_angle)
+  return _internal_margin_angle();
+}
+inline void Parameters_General::_internal_set_margin_angle(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.margin_angle_ = value;
+}
+inline void Parameters_General::set_margin_angle(double value) {
+  _internal_set_margin_angle(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.margin_angle)
+}
+
+// optional double margin_time = 7 [default = 3000];
+inline bool Parameters_General::_internal_has_margin_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_margin_time() const {
+  return _internal_has_margin_time();
+}
+inline void Parameters_General::clear_margin_time() {
+  _impl_.margin_time_ = 3000;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double Parameters_General::_internal_margin_time() const {
+  return _impl_.margin_time_;
+}
+inline double Parameters_General::margin_time() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.margin_time)
+  return _internal_margin_time();
+}
+inline void Parameters_General::_internal_set_margin_time(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.margin_time_ = value;
+}
+inline void Parameters_General::set_margin_time(double value) {
+  _internal_set_margin_time(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.margin_time)
+}
+
+// optional double kinematics_step = 8 [default = 5];
+inline bool Parameters_General::_internal_has_kinematics_step() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_kinematics_step() const {
+  return _internal_has_kinematics_step();
+}
+inline void Parameters_General::clear_kinematics_step() {
+  _impl_.kinematics_step_ = 5;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline double Parameters_General::_internal_kinematics_step() const {
+  return _impl_.kinematics_step_;
+}
+inline double Parameters_General::kinematics_step() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.kinematics_step)
+  return _internal_kinematics_step();
+}
+inline void Parameters_General::_internal_set_kinematics_step(double value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.kinematics_step_ = value;
+}
+inline void Parameters_General::set_kinematics_step(double value) {
+  _internal_set_kinematics_step(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.kinematics_step)
+}
+
+// optional double process_budget_share = 9 [default = 0];
+inline bool Parameters_General::_internal_has_process_budget_share() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_process_budget_share() const {
+  return _internal_has_process_budget_share();
+}
+inline void Parameters_General::clear_process_budget_share() {
+  _impl_.process_budget_share_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Parameters_General::_internal_process_budget_share() const {
+  return _impl_.process_budget_share_;
+}
+inline double Parameters_General::process_budget_share() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.process_budget_share)
+  return _internal_process_budget_share();
+}
+inline void Parameters_General::_internal_set_process_budget_share(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.process_budget_share_ = value;
+}
+inline void Parameters_General::set_process_budget_share(double value) {
+  _internal_set_process_budget_share(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.process_budget_share)
+}
+
+// optional .Proto.Parameters.General.TargetSelection target_selection = 10 [default = GREEDY];
+inline bool Parameters_General::_internal_has_target_selection() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_target_selection() const {
+  return _internal_has_target_selection();
+}
+inline void Parameters_General::clear_target_selection() {
+  _impl_.target_selection_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::Proto::Parameters_General_TargetSelection Parameters_General::_internal_target_selection() const {
+  return static_cast< ::Proto::Parameters_General_TargetSelection >(_impl_.target_selection_);
+}
+inline ::Proto::Parameters_General_TargetSelection Parameters_General::target_selection() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.target_selection)
+  return _internal_target_selection();
+}
+inline void Parameters_General::_internal_set_target_selection(::Proto::Parameters_General_TargetSelection value) {
+  assert(::Proto::Parameters_General_TargetSelection_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.target_selection_ = value;
+}
+inline void Parameters_General::set_target_selection(::Proto::Parameters_General_TargetSelection value) {
+  _internal_set_target_selection(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.target_selection)
+}
+
+// optional double rotation_cache_step = 11 [default = 0.1];
+inline bool Parameters_General::_internal_has_rotation_cache_step() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_rotation_cache_step() const {
+  return _internal_has_rotation_cache_step();
+}
+inline void Parameters_General::clear_rotation_cache_step() {
+  _impl_.rotation_cache_step_ = 0.1;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline double Parameters_General::_internal_rotation_cache_step() const {
+  return _impl_.rotation_cache_step_;
+}
+inline double Parameters_General::rotation_cache_step() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.rotation_cache_step)
+  return _internal_rotation_cache_step();
+}
+inline void Parameters_General::_internal_set_rotation_cache_step(double value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.rotation_cache_step_ = value;
+}
+inline void Parameters_General::set_rotation_cache_step(double value) {
+  _internal_set_rotation_cache_step(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.rotation_cache_step)
+}
+
+// optional double geometry_pos_tolerance = 12 [default = 0];
+inline bool Parameters_General::_internal_has_geometry_pos_tolerance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_geometry_pos_tolerance() const {
+  return _internal_has_geometry_pos_tolerance();
+}
+inline void Parameters_General::clear_geometry_pos_tolerance() {
+  _impl_.geometry_pos_tolerance_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double Parameters_General::_internal_geometry_pos_tolerance() const {
+  return _impl_.geometry_pos_tolerance_;
+}
+inline double Parameters_General::geometry_pos_tolerance() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.geometry_pos_tolerance)
+  return _internal_geometry_pos_tolerance();
+}
+inline void Parameters_General::_internal_set_geometry_pos_tolerance(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.geometry_pos_tolerance_ = value;
+}
+inline void Parameters_General::set_geometry_pos_tolerance(double value) {
+  _internal_set_geometry_pos_tolerance(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.geometry_pos_tolerance)
+}
+
+// optional double geometry_speed_tolerance = 13 [default = 0];
+inline bool Parameters_General::_internal_has_geometry_speed_tolerance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_geometry_speed_tolerance() const {
+  return _internal_has_geometry_speed_tolerance();
+}
+inline void Parameters_General::clear_geometry_speed_tolerance() {
+  _impl_.geometry_speed_tolerance_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Parameters_General::_internal_geometry_speed_tolerance() const {
+  return _impl_.geometry_speed_tolerance_;
+}
+inline double Parameters_General::geometry_speed_tolerance() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.geometry_speed_tolerance)
+  return _internal_geometry_speed_tolerance();
+}
+inline void Parameters_General::_internal_set_geometry_speed_tolerance(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.geometry_speed_tolerance_ = value;
+}
+inline void Parameters_General::set_geometry_speed_tolerance(double value) {
+  _internal_set_geometry_speed_tolerance(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.geometry_speed_tolerance)
+}
+
+// optional .Proto.Parameters.General.TrackFilter track_filter = 14 [default = AB_FILTER];
+inline bool Parameters_General::_internal_has_track_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_track_filter() const {
+  return _internal_has_track_filter();
+}
+inline void Parameters_General::clear_track_filter() {
+  _impl_.track_filter_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::Proto::Parameters_General_TrackFilter Parameters_General::_internal_track_filter() const {
+  return static_cast< ::Proto::Parameters_General_TrackFilter >(_impl_.track_filter_);
+}
+inline ::Proto::Parameters_General_TrackFilter Parameters_General::track_filter() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.track_filter)
+  return _internal_track_filter();
+}
+inline void Parameters_General::_internal_set_track_filter(::Proto::Parameters_General_TrackFilter value) {
+  assert(::Proto::Parameters_General_TrackFilter_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.track_filter_ = value;
+}
+inline void Parameters_General::set_track_filter(::Proto::Parameters_General_TrackFilter value) {
+  _internal_set_track_filter(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.track_filter)
+}
+
+// optional double kalman_measurement_stddev = 15 [default = 0.3];
+inline bool Parameters_General::_internal_has_kalman_measurement_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_kalman_measurement_stddev() const {
+  return _internal_has_kalman_measurement_stddev();
+}
+inline void Parameters_General::clear_kalman_measurement_stddev() {
+  _impl_.kalman_measurement_stddev_ = 0.3;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline double Parameters_General::_internal_kalman_measurement_stddev() const {
+  return _impl_.kalman_measurement_stddev_;
+}
+inline double Parameters_General::kalman_measurement_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.kalman_measurement_stddev)
+  return _internal_kalman_measurement_stddev();
+}
+inline void Parameters_General::_internal_set_kalman_measurement_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.kalman_measurement_stddev_ = value;
+}
+inline void Parameters_General::set_kalman_measurement_stddev(double value) {
+  _internal_set_kalman_measurement_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.kalman_measurement_stddev)
+}
+
+// optional double kalman_acceleration_stddev = 16 [default = 0.01];
+inline bool Parameters_General::_internal_has_kalman_acceleration_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_kalman_acceleration_stddev() const {
+  return _internal_has_kalman_acceleration_stddev();
+}
+inline void Parameters_General::clear_kalman_acceleration_stddev() {
+  _impl_.kalman_acceleration_stddev_ = 0.01;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline double Parameters_General::_internal_kalman_acceleration_stddev() const {
+  return _impl_.kalman_acceleration_stddev_;
+}
+inline double Parameters_General::kalman_acceleration_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.kalman_acceleration_stddev)
+  return _internal_kalman_acceleration_stddev();
+}
+inline void Parameters_General::_internal_set_kalman_acceleration_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.kalman_acceleration_stddev_ = value;
+}
+inline void Parameters_General::set_kalman_acceleration_stddev(double value) {
+  _internal_set_kalman_acceleration_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.kalman_acceleration_stddev)
+}
+
+// optional double kalman_precise_speed_stddev = 17 [default = 0.05];
+inline bool Parameters_General::_internal_has_kalman_precise_speed_stddev() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_kalman_precise_speed_stddev() const {
+  return _internal_has_kalman_precise_speed_stddev();
+}
+inline void Parameters_General::clear_kalman_precise_speed_stddev() {
+  _impl_.kalman_precise_speed_stddev_ = 0.05;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline double Parameters_General::_internal_kalman_precise_speed_stddev() const {
+  return _impl_.kalman_precise_speed_stddev_;
+}
+inline double Parameters_General::kalman_precise_speed_stddev() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.kalman_precise_speed_stddev)
+  return _internal_kalman_precise_speed_stddev();
+}
+inline void Parameters_General::_internal_set_kalman_precise_speed_stddev(double value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.kalman_precise_speed_stddev_ = value;
+}
+inline void Parameters_General::set_kalman_precise_speed_stddev(double value) {
+  _internal_set_kalman_precise_speed_stddev(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.kalman_precise_speed_stddev)
+}
+
+// optional int32 tick_arena_size = 18 [default = 262144];
+inline bool Parameters_General::_internal_has_tick_arena_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_tick_arena_size() const {
+  return _internal_has_tick_arena_size();
+}
+inline void Parameters_General::clear_tick_arena_size() {
+  _impl_.tick_arena_size_ = 262144;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline int32_t Parameters_General::_internal_tick_arena_size() const {
+  return _impl_.tick_arena_size_;
+}
+inline int32_t Parameters_General::tick_arena_size() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.tick_arena_size)
+  return _internal_tick_arena_size();
+}
+inline void Parameters_General::_internal_set_tick_arena_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.tick_arena_size_ = value;
+}
+inline void Parameters_General::set_tick_arena_size(int32_t value) {
+  _internal_set_tick_arena_size(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.tick_arena_size)
+}
+
+// optional double planner_horizon = 19 [default = 10000];
+inline bool Parameters_General::_internal_has_planner_horizon() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_planner_horizon() const {
+  return _internal_has_planner_horizon();
+}
+inline void Parameters_General::clear_planner_horizon() {
+  _impl_.planner_horizon_ = 10000;
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline double Parameters_General::_internal_planner_horizon() const {
+  return _impl_.planner_horizon_;
+}
+inline double Parameters_General::planner_horizon() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.planner_horizon)
+  return _internal_planner_horizon();
+}
+inline void Parameters_General::_internal_set_planner_horizon(double value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.planner_horizon_ = value;
+}
+inline void Parameters_General::set_planner_horizon(double value) {
+  _internal_set_planner_horizon(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.planner_horizon)
+}
+
+// optional int32 planner_beam_width = 20 [default = 8];
+inline bool Parameters_General::_internal_has_planner_beam_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_planner_beam_width() const {
+  return _internal_has_planner_beam_width();
+}
+inline void Parameters_General::clear_planner_beam_width() {
+  _impl_.planner_beam_width_ = 8;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline int32_t Parameters_General::_internal_planner_beam_width() const {
+  return _impl_.planner_beam_width_;
+}
+inline int32_t Parameters_General::planner_beam_width() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.planner_beam_width)
+  return _internal_planner_beam_width();
+}
+inline void Parameters_General::_internal_set_planner_beam_width(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.planner_beam_width_ = value;
+}
+inline void Parameters_General::set_planner_beam_width(int32_t value) {
+  _internal_set_planner_beam_width(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.planner_beam_width)
+}
+
+// optional int32 planner_max_depth = 21 [default = 3];
+inline bool Parameters_General::_internal_has_planner_max_depth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00800000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_planner_max_depth() const {
+  return _internal_has_planner_max_depth();
+}
+inline void Parameters_General::clear_planner_max_depth() {
+  _impl_.planner_max_depth_ = 3;
+  _impl_._has_bits_[0] &= ~0x00800000u;
+}
+inline int32_t Parameters_General::_internal_planner_max_depth() const {
+  return _impl_.planner_max_depth_;
+}
+inline int32_t Parameters_General::planner_max_depth() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.planner_max_depth)
+  return _internal_planner_max_depth();
+}
+inline void Parameters_General::_internal_set_planner_max_depth(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00800000u;
+  _impl_.planner_max_depth_ = value;
+}
+inline void Parameters_General::set_planner_max_depth(int32_t value) {
+  _internal_set_planner_max_depth(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.planner_max_depth)
+}
+
+// optional double association_gate = 23 [default = 10];
+inline bool Parameters_General::_internal_has_association_gate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_association_gate() const {
+  return _internal_has_association_gate();
+}
+inline void Parameters_General::clear_association_gate() {
+  _impl_.association_gate_ = 10;
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline double Parameters_General::_internal_association_gate() const {
+  return _impl_.association_gate_;
+}
+inline double Parameters_General::association_gate() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.association_gate)
+  return _internal_association_gate();
+}
+inline void Parameters_General::_internal_set_association_gate(double value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.association_gate_ = value;
+}
+inline void Parameters_General::set_association_gate(double value) {
+  _internal_set_association_gate(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.association_gate)
+}
+
+// optional int32 geometry_parallel_threshold = 25 [default = 64];
+inline bool Parameters_General::_internal_has_geometry_parallel_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x01000000u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_geometry_parallel_threshold() const {
+  return _internal_has_geometry_parallel_threshold();
+}
+inline void Parameters_General::clear_geometry_parallel_threshold() {
+  _impl_.geometry_parallel_threshold_ = 64;
+  _impl_._has_bits_[0] &= ~0x01000000u;
+}
+inline int32_t Parameters_General::_internal_geometry_parallel_threshold() const {
+  return _impl_.geometry_parallel_threshold_;
+}
+inline int32_t Parameters_General::geometry_parallel_threshold() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.geometry_parallel_threshold)
+  return _internal_geometry_parallel_threshold();
+}
+inline void Parameters_General::_internal_set_geometry_parallel_threshold(int32_t value) {
+  _impl_._has_bits_[0] |= 0x01000000u;
+  _impl_.geometry_parallel_threshold_ = value;
+}
+inline void Parameters_General::set_geometry_parallel_threshold(int32_t value) {
+  _internal_set_geometry_parallel_threshold(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.geometry_parallel_threshold)
+}
+
+// optional int32 scheduler_threads = 26 [default = 1];
+inline bool Parameters_General::_internal_has_scheduler_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_scheduler_threads() const {
+  return _internal_has_scheduler_threads();
+}
+inline void Parameters_General::clear_scheduler_threads() {
+  _impl_.scheduler_threads_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t Parameters_General::_internal_scheduler_threads() const {
+  return _impl_.scheduler_threads_;
+}
+inline int32_t Parameters_General::scheduler_threads() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.scheduler_threads)
+  return _internal_scheduler_threads();
+}
+inline void Parameters_General::_internal_set_scheduler_threads(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.scheduler_threads_ = value;
+}
+inline void Parameters_General::set_scheduler_threads(int32_t value) {
+  _internal_set_scheduler_threads(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.scheduler_threads)
+}
+
+// optional bool scheduler_pin_threads = 27 [default = false];
+inline bool Parameters_General::_internal_has_scheduler_pin_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Parameters_General::has_scheduler_pin_threads() const {
+  return _internal_has_scheduler_pin_threads();
+}
+inline void Parameters_General::clear_scheduler_pin_threads() {
+  _impl_.scheduler_pin_threads_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool Parameters_General::_internal_scheduler_pin_threads() const {
+  return _impl_.scheduler_pin_threads_;
+}
+inline bool Parameters_General::scheduler_pin_threads() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.General.scheduler_pin_threads)
+  return _internal_scheduler_pin_threads();
+}
+inline void Parameters_General::_internal_set_scheduler_pin_threads(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.scheduler_pin_threads_ = value;
+}
+inline void Parameters_General::set_scheduler_pin_threads(bool value) {
+  _internal_set_scheduler_pin_threads(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.General.scheduler_pin_threads)
+}
+
+// -------------------------------------------------------------------
+
+// Parameters_Defense
+
+// optional double time_to_launch_rocket = 1 [default = 3000];
+inline bool Parameters_Defense::_internal_has_time_to_launch_rocket() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Parameters_Defense::has_time_to_launch_rocket() const {
+  return _internal_has_time_to_launch_rocket();
+}
+inline void Parameters_Defense::clear_time_to_launch_rocket() {
+  _impl_.time_to_launch_rocket_ = 3000;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double Parameters_Defense::_internal_time_to_launch_rocket() const {
+  return _impl_.time_to_launch_rocket_;
+}
+inline double Parameters_Defense::time_to_launch_rocket() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Defense.time_to_launch_rocket)
+  return _internal_time_to_launch_rocket();
+}
+inline void Parameters_Defense::_internal_set_time_to_launch_rocket(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.time_to_launch_rocket_ = value;
+}
+inline void Parameters_Defense::set_time_to_launch_rocket(double value) {
+  _internal_set_time_to_launch_rocket(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Defense.time_to_launch_rocket)
+}
+
+// optional double rocket_speed = 2 [default = 5];
+inline bool Parameters_Defense::_internal_has_rocket_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Parameters_Defense::has_rocket_speed() const {
+  return _internal_has_rocket_speed();
+}
+inline void Parameters_Defense::clear_rocket_speed() {
+  _impl_.rocket_speed_ = 5;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Parameters_Defense::_internal_rocket_speed() const {
+  return _impl_.rocket_speed_;
+}
+inline double Parameters_Defense::rocket_speed() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Defense.rocket_speed)
+  return _internal_rocket_speed();
+}
+inline void Parameters_Defense::_internal_set_rocket_speed(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.rocket_speed_ = value;
+}
+inline void Parameters_Defense::set_rocket_speed(double value) {
+  _internal_set_rocket_speed(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Defense.rocket_speed)
+}
+
+// optional uint32 launchers_count = 3;
+inline bool Parameters_Defense::_internal_has_launchers_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Parameters_Defense::has_launchers_count() const {
+  return _internal_has_launchers_count();
+}
+inline void Parameters_Defense::clear_launchers_count() {
+  _impl_.launchers_count_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Parameters_Defense::_internal_launchers_count() const {
+  return _impl_.launchers_count_;
+}
+inline uint32_t Parameters_Defense::launchers_count() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Defense.launchers_count)
+  return _internal_launchers_count();
+}
+inline void Parameters_Defense::_internal_set_launchers_count(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.launchers_count_ = value;
+}
+inline void Parameters_Defense::set_launchers_count(uint32_t value) {
+  _internal_set_launchers_count(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Defense.launchers_count)
+}
+
+// optional double reload_time = 4 [default = 5000];
+inline bool Parameters_Defense::_internal_has_reload_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Parameters_Defense::has_reload_time() const {
+  return _internal_has_reload_time();
+}
+inline void Parameters_Defense::clear_reload_time() {
+  _impl_.reload_time_ = 5000;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double Parameters_Defense::_internal_reload_time() const {
+  return _impl_.reload_time_;
+}
+inline double Parameters_Defense::reload_time() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Defense.reload_time)
+  return _internal_reload_time();
+}
+inline void Parameters_Defense::_internal_set_reload_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.reload_time_ = value;
+}
+inline void Parameters_Defense::set_reload_time(double value) {
+  _internal_set_reload_time(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Defense.reload_time)
+}
+
+// optional uint32 magazine_size = 5 [default = 0];
+inline bool Parameters_Defense::_internal_has_magazine_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Parameters_Defense::has_magazine_size() const {
+  return _internal_has_magazine_size();
+}
+inline void Parameters_Defense::clear_magazine_size() {
+  _impl_.magazine_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Parameters_Defense::_internal_magazine_size() const {
+  return _impl_.magazine_size_;
+}
+inline uint32_t Parameters_Defense::magazine_size() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Defense.magazine_size)
+  return _internal_magazine_size();
+}
+inline void Parameters_Defense::_internal_set_magazine_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.magazine_size_ = value;
+}
+inline void Parameters_Defense::set_magazine_size(uint32_t value) {
+  _internal_set_magazine_size(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Defense.magazine_size)
+}
+
+// optional uint32 planned_launches_per_launcher = 6 [default = 3];
+inline bool Parameters_Defense::_internal_has_planned_launches_per_launcher() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Parameters_Defense::has_planned_launches_per_launcher() const {
+  return _internal_has_planned_launches_per_launcher();
+}
+inline void Parameters_Defense::clear_planned_launches_per_launcher() {
+  _impl_.planned_launches_per_launcher_ = 3u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t Parameters_Defense::_internal_planned_launches_per_launcher() const {
+  return _impl_.planned_launches_per_launcher_;
+}
+inline uint32_t Parameters_Defense::planned_launches_per_launcher() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Defense.planned_launches_per_launcher)
+  return _internal_planned_launches_per_launcher();
+}
+inline void Parameters_Defense::_internal_set_planned_launches_per_launcher(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.planned_launches_per_launcher_ = value;
+}
+inline void Parameters_Defense::set_planned_launches_per_launcher(uint32_t value) {
+  _internal_set_planned_launches_per_launcher(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Defense.planned_launches_per_launcher)
+}
+
+// optional double kill_radius = 7 [default = 10];
+inline bool Parameters_Defense::_internal_has_kill_radius() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Parameters_Defense::has_kill_radius() const {
+  return _internal_has_kill_radius();
+}
+inline void Parameters_Defense::clear_kill_radius() {
+  _impl_.kill_radius_ = 10;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double Parameters_Defense::_internal_kill_radius() const {
+  return _impl_.kill_radius_;
+}
+inline double Parameters_Defense::kill_radius() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Defense.kill_radius)
+  return _internal_kill_radius();
+}
+inline void Parameters_Defense::_internal_set_kill_radius(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.kill_radius_ = value;
+}
+inline void Parameters_Defense::set_kill_radius(double value) {
+  _internal_set_kill_radius(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Defense.kill_radius)
+}
+
+// -------------------------------------------------------------------
+
+// Parameters_Simulator
+
+// optional uint32 targets_per_minute = 1 [default = 3];
+inline bool Parameters_Simulator::_internal_has_targets_per_minute() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Parameters_Simulator::has_targets_per_minute() const {
+  return _internal_has_targets_per_minute();
+}
+inline void Parameters_Simulator::clear_targets_per_minute() {
+  _impl_.targets_per_minute_ = 3u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Parameters_Simulator::_internal_targets_per_minute() const {
+  return _impl_.targets_per_minute_;
+}
+inline uint32_t Parameters_Simulator::targets_per_minute() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Simulator.targets_per_minute)
+  return _internal_targets_per_minute();
+}
+inline void Parameters_Simulator::_internal_set_targets_per_minute(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.targets_per_minute_ = value;
+}
+inline void Parameters_Simulator::set_targets_per_minute(uint32_t value) {
+  _internal_set_targets_per_minute(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Simulator.targets_per_minute)
+}
+
+// optional double min_target_speed = 2 [default = 1];
+inline bool Parameters_Simulator::_internal_has_min_target_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Parameters_Simulator::has_min_target_speed() const {
+  return _internal_has_min_target_speed();
+}
+inline void Parameters_Simulator::clear_min_target_speed() {
+  _impl_.min_target_speed_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double Parameters_Simulator::_internal_min_target_speed() const {
+  return _impl_.min_target_speed_;
+}
+inline double Parameters_Simulator::min_target_speed() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Simulator.min_target_speed)
+  return _internal_min_target_speed();
+}
+inline void Parameters_Simulator::_internal_set_min_target_speed(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.min_target_speed_ = value;
+}
+inline void Parameters_Simulator::set_min_target_speed(double value) {
+  _internal_set_min_target_speed(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Simulator.min_target_speed)
+}
+
+// optional double max_target_speed = 3 [default = 2];
+inline bool Parameters_Simulator::_internal_has_max_target_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Parameters_Simulator::has_max_target_speed() const {
+  return _internal_has_max_target_speed();
+}
+inline void Parameters_Simulator::clear_max_target_speed() {
+  _impl_.max_target_speed_ = 2;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double Parameters_Simulator::_internal_max_target_speed() const {
+  return _impl_.max_target_speed_;
+}
+inline double Parameters_Simulator::max_target_speed() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Simulator.max_target_speed)
+  return _internal_max_target_speed();
+}
+inline void Parameters_Simulator::_internal_set_max_target_speed(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.max_target_speed_ = value;
+}
+inline void Parameters_Simulator::set_max_target_speed(double value) {
+  _internal_set_max_target_speed(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Simulator.max_target_speed)
+}
+
+// required double max_height = 4;
+inline bool Parameters_Simulator::_internal_has_max_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Parameters_Simulator::has_max_height() const {
+  return _internal_has_max_height();
+}
+inline void Parameters_Simulator::clear_max_height() {
+  _impl_.max_height_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double Parameters_Simulator::_internal_max_height() const {
+  return _impl_.max_height_;
+}
+inline double Parameters_Simulator::max_height() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Simulator.max_height)
+  return _internal_max_height();
+}
+inline void Parameters_Simulator::_internal_set_max_height(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.max_height_ = value;
+}
+inline void Parameters_Simulator::set_max_height(double value) {
+  _internal_set_max_height(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Simulator.max_height)
+}
+
+// optional double max_deviation_angle_vertical = 5 [default = 15];
+inline bool Parameters_Simulator::_internal_has_max_deviation_angle_vertical() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Parameters_Simulator::has_max_deviation_angle_vertical() const {
+  return _internal_has_max_deviation_angle_vertical();
+}
+inline void Parameters_Simulator::clear_max_deviation_angle_vertical() {
+  _impl_.max_deviation_angle_vertical_ = 15;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double Parameters_Simulator::_internal_max_deviation_angle_vertical() const {
+  return _impl_.max_deviation_angle_vertical_;
+}
+inline double Parameters_Simulator::max_deviation_angle_vertical() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Simulator.max_deviation_angle_vertical)
+  return _internal_max_deviation_angle_vertical();
+}
+inline void Parameters_Simulator::_internal_set_max_deviation_angle_vertical(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.max_deviation_angle_vertical_ = value;
+}
+inline void Parameters_Simulator::set_max_deviation_angle_vertical(double value) {
+  _internal_set_max_deviation_angle_vertical(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Simulator.max_deviation_angle_vertical)
+}
+
+// optional double probability_of_accurate_missile = 6 [default = 0.4];
+inline bool Parameters_Simulator::_internal_has_probability_of_accurate_missile() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Parameters_Simulator::has_probability_of_accurate_missile() const {
+  return _internal_has_probability_of_accurate_missile();
+}
+inline void Parameters_Simulator::clear_probability_of_accurate_missile() {
+  _impl_.probability_of_accurate_missile_ = 0.4;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double Parameters_Simulator::_internal_probability_of_accurate_missile() const {
+  return _impl_.probability_of_accurate_missile_;
+}
+inline double Parameters_Simulator::probability_of_accurate_missile() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Simulator.probability_of_accurate_missile)
+  return _internal_probability_of_accurate_missile();
+}
+inline void Parameters_Simulator::_internal_set_probability_of_accurate_missile(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.probability_of_accurate_missile_ = value;
+}
+inline void Parameters_Simulator::set_probability_of_accurate_missile(double value) {
+  _internal_set_probability_of_accurate_missile(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Simulator.probability_of_accurate_missile)
+}
+
+// optional uint32 random_seed = 7;
+inline bool Parameters_Simulator::_internal_has_random_seed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Parameters_Simulator::has_random_seed() const {
+  return _internal_has_random_seed();
+}
+inline void Parameters_Simulator::clear_random_seed() {
+  _impl_.random_seed_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Parameters_Simulator::_internal_random_seed() const {
+  return _impl_.random_seed_;
+}
+inline uint32_t Parameters_Simulator::random_seed() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Simulator.random_seed)
+  return _internal_random_seed();
+}
+inline void Parameters_Simulator::_internal_set_random_seed(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.random_seed_ = value;
+}
+inline void Parameters_Simulator::set_random_seed(uint32_t value) {
+  _internal_set_random_seed(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Simulator.random_seed)
+}
+
+// optional bool strip_ids = 8 [default = false];
+inline bool Parameters_Simulator::_internal_has_strip_ids() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Parameters_Simulator::has_strip_ids() const {
+  return _internal_has_strip_ids();
+}
+inline void Parameters_Simulator::clear_strip_ids() {
+  _impl_.strip_ids_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Parameters_Simulator::_internal_strip_ids() const {
+  return _impl_.strip_ids_;
+}
+inline bool Parameters_Simulator::strip_ids() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Simulator.strip_ids)
+  return _internal_strip_ids();
+}
+inline void Parameters_Simulator::_internal_set_strip_ids(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.strip_ids_ = value;
+}
+inline void Parameters_Simulator::set_strip_ids(bool value) {
+  _internal_set_strip_ids(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Simulator.strip_ids)
+}
+
+// -------------------------------------------------------------------
+
+// Parameters_Visualizer
+
+// optional uint32 radars_outline_thickness = 1 [default = 1];
+inline bool Parameters_Visualizer::_internal_has_radars_outline_thickness() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Parameters_Visualizer::has_radars_outline_thickness() const {
+  return _internal_has_radars_outline_thickness();
+}
+inline void Parameters_Visualizer::clear_radars_outline_thickness() {
+  _impl_.radars_outline_thickness_ = 1u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t Parameters_Visualizer::_internal_radars_outline_thickness() const {
+  return _impl_.radars_outline_thickness_;
+}
+inline uint32_t Parameters_Visualizer::radars_outline_thickness() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Visualizer.radars_outline_thickness)
+  return _internal_radars_outline_thickness();
+}
+inline void Parameters_Visualizer::_internal_set_radars_outline_thickness(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.radars_outline_thickness_ = value;
+}
+inline void Parameters_Visualizer::set_radars_outline_thickness(uint32_t value) {
+  _internal_set_radars_outline_thickness(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Visualizer.radars_outline_thickness)
+}
+
+// optional uint32 target_radius = 2 [default = 5];
+inline bool Parameters_Visualizer::_internal_has_target_radius() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Parameters_Visualizer::has_target_radius() const {
+  return _internal_has_target_radius();
+}
+inline void Parameters_Visualizer::clear_target_radius() {
+  _impl_.target_radius_ = 5u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Parameters_Visualizer::_internal_target_radius() const {
+  return _impl_.target_radius_;
+}
+inline uint32_t Parameters_Visualizer::target_radius() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Visualizer.target_radius)
+  return _internal_target_radius();
+}
+inline void Parameters_Visualizer::_internal_set_target_radius(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.target_radius_ = value;
+}
+inline void Parameters_Visualizer::set_target_radius(uint32_t value) {
+  _internal_set_target_radius(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Visualizer.target_radius)
+}
+
+// optional bool draw_entry_points = 3 [default = false];
+inline bool Parameters_Visualizer::_internal_has_draw_entry_points() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Parameters_Visualizer::has_draw_entry_points() const {
+  return _internal_has_draw_entry_points();
+}
+inline void Parameters_Visualizer::clear_draw_entry_points() {
+  _impl_.draw_entry_points_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool Parameters_Visualizer::_internal_draw_entry_points() const {
+  return _impl_.draw_entry_points_;
+}
+inline bool Parameters_Visualizer::draw_entry_points() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Visualizer.draw_entry_points)
+  return _internal_draw_entry_points();
+}
+inline void Parameters_Visualizer::_internal_set_draw_entry_points(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.draw_entry_points_ = value;
+}
+inline void Parameters_Visualizer::set_draw_entry_points(bool value) {
+  _internal_set_draw_entry_points(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Visualizer.draw_entry_points)
+}
+
+// optional uint32 fps = 4 [default = 60];
+inline bool Parameters_Visualizer::_internal_has_fps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Parameters_Visualizer::has_fps() const {
+  return _internal_has_fps();
+}
+inline void Parameters_Visualizer::clear_fps() {
+  _impl_.fps_ = 60u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Parameters_Visualizer::_internal_fps() const {
+  return _impl_.fps_;
+}
+inline uint32_t Parameters_Visualizer::fps() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.Visualizer.fps)
+  return _internal_fps();
+}
+inline void Parameters_Visualizer::_internal_set_fps(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.fps_ = value;
+}
+inline void Parameters_Visualizer::set_fps(uint32_t value) {
+  _internal_set_fps(value);
+  // @@protoc_insertion_point(field_set:Proto.Parameters.Visualizer.fps)
+}
+
+// -------------------------------------------------------------------
+
+// Parameters
+
+// required .Proto.Parameters.SmallRadar small_radar = 1;
+inline bool Parameters::_internal_has_small_radar() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.small_radar_ != nullptr);
+  return value;
+}
+inline bool Parameters::has_small_radar() const {
+  return _internal_has_small_radar();
+}
+inline void Parameters::clear_small_radar() {
+  if (_impl_.small_radar_ != nullptr) _impl_.small_radar_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Proto::Parameters_SmallRadar& Parameters::_internal_small_radar() const {
+  const ::Proto::Parameters_SmallRadar* p = _impl_.small_radar_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Proto::Parameters_SmallRadar&>(
+      ::Proto::_Parameters_SmallRadar_default_instance_);
+}
+inline const ::Proto::Parameters_SmallRadar& Parameters::small_radar() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.small_radar)
+  return _internal_small_radar();
+}
+inline void Parameters::unsafe_arena_set_allocated_small_radar(
+    ::Proto::Parameters_SmallRadar* small_radar) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.small_radar_);
+  }
+  _impl_.small_radar_ = small_radar;
+  if (small_radar) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Proto.Parameters.small_radar)
+}
+inline ::Proto::Parameters_SmallRadar* Parameters::release_small_radar() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Proto::Parameters_SmallRadar* temp = _impl_.small_radar_;
+  _impl_.small_radar_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Proto::Parameters_SmallRadar* Parameters::unsafe_arena_release_small_radar() {
+  // @@protoc_insertion_point(field_release:Proto.Parameters.small_radar)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Proto::Parameters_SmallRadar* temp = _impl_.small_radar_;
+  _impl_.small_radar_ = nullptr;
+  return temp;
+}
+inline ::Proto::Parameters_SmallRadar* Parameters::_internal_mutable_small_radar() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.small_radar_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Proto::Parameters_SmallRadar>(GetArenaForAllocation());
+    _impl_.small_radar_ = p;
+  }
+  return _impl_.small_radar_;
+}
+inline ::Proto::Parameters_SmallRadar* Parameters::mutable_small_radar() {
+  ::Proto::Parameters_SmallRadar* _msg = _internal_mutable_small_radar();
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.small_radar)
+  return _msg;
+}
+inline void Parameters::set_allocated_small_radar(::Proto::Parameters_SmallRadar* small_radar) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.small_radar_;
+  }
+  if (small_radar) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(small_radar);
+    if (message_arena != submessage_arena) {
+      small_radar = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, small_radar, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.small_radar_ = small_radar;
+  // @@protoc_insertion_point(field_set_allocated:Proto.Parameters.small_radar)
+}
+
+// required .Proto.Parameters.BigRadar big_radar = 2;
+inline bool Parameters::_internal_has_big_radar() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.big_radar_ != nullptr);
+  return value;
+}
+inline bool Parameters::has_big_radar() const {
+  return _internal_has_big_radar();
+}
+inline void Parameters::clear_big_radar() {
+  if (_impl_.big_radar_ != nullptr) _impl_.big_radar_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Proto::Parameters_BigRadar& Parameters::_internal_big_radar() const {
+  const ::Proto::Parameters_BigRadar* p = _impl_.big_radar_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Proto::Parameters_BigRadar&>(
+      ::Proto::_Parameters_BigRadar_default_instance_);
+}
+inline const ::Proto::Parameters_BigRadar& Parameters::big_radar() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.big_radar)
+  return _internal_big_radar();
+}
+inline void Parameters::unsafe_arena_set_allocated_big_radar(
+    ::Proto::Parameters_BigRadar* big_radar) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.big_radar_);
+  }
+  _impl_.big_radar_ = big_radar;
+  if (big_radar) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Proto.Parameters.big_radar)
+}
+inline ::Proto::Parameters_BigRadar* Parameters::release_big_radar() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Proto::Parameters_BigRadar* temp = _impl_.big_radar_;
+  _impl_.big_radar_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Proto::Parameters_BigRadar* Parameters::unsafe_arena_release_big_radar() {
+  // @@protoc_insertion_point(field_release:Proto.Parameters.big_radar)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Proto::Parameters_BigRadar* temp = _impl_.big_radar_;
+  _impl_.big_radar_ = nullptr;
+  return temp;
+}
+inline ::Proto::Parameters_BigRadar* Parameters::_internal_mutable_big_radar() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.big_radar_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Proto::Parameters_BigRadar>(GetArenaForAllocation());
+    _impl_.big_radar_ = p;
+  }
+  return _impl_.big_radar_;
+}
+inline ::Proto::Parameters_BigRadar* Parameters::mutable_big_radar() {
+  ::Proto::Parameters_BigRadar* _msg = _internal_mutable_big_radar();
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.big_radar)
+  return _msg;
+}
+inline void Parameters::set_allocated_big_radar(::Proto::Parameters_BigRadar* big_radar) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.big_radar_;
+  }
+  if (big_radar) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(big_radar);
+    if (message_arena != submessage_arena) {
+      big_radar = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, big_radar, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.big_radar_ = big_radar;
+  // @@protoc_insertion_point(field_set_allocated:Proto.Parameters.big_radar)
+}
+
+// required .Proto.Parameters.Ship ship = 3;
+inline bool Parameters::_internal_has_ship() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.ship_ != nullptr);
+  return value;
+}
+inline bool Parameters::has_ship() const {
+  return _internal_has_ship();
+}
+inline void Parameters::clear_ship() {
+  if (_impl_.ship_ != nullptr) _impl_.ship_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Proto::Parameters_Ship& Parameters::_internal_ship() const {
+  const ::Proto::Parameters_Ship* p = _impl_.ship_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Proto::Parameters_Ship&>(
+      ::Proto::_Parameters_Ship_default_instance_);
+}
+inline const ::Proto::Parameters_Ship& Parameters::ship() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.ship)
+  return _internal_ship();
+}
+inline void Parameters::unsafe_arena_set_allocated_ship(
+    ::Proto::Parameters_Ship* ship) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ship_);
+  }
+  _impl_.ship_ = ship;
+  if (ship) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Proto.Parameters.ship)
+}
+inline ::Proto::Parameters_Ship* Parameters::release_ship() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Proto::Parameters_Ship* temp = _impl_.ship_;
+  _impl_.ship_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Proto::Parameters_Ship* Parameters::unsafe_arena_release_ship() {
+  // @@protoc_insertion_point(field_release:Proto.Parameters.ship)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Proto::Parameters_Ship* temp = _impl_.ship_;
+  _impl_.ship_ = nullptr;
+  return temp;
+}
+inline ::Proto::Parameters_Ship* Parameters::_internal_mutable_ship() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.ship_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Proto::Parameters_Ship>(GetArenaForAllocation());
+    _impl_.ship_ = p;
+  }
+  return _impl_.ship_;
+}
+inline ::Proto::Parameters_Ship* Parameters::mutable_ship() {
+  ::Proto::Parameters_Ship* _msg = _internal_mutable_ship();
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.ship)
+  return _msg;
+}
+inline void Parameters::set_allocated_ship(::Proto::Parameters_Ship* ship) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ship_;
+  }
+  if (ship) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ship);
+    if (message_arena != submessage_arena) {
+      ship = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ship, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.ship_ = ship;
+  // @@protoc_insertion_point(field_set_allocated:Proto.Parameters.ship)
+}
+
+// required .Proto.Parameters.General general = 4;
+inline bool Parameters::_internal_has_general() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.general_ != nullptr);
+  return value;
+}
+inline bool Parameters::has_general() const {
+  return _internal_has_general();
+}
+inline void Parameters::clear_general() {
+  if (_impl_.general_ != nullptr) _impl_.general_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::Proto::Parameters_General& Parameters::_internal_general() const {
+  const ::Proto::Parameters_General* p = _impl_.general_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Proto::Parameters_General&>(
+      ::Proto::_Parameters_General_default_instance_);
+}
+inline const ::Proto::Parameters_General& Parameters::general() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.general)
+  return _internal_general();
+}
+inline void Parameters::unsafe_arena_set_allocated_general(
+    ::Proto::Parameters_General* general) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.general_);
+  }
+  _impl_.general_ = general;
+  if (general) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Proto.Parameters.general)
+}
+inline ::Proto::Parameters_General* Parameters::release_general() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Proto::Parameters_General* temp = _impl_.general_;
+  _impl_.general_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Proto::Parameters_General* Parameters::unsafe_arena_release_general() {
+  // @@protoc_insertion_point(field_release:Proto.Parameters.general)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Proto::Parameters_General* temp = _impl_.general_;
+  _impl_.general_ = nullptr;
+  return temp;
+}
+inline ::Proto::Parameters_General* Parameters::_internal_mutable_general() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.general_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Proto::Parameters_General>(GetArenaForAllocation());
+    _impl_.general_ = p;
+  }
+  return _impl_.general_;
+}
+inline ::Proto::Parameters_General* Parameters::mutable_general() {
+  ::Proto::Parameters_General* _msg = _internal_mutable_general();
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.general)
+  return _msg;
+}
+inline void Parameters::set_allocated_general(::Proto::Parameters_General* general) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.general_;
+  }
+  if (general) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(general);
+    if (message_arena != submessage_arena) {
+      general = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, general, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.general_ = general;
+  // @@protoc_insertion_point(field_set_allocated:Proto.Parameters.general)
+}
+
+// required .Proto.Parameters.Defense defense = 5;
+inline bool Parameters::_internal_has_defense() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.defense_ != nullptr);
+  return value;
+}
+inline bool Parameters::has_defense() const {
+  return _internal_has_defense();
+}
+inline void Parameters::clear_defense() {
+  if (_impl_.defense_ != nullptr) _impl_.defense_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::Proto::Parameters_Defense& Parameters::_internal_defense() const {
+  const ::Proto::Parameters_Defense* p = _impl_.defense_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Proto::Parameters_Defense&>(
+      ::Proto::_Parameters_Defense_default_instance_);
+}
+inline const ::Proto::Parameters_Defense& Parameters::defense() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.defense)
+  return _internal_defense();
+}
+inline void Parameters::unsafe_arena_set_allocated_defense(
+    ::Proto::Parameters_Defense* defense) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.defense_);
+  }
+  _impl_.defense_ = defense;
+  if (defense) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Proto.Parameters.defense)
+}
+inline ::Proto::Parameters_Defense* Parameters::release_defense() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::Proto::Parameters_Defense* temp = _impl_.defense_;
+  _impl_.defense_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Proto::Parameters_Defense* Parameters::unsafe_arena_release_defense() {
+  // @@protoc_insertion_point(field_release:Proto.Parameters.defense)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::Proto::Parameters_Defense* temp = _impl_.defense_;
+  _impl_.defense_ = nullptr;
+  return temp;
+}
+inline ::Proto::Parameters_Defense* Parameters::_internal_mutable_defense() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.defense_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Proto::Parameters_Defense>(GetArenaForAllocation());
+    _impl_.defense_ = p;
+  }
+  return _impl_.defense_;
+}
+inline ::Proto::Parameters_Defense* Parameters::mutable_defense() {
+  ::Proto::Parameters_Defense* _msg = _internal_mutable_defense();
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.defense)
+  return _msg;
+}
+inline void Parameters::set_allocated_defense(::Proto::Parameters_Defense* defense) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.defense_;
+  }
+  if (defense) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(defense);
+    if (message_arena != submessage_arena) {
+      defense = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, defense, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.defense_ = defense;
+  // @@protoc_insertion_point(field_set_allocated:Proto.Parameters.defense)
+}
+
+// required .Proto.Parameters.Simulator simulator = 6;
+inline bool Parameters::_internal_has_simulator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.simulator_ != nullptr);
+  return value;
+}
+inline bool Parameters::has_simulator() const {
+  return _internal_has_simulator();
+}
+inline void Parameters::clear_simulator() {
+  if (_impl_.simulator_ != nullptr) _impl_.simulator_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::Proto::Parameters_Simulator& Parameters::_internal_simulator() const {
+  const ::Proto::Parameters_Simulator* p = _impl_.simulator_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Proto::Parameters_Simulator&>(
+      ::Proto::_Parameters_Simulator_default_instance_);
+}
+inline const ::Proto::Parameters_Simulator& Parameters::simulator() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.simulator)
+  return _internal_simulator();
+}
+inline void Parameters::unsafe_arena_set_allocated_simulator(
+    ::Proto::Parameters_Simulator* simulator) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.simulator_);
+  }
+  _impl_.simulator_ = simulator;
+  if (simulator) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Proto.Parameters.simulator)
+}
+inline ::Proto::Parameters_Simulator* Parameters::release_simulator() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::Proto::Parameters_Simulator* temp = _impl_.simulator_;
+  _impl_.simulator_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Proto::Parameters_Simulator* Parameters::unsafe_arena_release_simulator() {
+  // @@protoc_insertion_point(field_release:Proto.Parameters.simulator)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::Proto::Parameters_Simulator* temp = _impl_.simulator_;
+  _impl_.simulator_ = nullptr;
+  return temp;
+}
+inline ::Proto::Parameters_Simulator* Parameters::_internal_mutable_simulator() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.simulator_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Proto::Parameters_Simulator>(GetArenaForAllocation());
+    _impl_.simulator_ = p;
+  }
+  return _impl_.simulator_;
+}
+inline ::Proto::Parameters_Simulator* Parameters::mutable_simulator() {
+  ::Proto::Parameters_Simulator* _msg = _internal_mutable_simulator();
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.simulator)
+  return _msg;
+}
+inline void Parameters::set_allocated_simulator(::Proto::Parameters_Simulator* simulator) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.simulator_;
+  }
+  if (simulator) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(simulator);
+    if (message_arena != submessage_arena) {
+      simulator = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, simulator, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.simulator_ = simulator;
+  // @@protoc_insertion_point(field_set_allocated:Proto.Parameters.simulator)
+}
+
+// required .Proto.Parameters.Visualizer visualizer = 7;
+inline bool Parameters::_internal_has_visualizer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.visualizer_ != nullptr);
+  return value;
+}
+inline bool Parameters::has_visualizer() const {
+  return _internal_has_visualizer();
+}
+inline void Parameters::clear_visualizer() {
+  if (_impl_.visualizer_ != nullptr) _impl_.visualizer_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::Proto::Parameters_Visualizer& Parameters::_internal_visualizer() const {
+  const ::Proto::Parameters_Visualizer* p = _impl_.visualizer_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Proto::Parameters_Visualizer&>(
+      ::Proto::_Parameters_Visualizer_default_instance_);
+}
+inline const ::Proto::Parameters_Visualizer& Parameters::visualizer() const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.visualizer)
+  return _internal_visualizer();
+}
+inline void Parameters::unsafe_arena_set_allocated_visualizer(
+    ::Proto::Parameters_Visualizer* visualizer) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.visualizer_);
+  }
+  _impl_.visualizer_ = visualizer;
+  if (visualizer) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Proto.Parameters.visualizer)
+}
+inline ::Proto::Parameters_Visualizer* Parameters::release_visualizer() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::Proto::Parameters_Visualizer* temp = _impl_.visualizer_;
+  _impl_.visualizer_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Proto::Parameters_Visualizer* Parameters::unsafe_arena_release_visualizer() {
+  // @@protoc_insertion_point(field_release:Proto.Parameters.visualizer)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::Proto::Parameters_Visualizer* temp = _impl_.visualizer_;
+  _impl_.visualizer_ = nullptr;
+  return temp;
+}
+inline ::Proto::Parameters_Visualizer* Parameters::_internal_mutable_visualizer() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.visualizer_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Proto::Parameters_Visualizer>(GetArenaForAllocation());
+    _impl_.visualizer_ = p;
+  }
+  return _impl_.visualizer_;
+}
+inline ::Proto::Parameters_Visualizer* Parameters::mutable_visualizer() {
+  ::Proto::Parameters_Visualizer* _msg = _internal_mutable_visualizer();
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.visualizer)
+  return _msg;
+}
+inline void Parameters::set_allocated_visualizer(::Proto::Parameters_Visualizer* visualizer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.visualizer_;
+  }
+  if (visualizer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(visualizer);
+    if (message_arena != submessage_arena) {
+      visualizer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, visualizer, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.visualizer_ = visualizer;
+  // @@protoc_insertion_point(field_set_allocated:Proto.Parameters.visualizer)
+}
+
+// repeated .Proto.Parameters.SmallRadar extra_small_radars = 8;
+inline int Parameters::_internal_extra_small_radars_size() const {
+  return _impl_.extra_small_radars_.size();
+}
+inline int Parameters::extra_small_radars_size() const {
+  return _internal_extra_small_radars_size();
+}
+inline void Parameters::clear_extra_small_radars() {
+  _impl_.extra_small_radars_.Clear();
+}
+inline ::Proto::Parameters_SmallRadar* Parameters::mutable_extra_small_radars(int index) {
+  // @@protoc_insertion_point(field_mutable:Proto.Parameters.extra_small_radars)
+  return _impl_.extra_small_radars_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_SmallRadar >*
+Parameters::mutable_extra_small_radars() {
+  // @@protoc_insertion_point(field_mutable_list:Proto.Parameters.extra_small_radars)
+  return &_impl_.extra_small_radars_;
+}
+inline const ::Proto::Parameters_SmallRadar& Parameters::_internal_extra_small_radars(int index) const {
+  return _impl_.extra_small_radars_.Get(index);
+}
+inline const ::Proto::Parameters_SmallRadar& Parameters::extra_small_radars(int index) const {
+  // @@protoc_insertion_point(field_get:Proto.Parameters.extra_small_radars)
+  return _internal_extra_small_radars(index);
+}
+inline ::Proto::Parameters_SmallRadar* Parameters::_internal_add_extra_small_radars() {
+  return _impl_.extra_small_radars_.Add();
+}
+inline ::Proto::Parameters_SmallRadar* Parameters::add_extra_small_radars() {
+  ::Proto::Parameters_SmallRadar* _add = _internal_add_extra_small_radars();
+  // @@protoc_insertion_point(field_add:Proto.Parameters.extra_small_radars)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::Parameters_SmallRadar >&
+Parameters::extra_small_radars() const {
+  // @@protoc_insertion_point(field_list:Proto.Parameters.extra_small_radars)
+  return _impl_.extra_small_radars_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Proto
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::Proto::Parameters_General_TargetSelection> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Proto::Parameters_General_TargetSelection>() {
+  return ::Proto::Parameters_General_TargetSelection_descriptor();
+}
+template <> struct is_proto_enum< ::Proto::Parameters_General_TrackFilter> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Proto::Parameters_General_TrackFilter>() {
+  return ::Proto::Parameters_General_TrackFilter_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_params_2eproto
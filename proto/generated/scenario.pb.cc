@@ -0,0 +1,942 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: scenario.proto
+
+#include "scenario.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Proto {
+PROTOBUF_CONSTEXPR TargetScenario_Launch::TargetScenario_Launch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.time_)*/0
+  , /*decltype(_impl_.angle_pos_)*/0
+  , /*decltype(_impl_.priority_)*/0
+  , /*decltype(_impl_.abs_speed_)*/0
+  , /*decltype(_impl_.abs_speed_share_)*/0
+  , /*decltype(_impl_.angle_deviation_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_.height_share_)*/0
+  , /*decltype(_impl_.is_accurate_)*/false} {}
+struct TargetScenario_LaunchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TargetScenario_LaunchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TargetScenario_LaunchDefaultTypeInternal() {}
+  union {
+    TargetScenario_Launch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TargetScenario_LaunchDefaultTypeInternal _TargetScenario_Launch_default_instance_;
+PROTOBUF_CONSTEXPR TargetScenario::TargetScenario(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.launches_)*/{}
+  , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ship_start_angle_)*/0
+  , /*decltype(_impl_.radar_start_angle_)*/90} {}
+struct TargetScenarioDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TargetScenarioDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TargetScenarioDefaultTypeInternal() {}
+  union {
+    TargetScenario _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TargetScenarioDefaultTypeInternal _TargetScenario_default_instance_;
+}  // namespace Proto
+static ::_pb::Metadata file_level_metadata_scenario_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_scenario_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_scenario_2eproto = nullptr;
+
+const uint32_t TableStruct_scenario_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.angle_pos_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.abs_speed_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.abs_speed_share_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.angle_deviation_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.height_share_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario_Launch, _impl_.is_accurate_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario, _impl_.radar_start_angle_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario, _impl_.ship_start_angle_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::Proto::TargetScenario, _impl_.launches_),
+  2,
+  1,
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::Proto::TargetScenario_Launch)},
+  { 24, 34, -1, sizeof(::Proto::TargetScenario)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Proto::_TargetScenario_Launch_default_instance_._instance,
+  &::Proto::_TargetScenario_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_scenario_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016scenario.proto\022\005Proto\"\321\002\n\016TargetScenar"
+  "io\022\035\n\021radar_start_angle\030\001 \001(\001:\00290\022\033\n\020shi"
+  "p_start_angle\030\002 \001(\001:\0010\022\025\n\013description\030\003 "
+  "\001(\t:\000\022.\n\010launches\030\004 \003(\0132\034.Proto.TargetSc"
+  "enario.Launch\032\273\001\n\006Launch\022\014\n\004time\030\001 \002(\001\022\021"
+  "\n\tangle_pos\030\002 \002(\001\022\020\n\010priority\030\003 \001(\001\022\021\n\ta"
+  "bs_speed\030\004 \001(\001\022\027\n\017abs_speed_share\030\005 \001(\001\022"
+  "\027\n\017angle_deviation\030\006 \001(\001\022\016\n\006height\030\007 \001(\001"
+  "\022\024\n\014height_share\030\010 \001(\001\022\023\n\013is_accurate\030\t "
+  "\001(\010"
+  ;
+static ::_pbi::once_flag descriptor_table_scenario_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_scenario_2eproto = {
+    false, false, 363, descriptor_table_protodef_scenario_2eproto,
+    "scenario.proto",
+    &descriptor_table_scenario_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_scenario_2eproto::offsets,
+    file_level_metadata_scenario_2eproto, file_level_enum_descriptors_scenario_2eproto,
+    file_level_service_descriptors_scenario_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_scenario_2eproto_getter() {
+  return &descriptor_table_scenario_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_scenario_2eproto(&descriptor_table_scenario_2eproto);
+namespace Proto {
+
+// ===================================================================
+
+class TargetScenario_Launch::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TargetScenario_Launch>()._impl_._has_bits_);
+  static void set_has_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_angle_pos(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_priority(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_abs_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_abs_speed_share(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_angle_deviation(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_height_share(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_is_accurate(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+TargetScenario_Launch::TargetScenario_Launch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.TargetScenario.Launch)
+}
+TargetScenario_Launch::TargetScenario_Launch(const TargetScenario_Launch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TargetScenario_Launch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.time_){}
+    , decltype(_impl_.angle_pos_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.abs_speed_){}
+    , decltype(_impl_.abs_speed_share_){}
+    , decltype(_impl_.angle_deviation_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.height_share_){}
+    , decltype(_impl_.is_accurate_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.time_, &from._impl_.time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_accurate_) -
+    reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.is_accurate_));
+  // @@protoc_insertion_point(copy_constructor:Proto.TargetScenario.Launch)
+}
+
+inline void TargetScenario_Launch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.time_){0}
+    , decltype(_impl_.angle_pos_){0}
+    , decltype(_impl_.priority_){0}
+    , decltype(_impl_.abs_speed_){0}
+    , decltype(_impl_.abs_speed_share_){0}
+    , decltype(_impl_.angle_deviation_){0}
+    , decltype(_impl_.height_){0}
+    , decltype(_impl_.height_share_){0}
+    , decltype(_impl_.is_accurate_){false}
+  };
+}
+
+TargetScenario_Launch::~TargetScenario_Launch() {
+  // @@protoc_insertion_point(destructor:Proto.TargetScenario.Launch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TargetScenario_Launch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TargetScenario_Launch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TargetScenario_Launch::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.TargetScenario.Launch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.time_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.height_share_) -
+        reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.height_share_));
+  }
+  _impl_.is_accurate_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TargetScenario_Launch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required double time = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_time(&has_bits);
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double angle_pos = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_angle_pos(&has_bits);
+          _impl_.angle_pos_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double priority = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_priority(&has_bits);
+          _impl_.priority_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double abs_speed = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_abs_speed(&has_bits);
+          _impl_.abs_speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double abs_speed_share = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_abs_speed_share(&has_bits);
+          _impl_.abs_speed_share_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double angle_deviation = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_angle_deviation(&has_bits);
+          _impl_.angle_deviation_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double height = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_height(&has_bits);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double height_share = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_height_share(&has_bits);
+          _impl_.height_share_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_accurate = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_is_accurate(&has_bits);
+          _impl_.is_accurate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TargetScenario_Launch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.TargetScenario.Launch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required double time = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_time(), target);
+  }
+
+  // required double angle_pos = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_angle_pos(), target);
+  }
+
+  // optional double priority = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_priority(), target);
+  }
+
+  // optional double abs_speed = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_abs_speed(), target);
+  }
+
+  // optional double abs_speed_share = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_abs_speed_share(), target);
+  }
+
+  // optional double angle_deviation = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_angle_deviation(), target);
+  }
+
+  // optional double height = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_height(), target);
+  }
+
+  // optional double height_share = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_height_share(), target);
+  }
+
+  // optional bool is_accurate = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_is_accurate(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.TargetScenario.Launch)
+  return target;
+}
+
+size_t TargetScenario_Launch::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Proto.TargetScenario.Launch)
+  size_t total_size = 0;
+
+  if (_internal_has_time()) {
+    // required double time = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_angle_pos()) {
+    // required double angle_pos = 2;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t TargetScenario_Launch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.TargetScenario.Launch)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required double time = 1;
+    total_size += 1 + 8;
+
+    // required double angle_pos = 2;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000fcu) {
+    // optional double priority = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double abs_speed = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double abs_speed_share = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double angle_deviation = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double height = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double height_share = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  // optional bool is_accurate = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TargetScenario_Launch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TargetScenario_Launch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TargetScenario_Launch::GetClassData() const { return &_class_data_; }
+
+
+void TargetScenario_Launch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TargetScenario_Launch*>(&to_msg);
+  auto& from = static_cast<const TargetScenario_Launch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.TargetScenario.Launch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.time_ = from._impl_.time_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.angle_pos_ = from._impl_.angle_pos_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.priority_ = from._impl_.priority_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.abs_speed_ = from._impl_.abs_speed_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.abs_speed_share_ = from._impl_.abs_speed_share_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.angle_deviation_ = from._impl_.angle_deviation_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.height_ = from._impl_.height_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.height_share_ = from._impl_.height_share_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_is_accurate(from._internal_is_accurate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TargetScenario_Launch::CopyFrom(const TargetScenario_Launch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.TargetScenario.Launch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TargetScenario_Launch::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void TargetScenario_Launch::InternalSwap(TargetScenario_Launch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TargetScenario_Launch, _impl_.is_accurate_)
+      + sizeof(TargetScenario_Launch::_impl_.is_accurate_)
+      - PROTOBUF_FIELD_OFFSET(TargetScenario_Launch, _impl_.time_)>(
+          reinterpret_cast<char*>(&_impl_.time_),
+          reinterpret_cast<char*>(&other->_impl_.time_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TargetScenario_Launch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_scenario_2eproto_getter, &descriptor_table_scenario_2eproto_once,
+      file_level_metadata_scenario_2eproto[0]);
+}
+
+// ===================================================================
+
+class TargetScenario::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TargetScenario>()._impl_._has_bits_);
+  static void set_has_radar_start_angle(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ship_start_angle(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_description(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TargetScenario::TargetScenario(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Proto.TargetScenario)
+}
+TargetScenario::TargetScenario(const TargetScenario& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TargetScenario* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.launches_){from._impl_.launches_}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.ship_start_angle_){}
+    , decltype(_impl_.radar_start_angle_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_description()) {
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.ship_start_angle_, &from._impl_.ship_start_angle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.radar_start_angle_) -
+    reinterpret_cast<char*>(&_impl_.ship_start_angle_)) + sizeof(_impl_.radar_start_angle_));
+  // @@protoc_insertion_point(copy_constructor:Proto.TargetScenario)
+}
+
+inline void TargetScenario::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.launches_){arena}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.ship_start_angle_){0}
+    , decltype(_impl_.radar_start_angle_){90}
+  };
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TargetScenario::~TargetScenario() {
+  // @@protoc_insertion_point(destructor:Proto.TargetScenario)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TargetScenario::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.launches_.~RepeatedPtrField();
+  _impl_.description_.Destroy();
+}
+
+void TargetScenario::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TargetScenario::Clear() {
+// @@protoc_insertion_point(message_clear_start:Proto.TargetScenario)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.launches_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.description_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    _impl_.ship_start_angle_ = 0;
+    _impl_.radar_start_angle_ = 90;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TargetScenario::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double radar_start_angle = 1 [default = 90];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_radar_start_angle(&has_bits);
+          _impl_.radar_start_angle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double ship_start_angle = 2 [default = 0];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_ship_start_angle(&has_bits);
+          _impl_.ship_start_angle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string description = 3 [default = ""];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Proto.TargetScenario.description");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Proto.TargetScenario.Launch launches = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_launches(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TargetScenario::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Proto.TargetScenario)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double radar_start_angle = 1 [default = 90];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_radar_start_angle(), target);
+  }
+
+  // optional double ship_start_angle = 2 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_ship_start_angle(), target);
+  }
+
+  // optional string description = 3 [default = ""];
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Proto.TargetScenario.description");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_description(), target);
+  }
+
+  // repeated .Proto.TargetScenario.Launch launches = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_launches_size()); i < n; i++) {
+    const auto& repfield = this->_internal_launches(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Proto.TargetScenario)
+  return target;
+}
+
+size_t TargetScenario::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Proto.TargetScenario)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Proto.TargetScenario.Launch launches = 4;
+  total_size += 1UL * this->_internal_launches_size();
+  for (const auto& msg : this->_impl_.launches_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string description = 3 [default = ""];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_description());
+    }
+
+    // optional double ship_start_angle = 2 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double radar_start_angle = 1 [default = 90];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TargetScenario::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TargetScenario::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TargetScenario::GetClassData() const { return &_class_data_; }
+
+
+void TargetScenario::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TargetScenario*>(&to_msg);
+  auto& from = static_cast<const TargetScenario&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Proto.TargetScenario)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.launches_.MergeFrom(from._impl_.launches_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_description(from._internal_description());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ship_start_angle_ = from._impl_.ship_start_angle_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.radar_start_angle_ = from._impl_.radar_start_angle_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TargetScenario::CopyFrom(const TargetScenario& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Proto.TargetScenario)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TargetScenario::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.launches_))
+    return false;
+  return true;
+}
+
+void TargetScenario::InternalSwap(TargetScenario* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.launches_.InternalSwap(&other->_impl_.launches_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  swap(_impl_.ship_start_angle_, other->_impl_.ship_start_angle_);
+  swap(_impl_.radar_start_angle_, other->_impl_.radar_start_angle_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TargetScenario::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_scenario_2eproto_getter, &descriptor_table_scenario_2eproto_once,
+      file_level_metadata_scenario_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Proto
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Proto::TargetScenario_Launch*
+Arena::CreateMaybeMessage< ::Proto::TargetScenario_Launch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::TargetScenario_Launch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Proto::TargetScenario*
+Arena::CreateMaybeMessage< ::Proto::TargetScenario >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Proto::TargetScenario >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
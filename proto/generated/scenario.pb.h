@@ -0,0 +1,1005 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: scenario.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_scenario_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_scenario_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_scenario_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_scenario_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_scenario_2eproto;
+namespace Proto {
+class TargetScenario;
+struct TargetScenarioDefaultTypeInternal;
+extern TargetScenarioDefaultTypeInternal _TargetScenario_default_instance_;
+class TargetScenario_Launch;
+struct TargetScenario_LaunchDefaultTypeInternal;
+extern TargetScenario_LaunchDefaultTypeInternal _TargetScenario_Launch_default_instance_;
+}  // namespace Proto
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Proto::TargetScenario* Arena::CreateMaybeMessage<::Proto::TargetScenario>(Arena*);
+template<> ::Proto::TargetScenario_Launch* Arena::CreateMaybeMessage<::Proto::TargetScenario_Launch>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Proto {
+
+// ===================================================================
+
+class TargetScenario_Launch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.TargetScenario.Launch) */ {
+ public:
+  inline TargetScenario_Launch() : TargetScenario_Launch(nullptr) {}
+  ~TargetScenario_Launch() override;
+  explicit PROTOBUF_CONSTEXPR TargetScenario_Launch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TargetScenario_Launch(const TargetScenario_Launch& from);
+  TargetScenario_Launch(TargetScenario_Launch&& from) noexcept
+    : TargetScenario_Launch() {
+    *this = ::std::move(from);
+  }
+
+  inline TargetScenario_Launch& operator=(const TargetScenario_Launch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TargetScenario_Launch& operator=(TargetScenario_Launch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TargetScenario_Launch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TargetScenario_Launch* internal_default_instance() {
+    return reinterpret_cast<const TargetScenario_Launch*>(
+               &_TargetScenario_Launch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TargetScenario_Launch& a, TargetScenario_Launch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TargetScenario_Launch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TargetScenario_Launch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TargetScenario_Launch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TargetScenario_Launch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TargetScenario_Launch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TargetScenario_Launch& from) {
+    TargetScenario_Launch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TargetScenario_Launch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.TargetScenario.Launch";
+  }
+  protected:
+  explicit TargetScenario_Launch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeFieldNumber = 1,
+    kAnglePosFieldNumber = 2,
+    kPriorityFieldNumber = 3,
+    kAbsSpeedFieldNumber = 4,
+    kAbsSpeedShareFieldNumber = 5,
+    kAngleDeviationFieldNumber = 6,
+    kHeightFieldNumber = 7,
+    kHeightShareFieldNumber = 8,
+    kIsAccurateFieldNumber = 9,
+  };
+  // required double time = 1;
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  double time() const;
+  void set_time(double value);
+  private:
+  double _internal_time() const;
+  void _internal_set_time(double value);
+  public:
+
+  // required double angle_pos = 2;
+  bool has_angle_pos() const;
+  private:
+  bool _internal_has_angle_pos() const;
+  public:
+  void clear_angle_pos();
+  double angle_pos() const;
+  void set_angle_pos(double value);
+  private:
+  double _internal_angle_pos() const;
+  void _internal_set_angle_pos(double value);
+  public:
+
+  // optional double priority = 3;
+  bool has_priority() const;
+  private:
+  bool _internal_has_priority() const;
+  public:
+  void clear_priority();
+  double priority() const;
+  void set_priority(double value);
+  private:
+  double _internal_priority() const;
+  void _internal_set_priority(double value);
+  public:
+
+  // optional double abs_speed = 4;
+  bool has_abs_speed() const;
+  private:
+  bool _internal_has_abs_speed() const;
+  public:
+  void clear_abs_speed();
+  double abs_speed() const;
+  void set_abs_speed(double value);
+  private:
+  double _internal_abs_speed() const;
+  void _internal_set_abs_speed(double value);
+  public:
+
+  // optional double abs_speed_share = 5;
+  bool has_abs_speed_share() const;
+  private:
+  bool _internal_has_abs_speed_share() const;
+  public:
+  void clear_abs_speed_share();
+  double abs_speed_share() const;
+  void set_abs_speed_share(double value);
+  private:
+  double _internal_abs_speed_share() const;
+  void _internal_set_abs_speed_share(double value);
+  public:
+
+  // optional double angle_deviation = 6;
+  bool has_angle_deviation() const;
+  private:
+  bool _internal_has_angle_deviation() const;
+  public:
+  void clear_angle_deviation();
+  double angle_deviation() const;
+  void set_angle_deviation(double value);
+  private:
+  double _internal_angle_deviation() const;
+  void _internal_set_angle_deviation(double value);
+  public:
+
+  // optional double height = 7;
+  bool has_height() const;
+  private:
+  bool _internal_has_height() const;
+  public:
+  void clear_height();
+  double height() const;
+  void set_height(double value);
+  private:
+  double _internal_height() const;
+  void _internal_set_height(double value);
+  public:
+
+  // optional double height_share = 8;
+  bool has_height_share() const;
+  private:
+  bool _internal_has_height_share() const;
+  public:
+  void clear_height_share();
+  double height_share() const;
+  void set_height_share(double value);
+  private:
+  double _internal_height_share() const;
+  void _internal_set_height_share(double value);
+  public:
+
+  // optional bool is_accurate = 9;
+  bool has_is_accurate() const;
+  private:
+  bool _internal_has_is_accurate() const;
+  public:
+  void clear_is_accurate();
+  bool is_accurate() const;
+  void set_is_accurate(bool value);
+  private:
+  bool _internal_is_accurate() const;
+  void _internal_set_is_accurate(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.TargetScenario.Launch)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double time_;
+    double angle_pos_;
+    double priority_;
+    double abs_speed_;
+    double abs_speed_share_;
+    double angle_deviation_;
+    double height_;
+    double height_share_;
+    bool is_accurate_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_scenario_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TargetScenario final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Proto.TargetScenario) */ {
+ public:
+  inline TargetScenario() : TargetScenario(nullptr) {}
+  ~TargetScenario() override;
+  explicit PROTOBUF_CONSTEXPR TargetScenario(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TargetScenario(const TargetScenario& from);
+  TargetScenario(TargetScenario&& from) noexcept
+    : TargetScenario() {
+    *this = ::std::move(from);
+  }
+
+  inline TargetScenario& operator=(const TargetScenario& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TargetScenario& operator=(TargetScenario&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TargetScenario& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TargetScenario* internal_default_instance() {
+    return reinterpret_cast<const TargetScenario*>(
+               &_TargetScenario_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TargetScenario& a, TargetScenario& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TargetScenario* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TargetScenario* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TargetScenario* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TargetScenario>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TargetScenario& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TargetScenario& from) {
+    TargetScenario::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TargetScenario* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Proto.TargetScenario";
+  }
+  protected:
+  explicit TargetScenario(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TargetScenario_Launch Launch;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLaunchesFieldNumber = 4,
+    kDescriptionFieldNumber = 3,
+    kShipStartAngleFieldNumber = 2,
+    kRadarStartAngleFieldNumber = 1,
+  };
+  // repeated .Proto.TargetScenario.Launch launches = 4;
+  int launches_size() const;
+  private:
+  int _internal_launches_size() const;
+  public:
+  void clear_launches();
+  ::Proto::TargetScenario_Launch* mutable_launches(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::TargetScenario_Launch >*
+      mutable_launches();
+  private:
+  const ::Proto::TargetScenario_Launch& _internal_launches(int index) const;
+  ::Proto::TargetScenario_Launch* _internal_add_launches();
+  public:
+  const ::Proto::TargetScenario_Launch& launches(int index) const;
+  ::Proto::TargetScenario_Launch* add_launches();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::TargetScenario_Launch >&
+      launches() const;
+
+  // optional string description = 3 [default = ""];
+  bool has_description() const;
+  private:
+  bool _internal_has_description() const;
+  public:
+  void clear_description();
+  const std::string& description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_description();
+  PROTOBUF_NODISCARD std::string* release_description();
+  void set_allocated_description(std::string* description);
+  private:
+  const std::string& _internal_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
+  std::string* _internal_mutable_description();
+  public:
+
+  // optional double ship_start_angle = 2 [default = 0];
+  bool has_ship_start_angle() const;
+  private:
+  bool _internal_has_ship_start_angle() const;
+  public:
+  void clear_ship_start_angle();
+  double ship_start_angle() const;
+  void set_ship_start_angle(double value);
+  private:
+  double _internal_ship_start_angle() const;
+  void _internal_set_ship_start_angle(double value);
+  public:
+
+  // optional double radar_start_angle = 1 [default = 90];
+  bool has_radar_start_angle() const;
+  private:
+  bool _internal_has_radar_start_angle() const;
+  public:
+  void clear_radar_start_angle();
+  double radar_start_angle() const;
+  void set_radar_start_angle(double value);
+  private:
+  double _internal_radar_start_angle() const;
+  void _internal_set_radar_start_angle(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Proto.TargetScenario)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::TargetScenario_Launch > launches_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    double ship_start_angle_;
+    double radar_start_angle_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_scenario_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TargetScenario_Launch
+
+// required double time = 1;
+inline bool TargetScenario_Launch::_internal_has_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_time() const {
+  return _internal_has_time();
+}
+inline void TargetScenario_Launch::clear_time() {
+  _impl_.time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double TargetScenario_Launch::_internal_time() const {
+  return _impl_.time_;
+}
+inline double TargetScenario_Launch::time() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.time)
+  return _internal_time();
+}
+inline void TargetScenario_Launch::_internal_set_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.time_ = value;
+}
+inline void TargetScenario_Launch::set_time(double value) {
+  _internal_set_time(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.time)
+}
+
+// required double angle_pos = 2;
+inline bool TargetScenario_Launch::_internal_has_angle_pos() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_angle_pos() const {
+  return _internal_has_angle_pos();
+}
+inline void TargetScenario_Launch::clear_angle_pos() {
+  _impl_.angle_pos_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double TargetScenario_Launch::_internal_angle_pos() const {
+  return _impl_.angle_pos_;
+}
+inline double TargetScenario_Launch::angle_pos() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.angle_pos)
+  return _internal_angle_pos();
+}
+inline void TargetScenario_Launch::_internal_set_angle_pos(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.angle_pos_ = value;
+}
+inline void TargetScenario_Launch::set_angle_pos(double value) {
+  _internal_set_angle_pos(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.angle_pos)
+}
+
+// optional double priority = 3;
+inline bool TargetScenario_Launch::_internal_has_priority() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_priority() const {
+  return _internal_has_priority();
+}
+inline void TargetScenario_Launch::clear_priority() {
+  _impl_.priority_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double TargetScenario_Launch::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline double TargetScenario_Launch::priority() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.priority)
+  return _internal_priority();
+}
+inline void TargetScenario_Launch::_internal_set_priority(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.priority_ = value;
+}
+inline void TargetScenario_Launch::set_priority(double value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.priority)
+}
+
+// optional double abs_speed = 4;
+inline bool TargetScenario_Launch::_internal_has_abs_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_abs_speed() const {
+  return _internal_has_abs_speed();
+}
+inline void TargetScenario_Launch::clear_abs_speed() {
+  _impl_.abs_speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double TargetScenario_Launch::_internal_abs_speed() const {
+  return _impl_.abs_speed_;
+}
+inline double TargetScenario_Launch::abs_speed() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.abs_speed)
+  return _internal_abs_speed();
+}
+inline void TargetScenario_Launch::_internal_set_abs_speed(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.abs_speed_ = value;
+}
+inline void TargetScenario_Launch::set_abs_speed(double value) {
+  _internal_set_abs_speed(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.abs_speed)
+}
+
+// optional double abs_speed_share = 5;
+inline bool TargetScenario_Launch::_internal_has_abs_speed_share() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_abs_speed_share() const {
+  return _internal_has_abs_speed_share();
+}
+inline void TargetScenario_Launch::clear_abs_speed_share() {
+  _impl_.abs_speed_share_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double TargetScenario_Launch::_internal_abs_speed_share() const {
+  return _impl_.abs_speed_share_;
+}
+inline double TargetScenario_Launch::abs_speed_share() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.abs_speed_share)
+  return _internal_abs_speed_share();
+}
+inline void TargetScenario_Launch::_internal_set_abs_speed_share(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.abs_speed_share_ = value;
+}
+inline void TargetScenario_Launch::set_abs_speed_share(double value) {
+  _internal_set_abs_speed_share(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.abs_speed_share)
+}
+
+// optional double angle_deviation = 6;
+inline bool TargetScenario_Launch::_internal_has_angle_deviation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_angle_deviation() const {
+  return _internal_has_angle_deviation();
+}
+inline void TargetScenario_Launch::clear_angle_deviation() {
+  _impl_.angle_deviation_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double TargetScenario_Launch::_internal_angle_deviation() const {
+  return _impl_.angle_deviation_;
+}
+inline double TargetScenario_Launch::angle_deviation() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.angle_deviation)
+  return _internal_angle_deviation();
+}
+inline void TargetScenario_Launch::_internal_set_angle_deviation(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.angle_deviation_ = value;
+}
+inline void TargetScenario_Launch::set_angle_deviation(double value) {
+  _internal_set_angle_deviation(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.angle_deviation)
+}
+
+// optional double height = 7;
+inline bool TargetScenario_Launch::_internal_has_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_height() const {
+  return _internal_has_height();
+}
+inline void TargetScenario_Launch::clear_height() {
+  _impl_.height_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double TargetScenario_Launch::_internal_height() const {
+  return _impl_.height_;
+}
+inline double TargetScenario_Launch::height() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.height)
+  return _internal_height();
+}
+inline void TargetScenario_Launch::_internal_set_height(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.height_ = value;
+}
+inline void TargetScenario_Launch::set_height(double value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.height)
+}
+
+// optional double height_share = 8;
+inline bool TargetScenario_Launch::_internal_has_height_share() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_height_share() const {
+  return _internal_has_height_share();
+}
+inline void TargetScenario_Launch::clear_height_share() {
+  _impl_.height_share_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double TargetScenario_Launch::_internal_height_share() const {
+  return _impl_.height_share_;
+}
+inline double TargetScenario_Launch::height_share() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.height_share)
+  return _internal_height_share();
+}
+inline void TargetScenario_Launch::_internal_set_height_share(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.height_share_ = value;
+}
+inline void TargetScenario_Launch::set_height_share(double value) {
+  _internal_set_height_share(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.height_share)
+}
+
+// optional bool is_accurate = 9;
+inline bool TargetScenario_Launch::_internal_has_is_accurate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool TargetScenario_Launch::has_is_accurate() const {
+  return _internal_has_is_accurate();
+}
+inline void TargetScenario_Launch::clear_is_accurate() {
+  _impl_.is_accurate_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool TargetScenario_Launch::_internal_is_accurate() const {
+  return _impl_.is_accurate_;
+}
+inline bool TargetScenario_Launch::is_accurate() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.Launch.is_accurate)
+  return _internal_is_accurate();
+}
+inline void TargetScenario_Launch::_internal_set_is_accurate(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.is_accurate_ = value;
+}
+inline void TargetScenario_Launch::set_is_accurate(bool value) {
+  _internal_set_is_accurate(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.Launch.is_accurate)
+}
+
+// -------------------------------------------------------------------
+
+// TargetScenario
+
+// optional double radar_start_angle = 1 [default = 90];
+inline bool TargetScenario::_internal_has_radar_start_angle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TargetScenario::has_radar_start_angle() const {
+  return _internal_has_radar_start_angle();
+}
+inline void TargetScenario::clear_radar_start_angle() {
+  _impl_.radar_start_angle_ = 90;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double TargetScenario::_internal_radar_start_angle() const {
+  return _impl_.radar_start_angle_;
+}
+inline double TargetScenario::radar_start_angle() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.radar_start_angle)
+  return _internal_radar_start_angle();
+}
+inline void TargetScenario::_internal_set_radar_start_angle(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.radar_start_angle_ = value;
+}
+inline void TargetScenario::set_radar_start_angle(double value) {
+  _internal_set_radar_start_angle(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.radar_start_angle)
+}
+
+// optional double ship_start_angle = 2 [default = 0];
+inline bool TargetScenario::_internal_has_ship_start_angle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TargetScenario::has_ship_start_angle() const {
+  return _internal_has_ship_start_angle();
+}
+inline void TargetScenario::clear_ship_start_angle() {
+  _impl_.ship_start_angle_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double TargetScenario::_internal_ship_start_angle() const {
+  return _impl_.ship_start_angle_;
+}
+inline double TargetScenario::ship_start_angle() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.ship_start_angle)
+  return _internal_ship_start_angle();
+}
+inline void TargetScenario::_internal_set_ship_start_angle(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ship_start_angle_ = value;
+}
+inline void TargetScenario::set_ship_start_angle(double value) {
+  _internal_set_ship_start_angle(value);
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.ship_start_angle)
+}
+
+// optional string description = 3 [default = ""];
+inline bool TargetScenario::_internal_has_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TargetScenario::has_description() const {
+  return _internal_has_description();
+}
+inline void TargetScenario::clear_description() {
+  _impl_.description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TargetScenario::description() const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TargetScenario::set_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Proto.TargetScenario.description)
+}
+inline std::string* TargetScenario::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:Proto.TargetScenario.description)
+  return _s;
+}
+inline const std::string& TargetScenario::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void TargetScenario::_internal_set_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TargetScenario::_internal_mutable_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TargetScenario::release_description() {
+  // @@protoc_insertion_point(field_release:Proto.TargetScenario.description)
+  if (!_internal_has_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TargetScenario::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Proto.TargetScenario.description)
+}
+
+// repeated .Proto.TargetScenario.Launch launches = 4;
+inline int TargetScenario::_internal_launches_size() const {
+  return _impl_.launches_.size();
+}
+inline int TargetScenario::launches_size() const {
+  return _internal_launches_size();
+}
+inline void TargetScenario::clear_launches() {
+  _impl_.launches_.Clear();
+}
+inline ::Proto::TargetScenario_Launch* TargetScenario::mutable_launches(int index) {
+  // @@protoc_insertion_point(field_mutable:Proto.TargetScenario.launches)
+  return _impl_.launches_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::TargetScenario_Launch >*
+TargetScenario::mutable_launches() {
+  // @@protoc_insertion_point(field_mutable_list:Proto.TargetScenario.launches)
+  return &_impl_.launches_;
+}
+inline const ::Proto::TargetScenario_Launch& TargetScenario::_internal_launches(int index) const {
+  return _impl_.launches_.Get(index);
+}
+inline const ::Proto::TargetScenario_Launch& TargetScenario::launches(int index) const {
+  // @@protoc_insertion_point(field_get:Proto.TargetScenario.launches)
+  return _internal_launches(index);
+}
+inline ::Proto::TargetScenario_Launch* TargetScenario::_internal_add_launches() {
+  return _impl_.launches_.Add();
+}
+inline ::Proto::TargetScenario_Launch* TargetScenario::add_launches() {
+  ::Proto::TargetScenario_Launch* _add = _internal_add_launches();
+  // @@protoc_insertion_point(field_add:Proto.TargetScenario.launches)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Proto::TargetScenario_Launch >&
+TargetScenario::launches() const {
+  // @@protoc_insertion_point(field_list:Proto.TargetScenario.launches)
+  return _impl_.launches_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Proto
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_scenario_2eproto
@@ -0,0 +1,82 @@
+#include "assignment.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+
+std::pmr::vector<int> SolveAssignment(
+    const std::pmr::vector<double>& costs,
+    int rowsCount,
+    int colsCount,
+    std::pmr::memory_resource* resource
+) {
+    if (rowsCount > colsCount || costs.size() != (size_t) rowsCount * colsCount) {
+        throw std::invalid_argument(
+            "Wrong assignment problem " + std::to_string(rowsCount) + "x" + std::to_string(colsCount)
+            + " with " + std::to_string(costs.size()) + " costs"
+        );
+    }
+    const double inf = std::numeric_limits<double>::infinity();
+    auto cost = [&costs, colsCount](int row, int col) {
+        return costs[(row - 1) * colsCount + col - 1];
+    };
+
+    // rows and columns are numbered from 1, column 0 is fictive one, which starts augmenting path
+    std::pmr::vector<double> rowPotentials(rowsCount + 1, 0, resource);
+    std::pmr::vector<double> colPotentials(colsCount + 1, 0, resource);
+    std::pmr::vector<int> colRows(colsCount + 1, 0, resource); // 0 - column is free
+    std::pmr::vector<int> prevCols(colsCount + 1, 0, resource);
+    std::pmr::vector<double> minSlacks(colsCount + 1, inf, resource);
+    std::pmr::vector<char> isVisited(colsCount + 1, false, resource);
+
+    for (int row = 1; row <= rowsCount; ++row) {
+        colRows[0] = row;
+        int col = 0;
+        minSlacks.assign(colsCount + 1, inf);
+        isVisited.assign(colsCount + 1, false);
+        do {
+            isVisited[col] = true;
+            const int currRow = colRows[col];
+            double delta = inf;
+            int nextCol = 0;
+            for (int j = 1; j <= colsCount; ++j) {
+                if (isVisited[j]) continue;
+
+                const double slack = cost(currRow, j) - rowPotentials[currRow] - colPotentials[j];
+                if (slack < minSlacks[j]) {
+                    minSlacks[j] = slack;
+                    prevCols[j] = col;
+                }
+                if (minSlacks[j] < delta) {
+                    delta = minSlacks[j];
+                    nextCol = j;
+                }
+            }
+            for (int j = 0; j <= colsCount; ++j) {
+                if (isVisited[j]) {
+                    rowPotentials[colRows[j]] += delta;
+                    colPotentials[j] -= delta;
+                } else {
+                    minSlacks[j] -= delta;
+                }
+            }
+            col = nextCol;
+        } while (colRows[col] != 0);
+
+        // augment along found path
+        do {
+            const int prevCol = prevCols[col];
+            colRows[col] = colRows[prevCol];
+            col = prevCol;
+        } while (col != 0);
+    }
+
+    std::pmr::vector<int> res(rowsCount, -1, resource);
+    for (int col = 1; col <= colsCount; ++col) {
+        if (colRows[col] != 0) {
+            res[colRows[col] - 1] = col - 1;
+        }
+    }
+    return res;
+}
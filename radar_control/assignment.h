@@ -0,0 +1,19 @@
+#ifndef ASSIGNMENT_H
+#define ASSIGNMENT_H
+
+#include <memory_resource>
+#include <vector>
+
+
+// Hungarian method with potentials, O(rowsCount^2 * colsCount).
+// costs - row-major matrix rowsCount x colsCount, rowsCount must not be greater than colsCount.
+// Returns column assigned to each row, so that total cost is minimal and no column is assigned twice.
+std::pmr::vector<int> SolveAssignment(
+    const std::pmr::vector<double>& costs,
+    int rowsCount,
+    int colsCount,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
+
+
+#endif // ASSIGNMENT_H
@@ -3,7 +3,10 @@
 #include "util/points.h"
 #include "util/util.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 
@@ -32,27 +35,33 @@ namespace {
         return {filteredX, filteredSpeed};
     }
 
-    std::vector<Vector3d> FindIntersectionsOfCircleAndLine(Vector3d center, double rad, Vector3d pos, Vector3d speed) {
+    std::pmr::vector<Vector3d> FindIntersectionsOfCircleAndLine(
+        Vector3d center,
+        double rad,
+        Vector3d pos,
+        Vector3d speed,
+        std::pmr::memory_resource* resource
+    ) {
         Vector3d p1 = pos, p2 = pos + speed;
         double a = p1.Y - p2.Y;
         double b = p2.X - p1.X;
         double c = p1.X * p2.Y - p1.Y * p2.X;
 
+        std::pmr::vector<Vector3d> res(resource);
         if (c*c > rad*rad * (a*a + b*b) + EPS) {
-            return {};
+            return res;
         }
 
         Vector3d p0(-a * c / (a*a + b*b), -b * c / (a*a + b*b));
         if (std::abs(c*c - rad*rad * (a*a + b*b)) < EPS) {
-            return {p0};
+            res.push_back(p0);
         } else {
             double d = rad*rad - c*c / (a*a + b*b);
             double mult = std::sqrt(d / (a*a + b*b));
-            return {
-                Vector3d(p0.X + b * mult, p0.Y - a * mult),
-                Vector3d(p0.X - b * mult, p0.Y + a * mult),
-            };
+            res.push_back(Vector3d(p0.X + b * mult, p0.Y - a * mult));
+            res.push_back(Vector3d(p0.X - b * mult, p0.Y + a * mult));
         }
+        return res;
     }
 
     // m0 - point for distance, a - vector of line, m1 - point on line
@@ -66,33 +75,6 @@ namespace {
         return SqrtOfSumSquares(vecProd) / SqrtOfSumSquares(a);
     }
 
-    std::vector<std::pair<double, double>> FindSegmentsIntersection(
-        std::vector<std::pair<double, double>> a,
-        std::vector<std::pair<double, double>> b
-    ) {
-        std::vector<std::pair<double, double>> result;
-        std::sort(a.begin(), a.end());
-        std::sort(b.begin(), b.end());
-
-        auto segIntersection = [](const std::pair<double, double>& a, const std::pair<double, double>& b) {
-            return std::make_pair(std::max(a.first, b.first), std::min(a.second, b.second));
-        };
-
-        int idxA = 0, idxB = 0;
-        while (idxA < a.size() && idxB < b.size()) {
-            auto intersection = segIntersection(a[idxA], b[idxB]);
-            if (intersection.first <= intersection.second) {
-                result.push_back(intersection);
-            }
-            if (a[idxA].second < b[idxB].second) {
-                idxA++;
-            } else {
-                idxB++;
-            }
-        }
-        return result;
-    }
-
 }
 
 std::pair<Vector3d, Vector3d> ABFilter(
@@ -141,13 +123,17 @@ Vector3d CalculateEntryPoint(
     double radius,
     const Vector3d& radarPos
 ) {
-    auto points = FindIntersectionsOfCircleAndLine(radarPos, radius, targetPos, targetSpeed);
+    // at most two points and two distances
+    std::array<std::byte, 256> buffer;
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
+
+    auto points = FindIntersectionsOfCircleAndLine(radarPos, radius, targetPos, targetSpeed, &resource);
     if (points.empty()) {
         return Vector3d::Zero();
     } else if (points.size() == 1) {
         return points[0];
     } else {
-        std::vector<double> distances;
+        std::pmr::vector<double> distances(&resource);
         for (const auto& p : points) {
             distances.push_back(Distance(p, targetPos));
         }
@@ -215,7 +201,7 @@ double CalculateRadarAngleOneTarget(
 double CalculateRadarAngleMultiTarget(
     double currRadarAngle,
     double currRadarTargetAngle,
-    const std::vector<double>& angles,
+    const AngleList& angles,
     double viewAngle,
     double margin
 ) {
@@ -235,18 +221,21 @@ double CalculatePriority(Vector3d pos, Vector3d speed, double maxSpeed, Vector3d
     return 0.9 * std::pow(M_E, - 0.01 * dist2radar) + 0.1 * absSpeed / maxSpeed;
 }
 
-std::vector<double> SolveQuadraticEquation(double a, double b, double c) {
+std::pmr::vector<double> SolveQuadraticEquation(double a, double b, double c, std::pmr::memory_resource* resource) {
+    std::pmr::vector<double> res(resource);
     if (a == 0) {
-        if (b != 0) return {-c / b};
-        return {};
+        if (b != 0) res.push_back(-c / b);
+        return res;
     }
     auto discriminant = b*b - 4*a*c;
-    if (discriminant < 0) return {};
-    if (discriminant == 0) return {-b / (2 * a)};
-    return {
-        (-b + std::sqrt(discriminant)) / (2 * a),
-        (-b - std::sqrt(discriminant)) / (2 * a),
-    };
+    if (discriminant < 0) return res;
+    if (discriminant == 0) {
+        res.push_back(-b / (2 * a));
+        return res;
+    }
+    res.push_back((-b + std::sqrt(discriminant)) / (2 * a));
+    res.push_back((-b - std::sqrt(discriminant)) / (2 * a));
+    return res;
 }
 
 double TimeToRotate(RadarPos curr, RadarTargetPos target, double maxEps) {
@@ -277,10 +266,13 @@ double TimeToRotate(RadarPos curr, RadarTargetPos target, double maxEps) {
     if (accDist + decDist < distToTarget) {
         time += (2 * target.Speed - currAbsSpeed) / maxEps + (distToTarget - accDist - decDist) / target.Speed;
     } else {
+        std::array<std::byte, 64> buffer;
+        std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
         auto times = SolveQuadraticEquation(
             maxEps,
             2 * currAbsSpeed,
-            0.5 * currAbsSpeed * currAbsSpeed / maxEps - distToTarget
+            0.5 * currAbsSpeed * currAbsSpeed / maxEps - distToTarget,
+            &resource
         );
         if (!times.empty()) {
             time += *std::max_element(times.begin(), times.end()) * 2;
@@ -293,7 +285,7 @@ double TimeToRotate(RadarPos curr, RadarTargetPos target, double maxEps) {
 double TimeToRotateToTarget(
     RadarPos pos,
     RadarTargetPos targetPos,
-    const std::vector<double>& targetAngles,
+    const AngleList& targetAngles,
     double maxAngleSpeed,
     double maxEps,
     double viewAngle,
@@ -362,8 +354,8 @@ RadarPos UpdateRadarPos(RadarPos curr, RadarTargetPos target, double maxEps, dou
 
 bool CanAddToAngleArray(
     double maxDiff,
-    const std::vector<double>& angles,
-    const std::vector<double>& newAngles
+    const AngleList& angles,
+    const AngleList& newAngles
 ) {
     if (angles.empty()) return true;
     auto min = *std::min_element(angles.begin(), angles.end());
@@ -376,29 +368,84 @@ bool CanAddToAngleArray(
     return true;
 }
 
+std::pmr::vector<int> SelectAngleWindow(
+    const std::pmr::vector<AngleWindowCandidate>& candidates,
+    double width,
+    double preferredStart,
+    std::pmr::memory_resource* resource
+) {
+    const double eps = 1e-9;
+
+    // candidate is inside window iff window start is in [MaxAngle - width, MinAngle]
+    struct Event {
+        double Pos;
+        bool IsStart;
+        double Weight;
+    };
+    std::pmr::vector<Event> events(resource);
+    events.reserve(2 * candidates.size());
+    for (const auto& candidate : candidates) {
+        if (candidate.MaxAngle - candidate.MinAngle > width + eps) continue;
+        events.push_back({candidate.MaxAngle - width, true, candidate.Weight});
+        events.push_back({candidate.MinAngle, false, candidate.Weight});
+    }
+    std::pmr::vector<int> res(resource);
+    if (events.empty()) {
+        return res;
+    }
+    std::sort(events.begin(), events.end(), [](const Event& l, const Event& r) {
+        return l.Pos < r.Pos || (l.Pos == r.Pos && l.IsStart && !r.IsStart);
+    });
+
+    double bestWeight = -1, bestStart = preferredStart, bestDist = 1e18;
+    double weight = 0;
+    for (int i = 0; i + 1 < events.size(); ++i) {
+        weight += (events[i].IsStart ? events[i].Weight : -events[i].Weight);
+
+        // weight is constant on [events[i].Pos, events[i+1].Pos]
+        double start = Clip(preferredStart, events[i].Pos, events[i + 1].Pos);
+        double dist = std::abs(start - preferredStart);
+        if (weight > bestWeight + eps || (weight > bestWeight - eps && dist < bestDist)) {
+            bestWeight = weight;
+            bestStart = start;
+            bestDist = dist;
+        }
+    }
+
+    for (int i = 0; i < candidates.size(); ++i) {
+        if (
+            candidates[i].MaxAngle - width <= bestStart + eps
+            && bestStart <= candidates[i].MinAngle + eps
+        ) {
+            res.push_back(i);
+        }
+    }
+    return res;
+}
+
 double CalculateShipAngleMultiTarget(
     double currShipAngle,
     double currShipTargetAngle,
-    const std::vector<double>& angles,
-    const std::vector<std::pair<double, double>>& deadZones
+    const AngleList& angles,
+    const AngleSegments& deadZones
 ) {
-    std::vector<std::pair<double, double>> validRanges;
-    for (auto angle : angles) {
-        std::vector<std::pair<double, double>> ranges;
-        for (auto seg : deadZones) {
-            ranges.emplace_back(angle - seg.second, angle - seg.first);
-        }
-        if (validRanges.empty()) {
+    AngleSegments validRanges;
+    AngleSegments ranges;
+    for (int i = 0; i < angles.size(); ++i) {
+        // ship angles at which angle is in segment
+        ranges = deadZones;
+        ranges.Reflect(angles[i]);
+        if (i == 0) {
             validRanges = ranges;
         } else {
-            validRanges = FindSegmentsIntersection(validRanges, ranges);
-            if (validRanges.empty()) break;
+            validRanges.Intersect(ranges);
         }
+        if (validRanges.Empty()) break;
     }
-    if (validRanges.empty()) {
+    if (validRanges.Empty()) {
         return -1;
     }
-    if (IsInAnySegment(validRanges, currShipTargetAngle)) {
+    if (validRanges.Contains(currShipTargetAngle)) {
         return currShipTargetAngle;
     }
     double result = -100;
@@ -415,20 +462,3 @@ double CalculateShipAngleMultiTarget(
     }
     return result;
 }
-
-std::vector<std::pair<double, double>> InvertSegments(
-    const std::vector<std::pair<double, double>>& segments,
-    double edgeSegmentLen,
-    double margin
-) {
-    if (segments.empty()) {
-        return {{- edgeSegmentLen / 2, edgeSegmentLen / 2}};
-    }
-    std::vector<std::pair<double, double>> res;
-    res.emplace_back(segments.front().first - edgeSegmentLen, segments.front().first - margin);
-    for (int i = 0; i + 1 < segments.size(); ++i) {
-        res.emplace_back(segments[i].second + margin, segments[i+1].first - margin);
-    }
-    res.emplace_back(segments.back().second + margin, segments.back().second + edgeSegmentLen);
-    return res;
-}
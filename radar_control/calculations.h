@@ -3,12 +3,17 @@
 
 
 #include "data.h"
+#include "util/interval_set.h"
 #include "util/points.h"
 
+#include <memory_resource>
 #include <utility>
 #include <vector>
 
 
+// angles of followed targets, short-lived, so usually allocated from controller tick arena
+using AngleList = std::pmr::vector<double>;
+
 std::pair<Vector3d, Vector3d> ABFilter(Vector3d x, Vector3d prevX, Vector3d prevSpeed, double dt, int measureCount);
 
 Vector3d CalculateMeetPoint(
@@ -37,7 +42,7 @@ double CalculateRadarAngleOneTarget(
 double CalculateRadarAngleMultiTarget(
     double currRadarAngle,
     double currRadarTargetAngle,
-    const std::vector<double>& angles,
+    const AngleList& angles,
     double viewAngle,
     double margin
 );
@@ -45,19 +50,24 @@ double CalculateRadarAngleMultiTarget(
 double CalculateShipAngleMultiTarget(
     double currShipAngle,
     double currShipTargetAngle,
-    const std::vector<double>& angles,
-    const std::vector<std::pair<double, double>>& deadZones
+    const AngleList& angles,
+    const AngleSegments& deadZones // zones allowed for angles
 );
 
 double CalculatePriority(Vector3d pos, Vector3d speed, double maxSpeed, Vector3d radarPoint = Vector3d::Zero());
 
-std::vector<double> SolveQuadraticEquation(double a, double b, double c);
+std::pmr::vector<double> SolveQuadraticEquation(
+    double a,
+    double b,
+    double c,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
 
 double TimeToRotate(RadarPos curr, RadarTargetPos target, double maxEps);
 double TimeToRotateToTarget(
     RadarPos pos,
     RadarTargetPos targetPos,
-    const std::vector<double>& targetAngles,
+    const AngleList& targetAngles,
     double maxAngleSpeed,
     double maxEps,
     double viewAngle,
@@ -66,12 +76,21 @@ double TimeToRotateToTarget(
 
 RadarPos UpdateRadarPos(RadarPos curr, RadarTargetPos target, double maxEps, double deltaTime);
 
-bool CanAddToAngleArray(double maxDiff, const std::vector<double>& angles, const std::vector<double>& newAngles);
-
-std::vector<std::pair<double, double>> InvertSegments(
-    const std::vector<std::pair<double, double>>& segments,
-    double edgeSegmentLen,
-    double margin
+bool CanAddToAngleArray(double maxDiff, const AngleList& angles, const AngleList& newAngles);
+
+struct AngleWindowCandidate {
+    double MinAngle;
+    double MaxAngle;
+    double Weight;
+};
+
+// Finds window [start, start + width] with max total weight of candidates fully inside it, in O(n log n).
+// Among equal windows the closest one to preferredStart is chosen. Returns indices of candidates inside window.
+std::pmr::vector<int> SelectAngleWindow(
+    const std::pmr::vector<AngleWindowCandidate>& candidates,
+    double width,
+    double preferredStart,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource()
 );
 
 
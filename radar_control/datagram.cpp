@@ -0,0 +1,244 @@
+#include "datagram.h"
+
+#include <poll.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+
+namespace {
+
+    sockaddr_un MakeAddress(const std::string& socketPath) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("Socket path is too long: " + socketPath);
+        }
+        std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        return address;
+    }
+
+    std::runtime_error SystemError(const std::string& what) {
+        return std::runtime_error(what + ": " + std::strerror(errno));
+    }
+
+    // default socket buffers fit only a few max-sized datagrams
+    void SetSocketBufferSize(int fd, int option) {
+        const int size = 4 * 1024 * 1024;
+        setsockopt(fd, SOL_SOCKET, option, &size, sizeof(size));
+    }
+
+}
+
+
+DatagramReceiver::DatagramReceiver(const std::string& socketPath, int batchSize)
+    : SocketPath(socketPath)
+    , Buffer(batchSize * Wire::MAX_DATAGRAM_SIZE)
+    , Iovecs(batchSize)
+    , Messages(batchSize)
+{
+    Fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (Fd < 0) {
+        throw SystemError("Can't create socket");
+    }
+    SetSocketBufferSize(Fd, SO_RCVBUF);
+    auto address = MakeAddress(SocketPath);
+    unlink(SocketPath.c_str());
+    if (bind(Fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0) {
+        close(Fd);
+        throw SystemError("Can't bind socket " + SocketPath);
+    }
+
+    for (int i = 0; i < batchSize; ++i) {
+        Iovecs[i].iov_base = Buffer.data() + i * Wire::MAX_DATAGRAM_SIZE;
+        Iovecs[i].iov_len = Wire::MAX_DATAGRAM_SIZE;
+        Messages[i].msg_hdr = msghdr{};
+        Messages[i].msg_hdr.msg_iov = &Iovecs[i];
+        Messages[i].msg_hdr.msg_iovlen = 1;
+    }
+}
+
+int DatagramReceiver::ReceiveAndProcess(RadarController& controller, int timeoutMs, double framePeriodMs) {
+    pollfd fds{.fd = Fd, .events = POLLIN, .revents = 0};
+    if (poll(&fds, 1, timeoutMs) <= 0) {
+        return 0;
+    }
+
+    Frames.clear();
+    while (true) {
+        int received = recvmmsg(Fd, Messages.data(), Messages.size(), MSG_DONTWAIT, nullptr);
+        if (received < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                break;
+            }
+            throw SystemError("Can't receive datagrams");
+        }
+        ++ReceiverStats.BatchesCount;
+        for (int i = 0; i < received; ++i) {
+            ProcessDatagram(static_cast<const char*>(Iovecs[i].iov_base), Messages[i].msg_len);
+        }
+        if (received < Messages.size()) {
+            break;
+        }
+    }
+    if (Frames.empty()) {
+        return 0;
+    }
+
+    for (int i = 0; i < Frames.size(); ++i) {
+        Frames[i].AgeMs = (Frames.size() - 1 - i) * framePeriodMs;
+    }
+    controller.ProcessFrames(Frames);
+    ++ReceiverStats.ProcessCallsCount;
+    ReceiverStats.ProcessMs += controller.GetLastProcessStats().ElapsedMs;
+    return Frames.size();
+}
+
+bool DatagramReceiver::ProcessDatagram(const char* data, size_t size) {
+    Wire::Header header;
+    if (size < sizeof(header)) {
+        ++ReceiverStats.InvalidDatagramsCount;
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    size_t recordSize = 0;
+    switch (header.Type) {
+        case Wire::BIG_RADAR: recordSize = sizeof(BigRadarData); break;
+        case Wire::SMALL_RADAR: recordSize = sizeof(SmallRadarData); break;
+        case Wire::FRAME_END: recordSize = 0; break;
+    }
+    if (
+        header.Magic != Wire::MAGIC
+        || header.Version != Wire::VERSION
+        || (recordSize == 0 && header.Type != Wire::FRAME_END)
+        || size != sizeof(header) + header.RecordsCount * recordSize
+    ) {
+        ++ReceiverStats.InvalidDatagramsCount;
+        return false;
+    }
+    ++ReceiverStats.DatagramsCount;
+    ReceiverStats.RecordsCount += header.RecordsCount;
+
+    if (IsFrameStarted && header.FrameId != FrameId) {
+        // end of previous frame was lost
+        ++ReceiverStats.IncompleteFramesCount;
+        BigDatas.clear();
+        SmallDatas.clear();
+    }
+    FrameId = header.FrameId;
+    IsFrameStarted = true;
+
+    const char* records = data + sizeof(header);
+    switch (header.Type) {
+        case Wire::BIG_RADAR: {
+            auto offset = BigDatas.size();
+            BigDatas.resize(offset + header.RecordsCount);
+            std::memcpy(static_cast<void*>(BigDatas.data() + offset), records, header.RecordsCount * recordSize);
+            return false;
+        }
+        case Wire::SMALL_RADAR: {
+            auto offset = SmallDatas.size();
+            SmallDatas.resize(offset + header.RecordsCount);
+            std::memcpy(static_cast<void*>(SmallDatas.data() + offset), records, header.RecordsCount * recordSize);
+            return false;
+        }
+        default: {
+            Frames.push_back(RadarController::Frame{
+                .BigDatas = std::move(BigDatas),
+                .SmallDatas = std::move(SmallDatas)
+            });
+            BigDatas.clear();
+            SmallDatas.clear();
+            IsFrameStarted = false;
+            ++ReceiverStats.FramesCount;
+            return true;
+        }
+    }
+}
+
+DatagramReceiver::~DatagramReceiver() {
+    close(Fd);
+    unlink(SocketPath.c_str());
+}
+
+
+DatagramSender::DatagramSender(const std::string& socketPath) {
+    Fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (Fd < 0) {
+        throw SystemError("Can't create socket");
+    }
+    SetSocketBufferSize(Fd, SO_SNDBUF);
+    auto address = MakeAddress(socketPath);
+    std::memcpy(&Address, &address, sizeof(address));
+    AddressLength = sizeof(address);
+}
+
+int DatagramSender::SendFrame(const std::vector<BigRadarData>& bigDatas, const std::vector<SmallRadarData>& smallDatas) {
+    Buffer.clear();
+    DatagramOffsets.clear();
+
+    PackRecords(bigDatas, Wire::BIG_RADAR, Wire::MAX_BIG_RADAR_RECORDS);
+    PackRecords(smallDatas, Wire::SMALL_RADAR, Wire::MAX_SMALL_RADAR_RECORDS);
+    PackDatagram(Wire::FRAME_END, nullptr, 0, 0);
+    ++FrameId;
+
+    // buffer doesn't grow anymore, so pointers to datagrams are stable
+    Iovecs.resize(DatagramOffsets.size());
+    Messages.resize(DatagramOffsets.size());
+    for (int i = 0; i < DatagramOffsets.size(); ++i) {
+        auto end = (i + 1 < DatagramOffsets.size() ? DatagramOffsets[i + 1] : Buffer.size());
+        Iovecs[i].iov_base = Buffer.data() + DatagramOffsets[i];
+        Iovecs[i].iov_len = end - DatagramOffsets[i];
+        Messages[i].msg_hdr = msghdr{};
+        Messages[i].msg_hdr.msg_name = &Address;
+        Messages[i].msg_hdr.msg_namelen = AddressLength;
+        Messages[i].msg_hdr.msg_iov = &Iovecs[i];
+        Messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int sent = 0;
+    while (sent < Messages.size()) {
+        int res = sendmmsg(Fd, Messages.data() + sent, Messages.size() - sent, 0);
+        if (res < 0) {
+            if (errno == EINTR) continue;
+            throw SystemError("Can't send datagrams");
+        }
+        sent += res;
+    }
+    return sent;
+}
+
+template<class T>
+void DatagramSender::PackRecords(const std::vector<T>& records, Wire::RecordType type, size_t maxRecords) {
+    for (size_t start = 0; start < records.size(); start += maxRecords) {
+        auto count = std::min(maxRecords, records.size() - start);
+        PackDatagram(type, records.data() + start, count, sizeof(T));
+    }
+}
+
+void DatagramSender::PackDatagram(Wire::RecordType type, const void* records, size_t recordsCount, size_t recordSize) {
+    Wire::Header header{
+        .Magic = Wire::MAGIC,
+        .Version = Wire::VERSION,
+        .Type = type,
+        .FrameId = FrameId,
+        .RecordsCount = static_cast<uint32_t>(recordsCount)
+    };
+    auto offset = Buffer.size();
+    DatagramOffsets.push_back(offset);
+    Buffer.resize(offset + sizeof(header) + recordsCount * recordSize);
+    std::memcpy(Buffer.data() + offset, &header, sizeof(header));
+    if (recordsCount != 0) {
+        std::memcpy(Buffer.data() + offset + sizeof(header), records, recordsCount * recordSize);
+    }
+}
+
+DatagramSender::~DatagramSender() {
+    close(Fd);
+}
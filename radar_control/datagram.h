@@ -0,0 +1,129 @@
+#ifndef DATAGRAM_H
+#define DATAGRAM_H
+
+#include "data.h"
+#include "radar_controller.h"
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+// Wire layout of radar measurement datagrams for local UNIX domain sockets.
+// Records are native in-memory BigRadarData/SmallRadarData, so sender and receiver must run on the same host.
+namespace Wire {
+
+    const uint32_t MAGIC = 0x47444352; // "RCDG"
+    const uint16_t VERSION = 1;
+    const size_t MAX_DATAGRAM_SIZE = 64 * 1024;
+
+    enum RecordType : uint16_t {
+        BIG_RADAR = 1,
+        SMALL_RADAR = 2,
+        FRAME_END = 3, // no records, frame is complete and can be processed
+    };
+
+    // aligned as records, which follow it
+    struct alignas(alignof(BigRadarData)) Header {
+        uint32_t Magic;
+        uint16_t Version;
+        uint16_t Type;
+        uint32_t FrameId;
+        uint32_t RecordsCount;
+    };
+
+    static_assert(std::is_trivially_copyable_v<BigRadarData>);
+    static_assert(std::is_trivially_copyable_v<SmallRadarData>);
+    static_assert(sizeof(Header) % alignof(BigRadarData) == 0);
+
+    const size_t MAX_BIG_RADAR_RECORDS = (MAX_DATAGRAM_SIZE - sizeof(Header)) / sizeof(BigRadarData);
+    const size_t MAX_SMALL_RADAR_RECORDS = (MAX_DATAGRAM_SIZE - sizeof(Header)) / sizeof(SmallRadarData);
+
+}
+
+
+// Receives measurement datagrams in batches and passes complete frames of a batch to controller in one call.
+class DatagramReceiver {
+public:
+    struct Stats {
+        long long DatagramsCount = 0;
+        long long RecordsCount = 0;
+        long long FramesCount = 0;
+        long long BatchesCount = 0;
+        long long InvalidDatagramsCount = 0;
+        long long IncompleteFramesCount = 0;
+        long long ProcessCallsCount = 0;
+        double ProcessMs = 0; // sum of all Process calls
+    };
+
+    DatagramReceiver(const std::string& socketPath, int batchSize = 64);
+    // owns socket, which is closed on destruction
+    DatagramReceiver(const DatagramReceiver&) = delete;
+    DatagramReceiver& operator=(const DatagramReceiver&) = delete;
+
+    // waits for datagrams up to timeoutMs, returns number of frames passed to controller,
+    // frames are sent every framePeriodMs, so the last received one is fresh and earlier ones are older
+    int ReceiveAndProcess(RadarController& controller, int timeoutMs, double framePeriodMs);
+
+    const Stats& GetStats() const { return ReceiverStats; }
+
+    ~DatagramReceiver();
+
+private:
+    // true if datagram completed frame
+    bool ProcessDatagram(const char* data, size_t size);
+
+private:
+    const std::string SocketPath;
+    int Fd;
+
+    std::vector<char> Buffer;
+    std::vector<iovec> Iovecs;
+    std::vector<mmsghdr> Messages;
+
+    uint32_t FrameId = 0;
+    bool IsFrameStarted = false;
+    std::vector<BigRadarData> BigDatas;
+    std::vector<SmallRadarData> SmallDatas;
+    std::vector<RadarController::Frame> Frames; // complete frames of current batch
+
+    Stats ReceiverStats;
+};
+
+
+// Packs frames into datagrams and sends them with one call per frame.
+class DatagramSender {
+public:
+    DatagramSender(const std::string& socketPath);
+    // owns socket, which is closed on destruction
+    DatagramSender(const DatagramSender&) = delete;
+    DatagramSender& operator=(const DatagramSender&) = delete;
+
+    // returns number of sent datagrams
+    int SendFrame(const std::vector<BigRadarData>& bigDatas, const std::vector<SmallRadarData>& smallDatas);
+
+    ~DatagramSender();
+
+private:
+    template<class T>
+    void PackRecords(const std::vector<T>& records, Wire::RecordType type, size_t maxRecords);
+    void PackDatagram(Wire::RecordType type, const void* records, size_t recordsCount, size_t recordSize);
+
+private:
+    int Fd;
+    sockaddr_storage Address;
+    socklen_t AddressLength;
+
+    uint32_t FrameId = 0;
+    std::vector<char> Buffer;
+    std::vector<size_t> DatagramOffsets;
+    std::vector<iovec> Iovecs;
+    std::vector<mmsghdr> Messages;
+};
+
+
+#endif // DATAGRAM_H
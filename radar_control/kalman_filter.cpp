@@ -0,0 +1,97 @@
+#include "kalman_filter.h"
+
+#include <cmath>
+
+
+namespace {
+
+    const double STEADY_STATE_TOLERANCE = 1e-4;
+    // measurement periods jitter with tick timing, gains barely depend on such jitter
+    const double DT_TOLERANCE = 0.05;
+
+    bool IsConverged(double prev, double curr) {
+        return std::abs(curr - prev) <= STEADY_STATE_TOLERANCE * std::abs(curr);
+    }
+
+    bool IsSameDt(double prev, double curr) {
+        return std::abs(curr - prev) <= DT_TOLERANCE * prev;
+    }
+
+}
+
+
+KalmanFilter::KalmanFilter(double measurementStddev, double accelerationStddev)
+    : R(measurementStddev * measurementStddev)
+    , Q(accelerationStddev * accelerationStddev)
+{}
+
+void KalmanFilter::Reset(Vector3d pos, Vector3d speed, double speedStddev) {
+    Pos = pos;
+    Speed = speed;
+    P = Covariance{.PosPos = R, .PosSpeed = 0, .SpeedSpeed = speedStddev * speedStddev};
+    GainsDt = -1;
+    SteadyStateFlag = false;
+}
+
+void KalmanFilter::Update(Vector3d measuredPos, double dt) {
+    if (SteadyStateFlag && !IsSameDt(GainsDt, dt)) {
+        SteadyStateFlag = false;
+    }
+
+    if (!SteadyStateFlag) {
+        auto predicted = Predict(P, dt, Q);
+        double s = predicted.PosPos + R;
+        double posGain = predicted.PosPos / s;
+        double speedGain = predicted.PosSpeed / s;
+
+        P.PosPos = (1 - posGain) * predicted.PosPos;
+        P.PosSpeed = (1 - posGain) * predicted.PosSpeed;
+        P.SpeedSpeed = predicted.SpeedSpeed - speedGain * predicted.PosSpeed;
+
+        SteadyStateFlag = IsSameDt(GainsDt, dt) && IsConverged(PosGain, posGain) && IsConverged(SpeedGain, speedGain);
+        PosGain = posGain;
+        SpeedGain = speedGain;
+        GainsDt = dt;
+    }
+
+    auto predictedPos = Pos + Speed * dt;
+    auto residual = measuredPos - predictedPos;
+    Pos = predictedPos + residual * PosGain;
+    Speed += residual * SpeedGain;
+}
+
+double KalmanFilter::GetSpeedStddev() const {
+    return std::sqrt(P.SpeedSpeed);
+}
+
+int KalmanFilter::GetUpdatesCountToSpeedStddev(double speedStddev, double dt, int maxCount) const {
+    const double variance = speedStddev * speedStddev;
+    if (P.SpeedSpeed <= variance) {
+        return 0;
+    }
+    if (SteadyStateFlag) {
+        return maxCount;
+    }
+
+    auto p = P;
+    for (int i = 1; i < maxCount; ++i) {
+        auto predicted = Predict(p, dt, Q);
+        double s = predicted.PosPos + R;
+        p.SpeedSpeed = predicted.SpeedSpeed - predicted.PosSpeed * predicted.PosSpeed / s;
+        p.PosSpeed = predicted.PosSpeed * R / s;
+        p.PosPos = predicted.PosPos * R / s;
+        if (p.SpeedSpeed <= variance) {
+            return i;
+        }
+    }
+    return maxCount;
+}
+
+KalmanFilter::Covariance KalmanFilter::Predict(const Covariance& p, double dt, double q) {
+    const double dt2 = dt * dt;
+    return Covariance{
+        .PosPos = p.PosPos + 2 * dt * p.PosSpeed + dt2 * p.SpeedSpeed + q * dt2 * dt2 / 4,
+        .PosSpeed = p.PosSpeed + dt * p.SpeedSpeed + q * dt2 * dt / 2,
+        .SpeedSpeed = p.SpeedSpeed + q * dt2,
+    };
+}
@@ -0,0 +1,51 @@
+#ifndef KALMAN_FILTER_H
+#define KALMAN_FILTER_H
+
+#include "util/points.h"
+
+
+// Constant velocity Kalman filter with white noise acceleration.
+// Axes are filtered independently with the same noises, so all of them share one covariance
+// and one pair of gains. When gains converge for nearly constant dt, covariance recursion is skipped.
+class KalmanFilter {
+public:
+    // covariance of [position, speed] along one axis
+    struct Covariance {
+        double PosPos = 0;
+        double PosSpeed = 0;
+        double SpeedSpeed = 0;
+    };
+
+    KalmanFilter(double measurementStddev, double accelerationStddev);
+
+    void Reset(Vector3d pos, Vector3d speed, double speedStddev);
+    void Update(Vector3d measuredPos, double dt);
+
+    Vector3d GetPosition() const { return Pos; }
+    Vector3d GetSpeed() const { return Speed; }
+    const Covariance& GetCovariance() const { return P; }
+    double GetSpeedStddev() const;
+    bool IsSteadyState() const { return SteadyStateFlag; }
+
+    // number of updates with given dt needed to get speed stddev not greater than given one, maxCount if never
+    int GetUpdatesCountToSpeedStddev(double speedStddev, double dt, int maxCount) const;
+
+private:
+    static Covariance Predict(const Covariance& p, double dt, double q);
+
+private:
+    const double R; // measurement variance
+    const double Q; // acceleration variance
+
+    Vector3d Pos;
+    Vector3d Speed;
+    Covariance P;
+
+    double PosGain = 0;
+    double SpeedGain = 0;
+    double GainsDt = -1;
+    bool SteadyStateFlag = false;
+};
+
+
+#endif // KALMAN_FILTER_H
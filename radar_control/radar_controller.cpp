@@ -1,5 +1,8 @@
 #include "radar_controller.h"
+#include "assignment.h"
 #include "calculations.h"
+#include "radar_planner.h"
+#include "rotation_time_cache.h"
 #include "proto/generated/params.pb.h"
 #include "radar_control/data.h"
 #include "util/points.h"
@@ -10,7 +13,9 @@
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
-#include <stdexcept>
+#include <limits>
+#include <memory_resource>
+#include <set>
 #include <string>
 
 using namespace RC;
@@ -18,16 +23,18 @@ using namespace RC;
 
 namespace {
 
-    const Target* GetTargetById(const std::vector<const Target*>& targets, int id){
+    using TargetList = std::pmr::vector<const Target*>;
+
+    const Target* FindTargetById(const TargetList& targets, int id) {
         for (const auto* target : targets) {
             if (target->GetId() == id) {
                 return target;
             }
         }
-        throw std::out_of_range("Target with id " + std::to_string(id) + " not found\n");
+        return nullptr;
     }
 
-    void SortTargetsByPriorities(std::vector<const Target*>& vec) {
+    void SortTargetsByPriorities(TargetList& vec) {
         std::sort(
             vec.begin(),
             vec.end(),
@@ -37,55 +44,49 @@ namespace {
         );
     }
 
-    std::vector<double> GetTargetAngles(const Target* target) {
-        std::vector<double> res;
+    AngleList GetTargetAngles(const Target* target, std::pmr::memory_resource* resource) {
+        AngleList res(resource);
+        res.reserve(2);
         if (target->GetMeetAngle() != -1) res.push_back(target->GetMeetAngle());
         if (target->GetEntryAngle() != -1) res.push_back(target->GetEntryAngle());
         else res.push_back(target->GetPosAngle());
         return res;
     }
 
-    std::pair<RadarTargetPos, std::vector<int>> CalculateRadarPosBase(
-        RadarPos currPos,
+    // adds targets in priority order while they fit in radar view
+    void SelectTargetsGreedy(
         RadarTargetPos currTargetPos,
         const std::vector<int>& currFollowedTargetIds,
-        const std::vector<const Target*>& targetsInsideResponsible, // sorted by priorities
-        const std::vector<const Target*>& targetsOutsideResponsible, // sorted by priorities
-        const Proto::Parameters& params
+        const TargetList& targets, // sorted by priorities
+        const RuntimeParams& params,
+        RotationTimeCache& rotationTimes,
+        std::pmr::memory_resource* arena,
+        std::pmr::vector<int>& followedTargetIds,
+        AngleList& followedTargetAngles
     ) {
-        if (targetsInsideResponsible.empty() && targetsOutsideResponsible.empty()) {
-            return {currTargetPos, {}};
-        }
-
-        const auto viewAngle = params.small_radar().view_angle();
-        const auto maxSpeed  = params.small_radar().max_angle_speed();
-        const auto maxEps    = params.small_radar().max_eps();
-        const auto margin    = params.general().margin_angle();
+        const auto viewAngle = params.SmallRadarViewAngle;
+        const auto margin    = params.MarginAngle;
 
         const auto halfview = viewAngle / 2;
-        const auto willAngL = currPos.Angle - halfview + margin;
-        const auto willAngR = currPos.Angle + halfview - margin;
-
-        std::vector<int> followedTargetIds;
-        std::vector<double> followedTargetAngles;
+        const auto willAngL = currTargetPos.Angle - halfview + margin;
+        const auto willAngR = currTargetPos.Angle + halfview - margin;
 
-        for (const auto* target : targetsInsideResponsible) {
-            auto targetAngles = GetTargetAngles(target);
+        for (const auto* target : targets) {
+            auto targetAngles = GetTargetAngles(target, arena);
 
             if (CanAddToAngleArray(viewAngle - 2 * margin, followedTargetAngles, targetAngles)) {
-                if (
-                    !IsInSegment(targetAngles, willAngL, willAngR)
-                    && !IsInVector(currFollowedTargetIds, target->GetId())
-                ) {
-                    auto timeToRotate = TimeToRotateToTarget(
-                        currPos, currTargetPos, targetAngles, maxSpeed, maxEps, viewAngle, margin
-                    );
+                if (!IsInSegment(targetAngles, willAngL, willAngR)) {
+                    auto timeToRotate = rotationTimes.GetTimeToRotate(targetAngles);
                     auto timeToNear = target->GetTimeToNearPoint();
 
-                    std::vector<int> targetsToHitIds;
-                    std::vector<double> targetsToHitAngles;
+                    std::pmr::vector<int> targetsToHitIds(arena);
+                    AngleList targetsToHitAngles(arena);
                     for (auto id : currFollowedTargetIds) {
-                        const auto* followedTarget = GetTargetById(targetsInsideResponsible, id);
+                        // followed target may have moved to other side of responsible sector
+                        const auto* followedTarget = FindTargetById(targets, id);
+                        if (!followedTarget) {
+                            continue;
+                        }
                         auto timeToMeet = followedTarget->GetTimeToMeetPoint();
                         if (
                             followedTarget->IsRocketLaunched()
@@ -94,7 +95,7 @@ namespace {
                             || timeToMeet + timeToRotate < timeToNear
                         ) {
                             targetsToHitIds.push_back(id);
-                            JoinToVector(targetsToHitAngles, GetTargetAngles(followedTarget));
+                            JoinToVector(targetsToHitAngles, GetTargetAngles(followedTarget, arena));
                         }
                     }
                     if (
@@ -111,225 +112,226 @@ namespace {
                 JoinToVector(followedTargetAngles, targetAngles);
             }
         }
-        if (followedTargetIds.empty()) {
-            for (const auto* target : targetsOutsideResponsible) {
-                auto targetAngles = GetTargetAngles(target);
-
-                if (CanAddToAngleArray(viewAngle - 2 * margin, followedTargetAngles, targetAngles)) {
-                    if (
-                        !IsInSegment(targetAngles, willAngL, willAngR)
-                        && !IsInVector(currFollowedTargetIds, target->GetId())
-                    ) {
-                        auto timeToRotate = TimeToRotateToTarget(
-                            currPos, currTargetPos, targetAngles, maxSpeed, maxEps, viewAngle, margin
-                        );
-                        auto timeToNear = target->GetTimeToNearPoint();
-
-                        std::vector<int> targetsToHitIds;
-                        std::vector<double> targetsToHitAngles;
-                        for (auto id : currFollowedTargetIds) {
-                            const auto* followedTarget = GetTargetById(targetsOutsideResponsible, id);
-                            auto timeToMeet = followedTarget->GetTimeToMeetPoint();
-                            if (
-                                followedTarget->IsRocketLaunched()
-                                || followedTarget->CanLaunchRocket()
-                                // radar should kill target and rotate to priority one before priority gets in near zone
-                                || timeToMeet + timeToRotate < timeToNear
-                            ) {
-                                targetsToHitIds.push_back(id);
-                                JoinToVector(targetsToHitAngles, GetTargetAngles(followedTarget));
-                            }
-                        }
-                        if (
-                            !targetsToHitIds.empty()
-                            && !CanAddToAngleArray(viewAngle - 2 * margin, targetsToHitAngles, targetAngles)
-                        ) {
-                            followedTargetIds = targetsToHitIds;
-                            followedTargetAngles = targetsToHitAngles;
-                            break;
-                        }
-                    }
-
-                    followedTargetIds.push_back(target->GetId());
-                    JoinToVector(followedTargetAngles, targetAngles);
-                }
-            }
-        } else {
-            for (const auto* target : targetsOutsideResponsible) {
-                auto targetAngles = GetTargetAngles(target);
+    }
 
-                if (CanAddToAngleArray(viewAngle - 2 * margin, followedTargetAngles, targetAngles)) {
-                    followedTargetIds.push_back(target->GetId());
-                    JoinToVector(followedTargetAngles, targetAngles);
-                }
-            }
+    // selects window of radar view with max total weight of targets, targets which are already hit are kept
+    void SelectTargetsOptimal(
+        RadarPos currPos,
+        const std::vector<int>& currFollowedTargetIds,
+        const TargetList& targets, // sorted by priorities
+        const RuntimeParams& params,
+        std::pmr::memory_resource* arena,
+        std::pmr::vector<int>& followedTargetIds,
+        AngleList& followedTargetAngles
+    ) {
+        const auto viewAngle = params.SmallRadarViewAngle;
+        const auto margin    = params.MarginAngle;
+        const bool isCountWeight =
+            params.TargetSelection == Proto::Parameters::General::SWEEP_LINE_MAX_COUNT;
+
+        std::pmr::vector<AngleWindowCandidate> candidates(arena);
+        candidates.reserve(targets.size());
+        double totalWeight = 0;
+        for (const auto* target : targets) {
+            auto targetAngles = GetTargetAngles(target, arena);
+            candidates.push_back(AngleWindowCandidate{
+                .MinAngle = *std::min_element(targetAngles.begin(), targetAngles.end()),
+                .MaxAngle = *std::max_element(targetAngles.begin(), targetAngles.end()),
+                .Weight = (isCountWeight ? 1. : target->GetPriority())
+            });
+            totalWeight += candidates.back().Weight;
         }
-        double nextTargetAngle = -1;
-        for (const Target* target : targetsInsideResponsible) {
-            if (!IsInVector(followedTargetIds, target->GetId())) {
-                nextTargetAngle = target->GetPosAngle();
-                break;
+        for (int i = 0; i < targets.size(); ++i) {
+            const auto* target = targets[i];
+            if (
+                IsInVector(currFollowedTargetIds, target->GetId())
+                && (target->IsRocketLaunched() || target->CanLaunchRocket())
+            ) {
+                candidates[i].Weight += totalWeight + 1;
             }
         }
-        if (nextTargetAngle == -1) {
-            for (const Target* target : targetsOutsideResponsible) {
-                if (!IsInVector(followedTargetIds, target->GetId())) {
-                    nextTargetAngle = target->GetPosAngle();
-                    break;
-                }
-            }
+
+        auto selected = SelectAngleWindow(
+            candidates,
+            viewAngle - 2 * margin,
+            currPos.Angle - viewAngle / 2 + margin,
+            arena
+        );
+        for (auto idx : selected) {
+            followedTargetIds.push_back(targets[idx]->GetId());
+            JoinToVector(followedTargetAngles, GetTargetAngles(targets[idx], arena));
         }
-        if (nextTargetAngle != -1) {
-            auto minAngle = *std::min_element(followedTargetAngles.begin(), followedTargetAngles.end());
-            auto maxAngle = *std::max_element(followedTargetAngles.begin(), followedTargetAngles.end());
-            if (nextTargetAngle > maxAngle) {
-                followedTargetAngles.push_back(minAngle + viewAngle - 2 * margin);
-            } else if (nextTargetAngle < minAngle) {
-                followedTargetAngles.push_back(maxAngle - viewAngle + 2 * margin);
-            }
+    }
+
+    // selects first view window of best plan, targets on both sides of responsible sector are planned
+    void SelectTargetsPlanned(
+        RadarPos currPos,
+        RadarPos shipCurrPos,
+        RadarTargetPos shipCurrTargetPos,
+        const std::vector<int>& currFollowedTargetIds,
+        const TargetList& targetsInsideResponsible,
+        const TargetList& targetsOutsideResponsible,
+        const RuntimeParams& params,
+        RotationTimeCache& rotationTimes,
+        bool isShipControlled,
+        RadarPlanner& planner,
+        std::pmr::memory_resource* arena,
+        std::pmr::vector<int>& followedTargetIds,
+        AngleList& followedTargetAngles
+    ) {
+        // targets of other sectors are served only if it is cheap
+        const double outsideWeightShare = 0.1;
+        const double measurePeriod = params.SmallRadarPeriod;
+        const double inf = std::numeric_limits<double>::infinity();
+
+        TargetList targets(arena);
+        targets.reserve(targetsInsideResponsible.size() + targetsOutsideResponsible.size());
+        targets.insert(targets.end(), targetsInsideResponsible.begin(), targetsInsideResponsible.end());
+        targets.insert(targets.end(), targetsOutsideResponsible.begin(), targetsOutsideResponsible.end());
+
+        std::pmr::vector<RadarPlanner::Track> tracks(arena);
+        tracks.reserve(targets.size());
+        for (int i = 0; i < targets.size(); ++i) {
+            const auto* target = targets[i];
+            auto targetAngles = GetTargetAngles(target, arena);
+            const bool isPinned =
+                IsInVector(currFollowedTargetIds, target->GetId())
+                && (target->IsRocketLaunched() || target->CanLaunchRocket());
+            const double distance = Distance(target->GetPosition(), Vector3d::Zero());
+
+            tracks.push_back(RadarPlanner::Track{
+                .Id = target->GetId(),
+                .MinAngle = *std::min_element(targetAngles.begin(), targetAngles.end()),
+                .MaxAngle = *std::max_element(targetAngles.begin(), targetAngles.end()),
+                .Weight = (
+                    target->IsRocketLaunched() && !isPinned
+                    ? 0.
+                    : target->GetPriority() * (i < targetsInsideResponsible.size() ? 1. : outsideWeightShare)
+                ),
+                .ReadyTime = (
+                    target->CanBeInRadarSector()
+                    ? 0.
+                    : (target->GetEntryAngle() != -1 ? target->GetTimeToEntryPoint() : inf)
+                ),
+                .MeasureTime = target->GetMeasureCountToPreciseSpeed() * measurePeriod,
+                .Deadline = (
+                    target->GetSpeedAbs() > 0
+                    ? distance / target->GetSpeedAbs() - params.TimeToLaunchRocket
+                    : inf
+                ),
+                .IsPinned = isPinned
+            });
         }
-        auto newTargetRadarAngle = CalculateRadarAngleMultiTarget(
-            currPos.Angle,
-            currTargetPos.Angle,
-            followedTargetAngles,
-            viewAngle,
-            margin
+
+        auto selected = planner.Plan(
+            tracks,
+            currPos,
+            rotationTimes,
+            shipCurrPos,
+            shipCurrTargetPos.Angle,
+            isShipControlled,
+            arena
         );
-        return {RadarTargetPos{.Angle=newTargetRadarAngle, .Speed=maxSpeed}, followedTargetIds};
+        for (auto idx : selected) {
+            followedTargetIds.push_back(targets[idx]->GetId());
+            JoinToVector(followedTargetAngles, GetTargetAngles(targets[idx], arena));
+        }
     }
 
-    std::pair<std::pair<RadarTargetPos, RadarTargetPos>, std::vector<int>> CalculateRadarPosImproved(
+    std::pair<std::pair<RadarTargetPos, RadarTargetPos>, std::pmr::vector<int>> CalculateRadarPosImproved(
         RadarPos currPos,
         RadarTargetPos currTargetPos,
         RadarPos shipCurrPos,
         RadarTargetPos shipCurrTargetPos,
         const std::vector<int>& currFollowedTargetIds,
-        const std::vector<const Target*>& targetsInsideResponsible, // sorted by priorities
-        const std::vector<const Target*>& targetsOutsideResponsible, // sorted by priorities
-        const Proto::Parameters& params
+        const TargetList& targetsInsideResponsible, // sorted by priorities
+        const TargetList& targetsOutsideResponsible, // sorted by priorities
+        const RuntimeParams& params,
+        RotationTimeCache& rotationTimes, // filled for currPos and currTargetPos
+        bool isShipControlled, // otherwise ship keeps shipCurrTargetPos
+        RadarPlanner& planner,
+        std::pmr::memory_resource* arena // all returned and temporary containers are allocated here
     ) {
         if (targetsInsideResponsible.empty() && targetsOutsideResponsible.empty()) {
-            return {{currTargetPos, shipCurrTargetPos}, {}};
+            return {{currTargetPos, shipCurrTargetPos}, std::pmr::vector<int>(arena)};
         }
 
-        const auto viewAngle = params.small_radar().view_angle();
-        const auto maxSpeed  = params.small_radar().max_angle_speed();
-        const auto maxEps    = params.small_radar().max_eps();
-        const auto margin    = params.general().margin_angle();
+        const auto viewAngle = params.SmallRadarViewAngle;
+        const auto maxSpeed  = params.SmallRadarMaxAngleSpeed;
+        const auto margin    = params.MarginAngle;
 
         const auto halfview = viewAngle / 2;
         const auto angL     = currPos.Angle - halfview + margin;
         const auto angR     = currPos.Angle + halfview - margin;
-        const auto willAngL = currTargetPos.Angle - halfview + margin;
-        const auto willAngR = currTargetPos.Angle + halfview - margin;
-
-        const auto deadZones = SegmentsFromProto(params.ship().dead_zones());
 
-        std::vector<int> followedTargetIds;
-        std::vector<double> followedTargetAngles;
+        const auto& deadZones = params.DeadZones;
 
-        for (const auto* target : targetsInsideResponsible) {
-            auto targetAngles = GetTargetAngles(target);
+        std::pmr::vector<int> followedTargetIds(arena);
+        AngleList followedTargetAngles(arena);
 
-            if (CanAddToAngleArray(viewAngle - 2 * margin, followedTargetAngles, targetAngles)) {
-                if (!IsInSegment(targetAngles, willAngL, willAngR)) {
-                    auto timeToRotate = TimeToRotateToTarget(
-                        currPos, currTargetPos, targetAngles, maxSpeed, maxEps, viewAngle, margin
-                    );
-                    auto timeToNear = target->GetTimeToNearPoint();
-
-                    std::vector<int> targetsToHitIds;
-                    std::vector<double> targetsToHitAngles;
-                    for (auto id : currFollowedTargetIds) {
-                        const auto* followedTarget = GetTargetById(targetsInsideResponsible, id);
-                        auto timeToMeet = followedTarget->GetTimeToMeetPoint();
-                        if (
-                            followedTarget->IsRocketLaunched()
-                            || followedTarget->CanLaunchRocket()
-                            // radar should kill target and rotate to priority one before priority gets in near zone
-                            || timeToMeet + timeToRotate < timeToNear
-                        ) {
-                            targetsToHitIds.push_back(id);
-                            JoinToVector(targetsToHitAngles, GetTargetAngles(followedTarget));
-                        }
-                    }
-                    if (
-                        !targetsToHitIds.empty()
-                        && !CanAddToAngleArray(viewAngle - 2 * margin, targetsToHitAngles, targetAngles)
-                    ) {
-                        followedTargetIds = targetsToHitIds;
-                        followedTargetAngles = targetsToHitAngles;
-                        break;
-                    }
-                }
-
-                followedTargetIds.push_back(target->GetId());
-                JoinToVector(followedTargetAngles, targetAngles);
+        const bool isGreedySelection =
+            params.TargetSelection == Proto::Parameters::General::GREEDY;
+        bool isOutsideTargetsChecked = false;
+        if (params.TargetSelection == Proto::Parameters::General::BEAM_SEARCH) {
+            SelectTargetsPlanned(
+                currPos, shipCurrPos, shipCurrTargetPos, currFollowedTargetIds,
+                targetsInsideResponsible, targetsOutsideResponsible, params, rotationTimes, isShipControlled,
+                planner, arena, followedTargetIds, followedTargetAngles
+            );
+            isOutsideTargetsChecked = !followedTargetIds.empty();
+        }
+        // planner may find no target to serve, then targets are selected as without it
+        if (followedTargetIds.empty()) {
+            if (isGreedySelection) {
+                SelectTargetsGreedy(
+                    currTargetPos, currFollowedTargetIds, targetsInsideResponsible, params, rotationTimes, arena,
+                    followedTargetIds, followedTargetAngles
+                );
+            } else {
+                SelectTargetsOptimal(
+                    currPos, currFollowedTargetIds, targetsInsideResponsible, params, arena,
+                    followedTargetIds, followedTargetAngles
+                );
             }
         }
 
-        bool isOutsideTargetsChecked = false;
-
         if (followedTargetIds.empty()) {
             isOutsideTargetsChecked = true;
-            for (const auto* target : targetsOutsideResponsible) {
-                auto targetAngles = GetTargetAngles(target);
-
-                if (CanAddToAngleArray(viewAngle - 2 * margin, followedTargetAngles, targetAngles)) {
-                    if (!IsInSegment(targetAngles, willAngL, willAngR)) {
-                        auto timeToRotate = TimeToRotateToTarget(
-                            currPos, currTargetPos, targetAngles, maxSpeed, maxEps, viewAngle, margin
-                        );
-                        auto timeToNear = target->GetTimeToNearPoint();
-
-                        std::vector<int> targetsToHitIds;
-                        std::vector<double> targetsToHitAngles;
-                        for (auto id : currFollowedTargetIds) {
-                            const auto* followedTarget = GetTargetById(targetsOutsideResponsible, id);
-                            auto timeToMeet = followedTarget->GetTimeToMeetPoint();
-                            if (
-                                followedTarget->IsRocketLaunched()
-                                || followedTarget->CanLaunchRocket()
-                                // radar should kill target and rotate to priority one before priority gets in near zone
-                                || timeToMeet + timeToRotate < timeToNear
-                            ) {
-                                targetsToHitIds.push_back(id);
-                                JoinToVector(targetsToHitAngles, GetTargetAngles(followedTarget));
-                            }
-                        }
-                        if (
-                            !targetsToHitIds.empty()
-                            && !CanAddToAngleArray(viewAngle - 2 * margin, targetsToHitAngles, targetAngles)
-                        ) {
-                            followedTargetIds = targetsToHitIds;
-                            followedTargetAngles = targetsToHitAngles;
-                            break;
-                        }
-                    }
-
-                    followedTargetIds.push_back(target->GetId());
-                    JoinToVector(followedTargetAngles, targetAngles);
-                }
+            if (isGreedySelection) {
+                SelectTargetsGreedy(
+                    currTargetPos, currFollowedTargetIds, targetsOutsideResponsible, params, rotationTimes, arena,
+                    followedTargetIds, followedTargetAngles
+                );
+            } else {
+                SelectTargetsOptimal(
+                    currPos, currFollowedTargetIds, targetsOutsideResponsible, params, arena,
+                    followedTargetIds, followedTargetAngles
+                );
             }
         }
 
-        auto invertedDeadZones = InvertSegments(deadZones, M_PI, margin);
+        auto invertedDeadZones = deadZones;
+        invertedDeadZones.Invert(M_PI, margin);
 
-        auto newShipTargetAngle = CalculateShipAngleMultiTarget(
-            shipCurrPos.Angle,
-            shipCurrTargetPos.Angle,
-            followedTargetAngles,
-            invertedDeadZones
-        );
-        const auto willDeadZones = ShiftedSegmentsFromProto(params.ship().dead_zones(), newShipTargetAngle);
+        auto newShipTargetAngle = (shipCurrTargetPos.Angle == -1 ? shipCurrPos.Angle : shipCurrTargetPos.Angle);
+        if (isShipControlled) {
+            newShipTargetAngle = CalculateShipAngleMultiTarget(
+                shipCurrPos.Angle,
+                shipCurrTargetPos.Angle,
+                followedTargetAngles,
+                invertedDeadZones
+            );
+        }
+        auto willDeadZones = deadZones;
+        willDeadZones.Shift(newShipTargetAngle);
 
         if (!isOutsideTargetsChecked) {
             for (const auto* target : targetsOutsideResponsible) {
-                auto targetAngles = GetTargetAngles(target);
+                auto targetAngles = GetTargetAngles(target, arena);
 
                 if (
                     CanAddToAngleArray(viewAngle - 2 * margin, followedTargetAngles, targetAngles)
-                    && !IsInAnySegment(willDeadZones, targetAngles[0])
+                    && !willDeadZones.Contains(targetAngles[0])
                 ) {
                     followedTargetIds.push_back(target->GetId());
                     JoinToVector(followedTargetAngles, targetAngles);
@@ -370,18 +372,19 @@ namespace {
         if (nextTargetAngle != -1 && IsInSegment(followedTargetAngles, angL, angR)) {
             const auto newWillAngL = newRadarTargetAngle - halfview + margin;
             const auto newWillAngR = newRadarTargetAngle + halfview - margin;
-            const auto invertedWillDeadZones = InvertSegments(willDeadZones, M_PI, margin);
+            auto invertedWillDeadZones = willDeadZones;
+            invertedWillDeadZones.Invert(M_PI, margin);
 
             double maxDownRadar = 1e9, maxUpRadar = 1e9;
             double maxDownShip = 1e9, maxUpShip = 1e9;
             for (const auto* target : targetsInsideResponsible) {
                 if (IsInVector(followedTargetIds, target->GetId())) {
                     timeToReach = std::max(timeToReach, target->GetTimeToMeetPoint());
-                    auto targetAngle = GetTargetAngles(target)[0];
+                    auto targetAngle = GetTargetAngles(target, arena)[0];
                     maxDownRadar = std::min(maxDownRadar, newWillAngR - targetAngle);
                     maxUpRadar = std::min(maxUpRadar, targetAngle - newWillAngL);
 
-                    auto segIdx = InWhichSegment(invertedWillDeadZones, targetAngle);
+                    auto segIdx = invertedWillDeadZones.Find(targetAngle);
                     if (segIdx != -1) {
                         maxDownShip = std::min(maxDownShip, invertedWillDeadZones[segIdx].second - targetAngle);
                         maxUpShip = std::min(maxUpShip, targetAngle - invertedWillDeadZones[segIdx].first);
@@ -391,11 +394,11 @@ namespace {
             for (const auto* target : targetsOutsideResponsible) {
                 if (IsInVector(followedTargetIds, target->GetId())) {
                     timeToReach = std::max(timeToReach, target->GetTimeToMeetPoint());
-                    auto targetAngle = GetTargetAngles(target)[0];
+                    auto targetAngle = GetTargetAngles(target, arena)[0];
                     maxDownRadar = std::min(maxDownRadar, newWillAngR - targetAngle);
                     maxUpRadar = std::min(maxUpRadar, targetAngle - newWillAngL);
 
-                    auto segIdx = InWhichSegment(invertedWillDeadZones, targetAngle);
+                    auto segIdx = invertedWillDeadZones.Find(targetAngle);
                     if (segIdx != -1) {
                         maxDownShip = std::min(maxDownShip, invertedWillDeadZones[segIdx].second - targetAngle);
                         maxUpShip = std::min(maxUpShip, targetAngle - invertedWillDeadZones[segIdx].first);
@@ -410,6 +413,9 @@ namespace {
             }
 
             for (auto seg : willDeadZones) {
+                if (!isShipControlled) {
+                    break;
+                }
                 if (IsInSegment(nextTargetAngle, seg.first - margin, seg.second + margin)) {
                     if (nextTargetAngle - seg.first < seg.second - nextTargetAngle) {
                         newShipTargetAngle += std::min(maxUpShip, nextTargetAngle - seg.first + margin);
@@ -420,12 +426,12 @@ namespace {
                 }
             }
 
-            timeToReach += params.general().margin_time();
+            timeToReach += params.MarginTime;
         }
         return {
             {
                 RadarTargetPos{.Angle=newRadarTargetAngle, .Speed=maxSpeed, .TimeToReach=timeToReach},
-                RadarTargetPos{.Angle=newShipTargetAngle, .Speed=params.ship().max_angle_speed(), .TimeToReach=timeToReach}
+                RadarTargetPos{.Angle=newShipTargetAngle, .Speed=params.ShipMaxAngleSpeed, .TimeToReach=timeToReach}
             },
             followedTargetIds
         };
@@ -439,30 +445,35 @@ Target::Target(int id, double presetPriority, double deathTime, const Proto::Par
     , PresetPriority(presetPriority)
     , SmallRadarRadius(params.small_radar().radius())
     , DeathTime(deathTime)
+    , IsKalmanFilter(params.general().track_filter() == Proto::Parameters::General::KALMAN)
+    , Kalman(params.general().kalman_measurement_stddev(), params.general().kalman_acceleration_stddev())
+    , KalmanInitialSpeedStddev(params.simulator().max_target_speed())
+    , KalmanPreciseSpeedStddev(params.general().kalman_precise_speed_stddev())
     , BigRadarMeasureCount(params.general().big_radar_measure_cnt())
     , SmallRadarMeasureCount(params.general().small_radar_measure_cnt())
     , ApproxSmallRadarMeasureCount(params.general().aprox_small_radar_measure_cnt())
 {}
 
-Target::Target(const BigRadarData& data, double deathTime, const Proto::Parameters& params)
+Target::Target(const BigRadarData& data, double deathTime, const Proto::Parameters& params, double ageMs)
     : Target(data.Id, data.PresetPriority, deathTime, params)
 {
-    BigRadarUpdate(data.Pos, data.Speed);
+    BigRadarUpdate(data.Pos, data.Speed, ageMs);
 }
 
-void Target::BigRadarUpdate(Vector3d pos, Vector3d speed) {
-    Timer.Restart();
-    if (Pos == pos) {
+void Target::BigRadarUpdate(Vector3d pos, Vector3d speed, double ageMs) {
+    Timer.Restart(ageMs);
+    if (Pos == pos || LastBigRadarPos == pos) {
         return;
     }
 
-    Pos = pos;
+    LastBigRadarPos = pos;
+    SetPosition(pos);
     SpeedFromBigRadar = speed;
     ++CurrBigRadarMeasureCount;
 
     if (CurrBigRadarMeasureCount >= BigRadarMeasureCount) {
         if (CanBeInRadarSector()) {
-            EntryPoint = Vector3d::Zero();
+            SetEntryPoint(Vector3d::Zero());
         } else {
             SetNeedToUpdateEntryPoint(true);
         }
@@ -470,28 +481,90 @@ void Target::BigRadarUpdate(Vector3d pos, Vector3d speed) {
         SetNeedToUpdateMeetPoint(true);
     }
     CurrSmallRadarMeasureCount = 0;
+    UpdateKinematics();
 }
 
-void Target::SmallRadarUpdate(Vector3d pos) {
+void Target::SmallRadarUpdate(Vector3d pos, double ageMs) {
     if (UnfilteredPos == pos) {
         return;
     }
 
-    int dt = Timer.GetElapsedTimeAsMs();
-    Timer.Restart();
+    double dt = Timer.GetElapsedTimeAsPreciseMs() - ageMs;
+    Timer.Restart(ageMs);
 
     UnfilteredPos = pos;
 
-    auto filtered = ABFilter(UnfilteredPos, Pos, FilteredSpeed, dt, CurrSmallRadarMeasureCount);
-    Pos = filtered.first;
-    FilteredSpeed = filtered.second;
+    if (IsKalmanFilter) {
+        // speed from big radar is used as prior, so speed converges with fewer measurements
+        if (CurrSmallRadarMeasureCount == 0) {
+            Kalman.Reset(UnfilteredPos, SpeedFromBigRadar, KalmanInitialSpeedStddev);
+        } else {
+            Kalman.Update(UnfilteredPos, dt);
+        }
+        SetPosition(Kalman.GetPosition());
+        FilteredSpeed = Kalman.GetSpeed();
+        KalmanMeasureCountToPreciseSpeed =
+            Kalman.GetUpdatesCountToSpeedStddev(KalmanPreciseSpeedStddev, dt, SmallRadarMeasureCount);
+    } else {
+        auto filtered = ABFilter(UnfilteredPos, Pos, FilteredSpeed, dt, CurrSmallRadarMeasureCount);
+        SetPosition(filtered.first);
+        FilteredSpeed = filtered.second;
+    }
 
-    if (CurrSmallRadarMeasureCount >= ApproxSmallRadarMeasureCount) {
+    if (IsKalmanFilter || CurrSmallRadarMeasureCount >= ApproxSmallRadarMeasureCount) {
         SetNeedToUpdateNearPoint(true);
         SetNeedToUpdateMeetPoint(true);
     }
-    EntryPoint = Vector3d::Zero();
     ++CurrSmallRadarMeasureCount;
+    UpdateKinematics();
+    SetEntryPoint(Vector3d::Zero());
+}
+
+void Target::UpdateKinematics() {
+    // Kalman filter starts from speed of big radar and weighs it by its covariance, so its speed is used right away
+    const bool isFilteredSpeedKnown = (
+        IsKalmanFilter
+        ? CurrSmallRadarMeasureCount > 0
+        : CurrSmallRadarMeasureCount >= ApproxSmallRadarMeasureCount
+    );
+    Speed = (isFilteredSpeedKnown ? FilteredSpeed : SpeedFromBigRadar);
+    SpeedAbs = SqrtOfSumSquares(Speed);
+    TimeToEntryPoint = TimeToPoint(EntryPoint);
+    TimeToNearPoint = TimeToPoint(NearPoint);
+    TimeToMeetPoint = TimeToPoint(ApproximateMeetPoint);
+}
+
+int Target::GetMeasureCountToPreciseSpeed() const {
+    if (!IsKalmanFilter || CurrSmallRadarMeasureCount == 0) {
+        return std::max(0, SmallRadarMeasureCount - CurrSmallRadarMeasureCount);
+    }
+    // speed is precise either when it is confident enough or after as many measurements as with alpha-beta filter
+    return std::min(
+        KalmanMeasureCountToPreciseSpeed,
+        std::max(0, SmallRadarMeasureCount - CurrSmallRadarMeasureCount)
+    );
+}
+
+const KalmanFilter::Covariance* Target::GetCovariance() const {
+    if (!IsKalmanFilter || CurrSmallRadarMeasureCount == 0) {
+        return nullptr;
+    }
+    return &Kalman.GetCovariance();
+}
+
+bool Target::IsGeometryChanged(double posTolerance, double speedTolerance, bool isInRadarSector) const {
+    // target is expected to keep moving with the same speed
+    auto predictedPos = GeometryPos + GeometrySpeed * GeometryTimer.GetElapsedTimeAsPreciseMs();
+    return isInRadarSector != GeometryInRadarSector
+        || Distance(Pos, predictedPos) > posTolerance
+        || Distance(GetFilteredSpeed(), GeometrySpeed) > speedTolerance;
+}
+
+void Target::SetGeometryCalculated(bool isInRadarSector) {
+    GeometryPos = Pos;
+    GeometrySpeed = GetFilteredSpeed();
+    GeometryInRadarSector = isInRadarSector;
+    GeometryTimer.Restart();
 }
 
 bool Target::IsInSector(double rad, double angView, double angPos) const {
@@ -515,115 +588,206 @@ std::string Target::DebugString() const {
 }
 
 
-RadarController::RadarController(const Proto::Parameters& params, double startAngle, double shipStartAngle)
+RadarController::RadarController(
+    const Proto::Parameters& params,
+    double startAngle,
+    double shipStartAngle,
+    bool isShipControlled,
+    int firstLauncherId,
+    TaskScheduler* scheduler
+)
     : Params(params)
+    , Runtime(CompileParams(params))
+    , IsShipControlled(isShipControlled)
     , Pos{.Angle = startAngle, .Speed = 0}
     , TargetPos{.Angle = -1, .Speed = 0}
     , ShipPos{.Angle = shipStartAngle, .Speed = 0}
     , ShipTargetPos{.Angle = -1, .Speed = 0}
-{}
+    , RotationTimes(Runtime)
+    , Planner(params, scheduler)
+    , Scheduler(scheduler)
+    , TickArenaBuffer(params.general().tick_arena_size())
+    , TickArena(TickArenaBuffer.data(), TickArenaBuffer.size(), &TickArenaUpstream)
+{
+    if (Runtime.HasLaunchers) {
+        const int magazineSize = Runtime.MagazineSize;
+        for (int i = 0; i < Runtime.LaunchersCount; ++i) {
+            Launchers.push_back(Launcher{
+                .Id = firstLauncherId + i,
+                .RocketsLeft = (magazineSize == 0 ? -1 : magazineSize)
+            });
+        }
+    }
+}
 
 void RadarController::Process(
     const std::vector<BigRadarData>& bigDatas,
     const std::vector<SmallRadarData>& smallDatas
 ) {
-    // update from radars
-    std::set<int> updatedTargets;
-    for (const auto& data : smallDatas) {
-        for (auto* target : Targets) {
-            if (target->GetId() != data.Id) continue;
+    SimpleTimer timer;
+    // containers of previous Process are gone, so its memory is reused
+    TickArena.release();
 
-            target->SmallRadarUpdate(data.Pos);
-            updatedTargets.insert(data.Id);
-            break;
+    TargetsById targetsById(&TickArena);
+    for (auto* target : Targets) {
+        targetsById.emplace(target->GetId(), target);
+    }
+    UpdateFromRadars(bigDatas, smallDatas, 0, std::pmr::unordered_set<int>(&TickArena), targetsById);
+    ProcessTargets(timer);
+}
+
+void RadarController::ProcessFrames(const std::vector<Frame>& frames) {
+    SimpleTimer timer;
+    TickArena.release();
+
+    TargetsById targetsById(&TickArena);
+    for (auto* target : Targets) {
+        targetsById.emplace(target->GetId(), target);
+    }
+
+    // new big radar measurement resets position and small radar filter of track, so small radar measurements
+    // of earlier frames are superseded by it, unless it is ignored for small radar measurement of its own frame,
+    // resent big radar measurement is ignored by track and supersedes nothing
+    std::pmr::unordered_map<int, int> lastBigFrames(&TickArena); // track id -> frame
+    std::pmr::unordered_map<int, Vector3d> lastBigPositions(&TickArena); // track id -> position
+    std::pmr::unordered_set<int> frameSmallIds(&TickArena);
+    for (int i = 0; i < frames.size(); ++i) {
+        frameSmallIds.clear();
+        for (const auto& data : frames[i].SmallDatas) {
+            frameSmallIds.insert(data.Id);
+        }
+        for (const auto& data : frames[i].BigDatas) {
+            if (frameSmallIds.count(data.Id)) continue;
+
+            auto it = lastBigPositions.find(data.Id);
+            if (it == lastBigPositions.end()) {
+                auto targetIt = targetsById.find(data.Id);
+                if (targetIt != targetsById.end()) {
+                    it = lastBigPositions.emplace(data.Id, targetIt->second->GetLastBigRadarPosition()).first;
+                }
+            }
+            if (it != lastBigPositions.end() && it->second == data.Pos) continue;
+
+            lastBigPositions[data.Id] = data.Pos;
+            lastBigFrames[data.Id] = i;
+        }
+    }
+    std::pmr::unordered_set<int> supersededIds(&TickArena);
+    for (int i = 0; i < frames.size(); ++i) {
+        supersededIds.clear();
+        for (const auto& data : frames[i].SmallDatas) {
+            auto it = lastBigFrames.find(data.Id);
+            if (it != lastBigFrames.end() && it->second > i) {
+                supersededIds.insert(data.Id);
+                ++LastProcessStats.TotalCoalescedMeasurementsCount;
+            }
         }
+        UpdateFromRadars(frames[i].BigDatas, frames[i].SmallDatas, frames[i].AgeMs, supersededIds, targetsById);
+    }
+    ProcessTargets(timer);
+}
+
+void RadarController::UpdateFromRadars(
+    const std::vector<BigRadarData>& bigDatas,
+    const std::vector<SmallRadarData>& smallDatas,
+    double ageMs,
+    const std::pmr::unordered_set<int>& supersededIds,
+    TargetsById& targetsById
+) {
+    std::pmr::set<int> updatedTargets(&TickArena);
+    for (const auto& data : smallDatas) {
+        auto it = targetsById.find(data.Id);
+        if (it == targetsById.end() || supersededIds.count(data.Id)) continue;
+
+        it->second->SmallRadarUpdate(data.Pos, ageMs);
+        updatedTargets.insert(data.Id);
     }
     for (const auto& data : bigDatas) {
-        for (auto* target : Targets) {
-            if (target->GetId() != data.Id || updatedTargets.count(data.Id)) continue;
+        if (updatedTargets.count(data.Id)) continue;
 
-            target->BigRadarUpdate(data.Pos, data.Speed);
-            updatedTargets.insert(data.Id);
-            break;
-        }
-        if (!updatedTargets.count(data.Id)) {
-            Targets.push_back(new Target(data, Params.general().death_time(), Params));
+        auto it = targetsById.find(data.Id);
+        if (it != targetsById.end()) {
+            it->second->BigRadarUpdate(data.Pos, data.Speed, ageMs);
+        } else {
+            Targets.push_back(new Target(data, Runtime.DeathTime, Params, ageMs));
+            targetsById.emplace(data.Id, Targets.back());
         }
+        updatedTargets.insert(data.Id);
     }
+}
+
+void RadarController::ProcessTargets(const SimpleTimer& timer) {
+    UpdatePosAngles();
+
+    // radar doesn't move during Process, so rotation times are shared by geometry and target selection
+    RotationTimes.Reset(Pos, TargetPos);
 
     // calculate entry and meet points
+    // followed and responsible targets are always updated, others only while time budget lasts
+    const double budgetMs = Runtime.ProcessBudget;
+    LastProcessStats.UpdatedTargetsCount = 0;
+    LastProcessStats.DeferredTargetsCount = 0;
+
+    std::pmr::vector<Target*> requiredTargets(&TickArena);
+    std::pmr::vector<Target*> deferrableTargets(&TickArena);
     for (auto* target : Targets) {
-        if (target->GetPriority() == -1 && (target->NeedToUpdateEntryPoint() || target->NeedToUpdateMeetPoint())) {
-            if (target->GetPresetPriority() != -1) {
-                target->SetPriority(target->GetPresetPriority());
-            } else {
-                target->SetPriority(
-                    CalculatePriority(
-                        target->GetPosition(),
-                        target->GetFilteredSpeed(),
-                        Params.simulator().max_target_speed()
-                    )
-                );
-            }
+        if (!target->NeedToUpdateGeometry()) continue;
+
+        if (
+            budgetMs > 0
+            && target->GetPriority() != -1
+            && !IsInVector(FollowedTargetIds, target->GetId())
+            && !IsTargetInResponsibleSector(target)
+        ) {
+            deferrableTargets.push_back(target);
+        } else {
+            requiredTargets.push_back(target);
         }
-        if (target->NeedToUpdateEntryPoint()) {
-            target->SetEntryPoint(
-                CalculateEntryPoint(
-                    target->GetPosition(),
-                    target->GetFilteredSpeed(),
-                    Params.small_radar().radius()
-                )
-            );
-            target->SetNeedToUpdateEntryPoint(false);
+    }
+    UpdateTargetsGeometry(requiredTargets.data(), requiredTargets.size());
+    for (auto* target : requiredTargets) {
+        target->SetDeferredTicksCount(0);
+    }
+    LastProcessStats.UpdatedTargetsCount += requiredTargets.size();
+
+    // targets deferred for more ticks go first, so low priority ones don't starve when budget runs out every tick
+    std::sort(
+        deferrableTargets.begin(),
+        deferrableTargets.end(),
+        [](const Target* l, const Target* r) {
+            if (l->GetDeferredTicksCount() != r->GetDeferredTicksCount()) {
+                return l->GetDeferredTicksCount() > r->GetDeferredTicksCount();
+            }
+            return l->GetPriority() > r->GetPriority();
         }
-        if (target->NeedToUpdateNearPoint()) {
-            target->SetNearPoint(
-                CalculateEntryPoint(
-                    target->GetPosition(),
-                    target->GetFilteredSpeed(),
-                    Params.small_radar().radius() * 0.5
-                )
-            );
-            target->SetNeedToUpdateNearPoint(false);
-        }
-        if (target->NeedToUpdateMeetPoint() && !target->IsRocketLaunched()) {
-            const double timeToCalculatePrecizeSpeed =
-                Params.general().small_radar_measure_cnt() / Params.small_radar().frequency() * 1000;
-            double timeToHit = Params.defense().time_to_launch_rocket();
-            if (IsTargetInRadarSector(target)) {
-                timeToHit += target->GetMeasureCountToPreciseSpeed() / Params.small_radar().frequency() * 1000;
-            } else {
-                auto timeToRotate = TimeToRotateToTarget(
-                    Pos,
-                    TargetPos,
-                    {target->GetPosAngle()},
-                    Params.small_radar().max_angle_speed(),
-                    Params.small_radar().max_eps(),
-                    Params.small_radar().view_angle(),
-                    Params.general().margin_angle()
-                );
-                if (
-                    !target->CanBeInRadarSector()
-                    && target->GetTimeToEntryPoint() + timeToCalculatePrecizeSpeed > timeToRotate
-                ) {
-                    timeToHit += target->GetTimeToEntryPoint() + timeToCalculatePrecizeSpeed;
-                } else {
-                    timeToHit += timeToRotate;
-                }
+    );
+    // budget is checked between chunks, chunk is big enough to be updated in parallel
+    const bool isParallel = Scheduler && Scheduler->GetThreadsCount() > 0;
+    const int chunkSize = (isParallel ? std::max(1, Runtime.GeometryParallelThreshold) : 1);
+    for (int i = 0; i < deferrableTargets.size(); i += chunkSize) {
+        if (timer.GetElapsedTimeAsPreciseMs() > budgetMs) {
+            // flags stay set, so targets will be updated on one of the next ticks
+            LastProcessStats.DeferredTargetsCount += deferrableTargets.size() - i;
+            for (int j = i; j < deferrableTargets.size(); ++j) {
+                auto* target = deferrableTargets[j];
+                target->SetDeferredTicksCount(target->GetDeferredTicksCount() + 1);
             }
-            target->SetApproximateMeetPoint(CalculateMeetPoint(
-                target->GetPosition() + target->GetFilteredSpeed() * timeToHit,
-                target->GetFilteredSpeed(),
-                Params.defense().rocket_speed()
-            ));
-            target->SetNeedToUpdateMeetPoint(false);
+            break;
+        }
+        const int count = std::min<int>(chunkSize, deferrableTargets.size() - i);
+        UpdateTargetsGeometry(deferrableTargets.data() + i, count);
+        for (int j = i; j < i + count; ++j) {
+            deferrableTargets[j]->SetDeferredTicksCount(0);
         }
+        LastProcessStats.UpdatedTargetsCount += count;
     }
+    LastProcessStats.TotalDeferredTargetsCount += LastProcessStats.DeferredTargetsCount;
+
     RemoveDeadTargets();
 
     // follow target
-    std::vector<const Target*> targetsInsideResponsible;
-    std::vector<const Target*> targetsOutsideResponsible;
+    TargetList targetsInsideResponsible(&TickArena);
+    TargetList targetsOutsideResponsible(&TickArena);
     for (const auto* target : Targets) {
         if (target->GetPriority() != -1) {
             if (IsTargetInResponsibleSector(target)) {
@@ -644,31 +808,168 @@ void RadarController::Process(
         FollowedTargetIds,
         targetsInsideResponsible,
         targetsOutsideResponsible,
-        Params
+        Runtime,
+        RotationTimes,
+        IsShipControlled,
+        Planner,
+        &TickArena
     );
 
     TargetPos = res.first.first;
-    ShipTargetPos = res.first.second;
-    FollowedTargetIds = res.second;
+    if (IsShipControlled) {
+        ShipTargetPos = res.first.second;
+    }
+    FollowedTargetIds.assign(res.second.begin(), res.second.end());
+
+    if (Runtime.HasLaunchers) {
+        AssignLaunchers();
+    } else {
+        LaunchRockets();
+    }
+    LastProcessStats.ElapsedMs = timer.GetElapsedTimeAsPreciseMs();
+}
 
+void RadarController::FollowShip(RadarPos shipPos, RadarTargetPos shipTargetPos) {
+    Pos.Angle += shipPos.Angle - ShipPos.Angle;
+    ShipPos = shipPos;
+    ShipTargetPos = shipTargetPos;
+}
+
+void RadarController::UpdatePosAngles() {
+    MovedTargets.clear();
+    MovedTargetsX.clear();
+    MovedTargetsY.clear();
     for (auto* target : Targets) {
-        auto id = target->GetId();
-        if (IsInVector(FollowedTargetIds, id) && target->CanLaunchRocket() && !target->IsRocketLaunched()) {
-            auto meetPoint = CalculateMeetPoint(
-                target->GetPosition() + target->GetFilteredSpeed() * Params.defense().time_to_launch_rocket(),
+        if (target->NeedToUpdatePosAngle()) {
+            MovedTargets.push_back(target);
+            MovedTargetsX.push_back(target->GetPosition().X);
+            MovedTargetsY.push_back(target->GetPosition().Y);
+        }
+    }
+    MovedTargetsAngles.resize(MovedTargets.size());
+    CalculateAngles(MovedTargetsX.data(), MovedTargetsY.data(), MovedTargetsAngles.data(), MovedTargets.size());
+    for (int i = 0; i < MovedTargets.size(); ++i) {
+        MovedTargets[i]->SetPosAngle(MovedTargetsAngles[i]);
+    }
+}
+
+void RadarController::UpdateTargetsGeometry(Target* const* targets, int count) {
+    if (!Scheduler || Scheduler->GetThreadsCount() == 0 || count < Runtime.GeometryParallelThreshold) {
+        for (int i = 0; i < count; ++i) {
+            LastProcessStats.SavedGeometryUpdatesCount += UpdateTargetGeometry(targets[i], false);
+        }
+        return;
+    }
+
+    // every task changes only its own target, counts are merged after all tasks are done
+    GeometrySavedCounts.assign(count, 0);
+    Scheduler->ParallelFor(count, [this, targets](int i) {
+        GeometrySavedCounts[i] = UpdateTargetGeometry(targets[i], true);
+    });
+    for (int savedCount : GeometrySavedCounts) {
+        LastProcessStats.SavedGeometryUpdatesCount += savedCount;
+    }
+}
+
+int RadarController::UpdateTargetGeometry(Target* target, bool isConcurrent) {
+    if (target->GetPriority() == -1 && (target->NeedToUpdateEntryPoint() || target->NeedToUpdateMeetPoint())) {
+        if (target->GetPresetPriority() != -1) {
+            target->SetPriority(target->GetPresetPriority());
+        } else {
+            target->SetPriority(
+                CalculatePriority(
+                    target->GetPosition(),
+                    target->GetFilteredSpeed(),
+                    Runtime.MaxTargetSpeed
+                )
+            );
+        }
+    }
+
+    // all requested points are kept if target moves as it was expected during their calculation
+    const bool isInRadarSector = IsTargetInRadarSector(target);
+    const bool needToUpdateMeetPoint = target->NeedToUpdateMeetPoint() && !target->IsRocketLaunched();
+    const bool isGeometryKept =
+        !target->IsGeometryChanged(
+            Runtime.GeometryPosTolerance,
+            Runtime.GeometrySpeedTolerance,
+            isInRadarSector
+        )
+        && (!target->NeedToUpdateEntryPoint() || target->GetEntryPoint() != Vector3d::Zero())
+        && (!target->NeedToUpdateNearPoint() || target->GetNearPoint() != Vector3d::Zero());
+    // meet point outside of radar sector depends on time to rotate radar to target, which changes as radar moves
+    const bool isMeetPointKept =
+        isInRadarSector && target->GetApproximateMeetPoint() != Vector3d::Zero();
+    int savedCount = 0;
+    if (isGeometryKept) {
+        savedCount = target->NeedToUpdateEntryPoint() + target->NeedToUpdateNearPoint();
+        target->SetNeedToUpdateEntryPoint(false);
+        target->SetNeedToUpdateNearPoint(false);
+        if (!needToUpdateMeetPoint || isMeetPointKept) {
+            if (needToUpdateMeetPoint) {
+                target->SetNeedToUpdateMeetPoint(false);
+                ++savedCount;
+            }
+            return savedCount;
+        }
+    } else {
+        target->SetGeometryCalculated(isInRadarSector);
+    }
+
+    if (target->NeedToUpdateEntryPoint()) {
+        target->SetEntryPoint(
+            CalculateEntryPoint(
+                target->GetPosition(),
+                target->GetFilteredSpeed(),
+                Runtime.SmallRadarRadius
+            )
+        );
+        target->SetNeedToUpdateEntryPoint(false);
+    }
+    if (target->NeedToUpdateNearPoint()) {
+        target->SetNearPoint(
+            CalculateEntryPoint(
+                target->GetPosition(),
                 target->GetFilteredSpeed(),
-                Params.defense().rocket_speed()
+                Runtime.SmallRadarRadius * 0.5
+            )
+        );
+        target->SetNeedToUpdateNearPoint(false);
+    }
+    if (needToUpdateMeetPoint) {
+        double timeToHit = Runtime.TimeToLaunchRocket;
+        if (isInRadarSector) {
+            timeToHit += target->GetMeasureCountToPreciseSpeed() * Runtime.SmallRadarPeriod;
+        } else {
+            const double timeToRotate = (
+                isConcurrent
+                ? RotationTimes.FindTimeToRotate(target->GetPosAngle(), target->GetPosAngle())
+                : RotationTimes.GetTimeToRotate(target->GetPosAngle(), target->GetPosAngle())
             );
-            MeetPointsAndTargetIds.emplace_back(meetPoint, id);
-            target->SetApproximateMeetPoint(meetPoint);
-            target->SetIsRocketLaunched(true);
+            if (
+                !target->CanBeInRadarSector()
+                && target->GetTimeToEntryPoint() + Runtime.TimeToPreciseSpeed > timeToRotate
+            ) {
+                timeToHit += target->GetTimeToEntryPoint() + Runtime.TimeToPreciseSpeed;
+            } else {
+                timeToHit += timeToRotate;
+            }
         }
+        target->SetApproximateMeetPoint(CalculateMeetPoint(
+            target->GetPosition() + target->GetFilteredSpeed() * timeToHit,
+            target->GetFilteredSpeed(),
+            Runtime.RocketSpeed
+        ));
+        target->SetNeedToUpdateMeetPoint(false);
     }
+    return savedCount;
 }
 
 void RadarController::RemoveDeadTargets() {
+    RemovedTargetIds.clear();
     for (int i = 0; i < Targets.size(); ++i) {
         if (Targets[i]->IsDead()) {
+            RemovedTargetIds.push_back(Targets[i]->GetId());
             if (!FollowedTargetIds.empty() && IsInVector(FollowedTargetIds, Targets[i]->GetId())) {
                 for (int j = 0; j < FollowedTargetIds.size(); ++j) {
                     if (FollowedTargetIds[j] == Targets[i]->GetId()) {
@@ -684,28 +985,228 @@ void RadarController::RemoveDeadTargets() {
     }
 }
 
-RadarController::Result RadarController::GetAngleAndMeetPoints() {
+void RadarController::LaunchRockets() {
+    for (auto* target : Targets) {
+        if (IsInVector(FollowedTargetIds, target->GetId()) && target->CanLaunchRocket() && !target->IsRocketLaunched()) {
+            LaunchRocket(target, -1);
+        }
+    }
+}
+
+void RadarController::AssignLaunchers() {
+    SimpleTimer timer;
+    const double timeToLaunchRocket = Runtime.TimeToLaunchRocket;
+    const double rocketSpeed = Runtime.RocketSpeed;
+    const double reloadTime = Runtime.ReloadTime;
+    const double measurePeriod = Runtime.SmallRadarPeriod;
+
+    // tracks which may get rocket, with the earliest time when rocket may be launched
+    std::pmr::vector<Target*> tracks(&TickArena);
+    std::pmr::vector<double> readyTimes(&TickArena);
+    std::pmr::vector<char> isReadyNow(&TickArena);
+    for (auto* target : Targets) {
+        if (target->GetPriority() == -1 || target->IsRocketLaunched() || target->GetSpeedAbs() == 0) continue;
+
+        double readyTime = 0;
+        const bool isFollowed = IsInVector(FollowedTargetIds, target->GetId());
+        if (isFollowed) {
+            readyTime = target->GetMeasureCountToPreciseSpeed() * measurePeriod;
+        } else {
+            readyTime = RotationTimes.GetTimeToRotate(target->GetPosAngle(), target->GetPosAngle())
+                + Runtime.TimeToPreciseSpeed;
+        }
+        tracks.push_back(target);
+        readyTimes.push_back(readyTime);
+        isReadyNow.push_back(isFollowed && target->CanLaunchRocket());
+    }
+
+    // next launches of every launcher
+    struct Slot {
+        int LauncherIdx;
+        double ReadyTime;
+    };
+    std::pmr::vector<Slot> slots(&TickArena);
+    for (int i = 0; i < Launchers.size(); ++i) {
+        const auto& launcher = Launchers[i];
+        const double readyTime = GetTimeToReady(launcher);
+        for (
+            int k = 0;
+            k < Runtime.PlannedLaunchesPerLauncher
+            && k < tracks.size()
+            && (launcher.RocketsLeft == -1 || k < launcher.RocketsLeft);
+            ++k
+        ) {
+            slots.push_back(Slot{.LauncherIdx = i, .ReadyTime = readyTime + k * reloadTime});
+        }
+    }
+    if (tracks.empty() || slots.empty()) {
+        LastProcessStats.AssignmentMs = 0;
+        return;
+    }
+
+    // weighted sum of priority and intercept time: assigned track gains priority * (rows + 1) + 1 and pays
+    // time term in [0, 1), so assigning feasible track always beats idle slot, priority dominates when priorities
+    // differ by more than 1 / (rows + 1), closer priorities are traded against earlier intercepts
+    const int rowsCount = slots.size();
+    const int colsCount = tracks.size() + rowsCount;
+    const double priorityWeight = rowsCount + 1;
+    const double infeasibleCost = 1e9;
+    std::pmr::vector<double> costs(rowsCount * colsCount, 0, &TickArena);
+    for (int row = 0; row < rowsCount; ++row) {
+        for (int col = 0; col < tracks.size(); ++col) {
+            const auto* target = tracks[col];
+            const double distance = SqrtOfSumSquares(target->GetPosition());
+            const double timeToShip = distance / target->GetSpeedAbs();
+            const double launchTime = std::max(slots[row].ReadyTime, readyTimes[col]) + timeToLaunchRocket;
+            // rocket and target are assumed to close in head-on
+            const double distanceAtLaunch = distance - target->GetSpeedAbs() * launchTime;
+            double& cost = costs[row * colsCount + col];
+            if (distanceAtLaunch <= 0) {
+                cost = infeasibleCost;
+                continue;
+            }
+            const double interceptTime = launchTime + distanceAtLaunch / (rocketSpeed + target->GetSpeedAbs());
+            cost = -(target->GetPriority() * priorityWeight + 1) + interceptTime / timeToShip;
+        }
+    }
+
+    auto assignment = SolveAssignment(costs, rowsCount, colsCount, &TickArena);
+    for (int row = 0; row < rowsCount; ++row) {
+        const int col = assignment[row];
+        // later slots and tracks which aren't ready only reserve launchers, assignment is solved again next tick
+        if (
+            col >= tracks.size()
+            || costs[row * colsCount + col] >= infeasibleCost
+            || slots[row].ReadyTime != 0
+            || !isReadyNow[col]
+        ) {
+            continue;
+        }
+        auto& launcher = Launchers[slots[row].LauncherIdx];
+        LaunchRocket(tracks[col], launcher.Id);
+        if (launcher.RocketsLeft != -1) {
+            --launcher.RocketsLeft;
+        }
+        launcher.IsReloading = true;
+        launcher.ReloadTimer.Restart();
+    }
+
+    LastProcessStats.AssignmentMs = timer.GetElapsedTimeAsPreciseMs();
+    LastProcessStats.MaxAssignmentMs = std::max(LastProcessStats.MaxAssignmentMs, LastProcessStats.AssignmentMs);
+}
+
+void RadarController::LaunchRocket(Target* target, int launcherId) {
+    auto meetPoint = CalculateMeetPoint(
+        target->GetPosition() + target->GetFilteredSpeed() * Runtime.TimeToLaunchRocket,
+        target->GetFilteredSpeed(),
+        Runtime.RocketSpeed
+    );
+    MeetPointsAndTargetIds.emplace_back(meetPoint, target->GetId());
+    LauncherIds.push_back(launcherId);
+    target->SetApproximateMeetPoint(meetPoint);
+    target->SetIsRocketLaunched(true);
+    ++LaunchedRocketsCount;
+}
+
+void RadarController::RejectLaunches(const std::vector<std::pair<int, int>>& targetAndLauncherIds) {
+    for (const auto& [targetId, launcherId] : targetAndLauncherIds) {
+        for (auto* target : Targets) {
+            if (target->GetId() == targetId) {
+                target->SetIsRocketLaunched(false);
+                break;
+            }
+        }
+        // launcher keeps reloading, defense didn't find it ready, so it isn't assigned again at once
+        for (auto& launcher : Launchers) {
+            if (launcher.Id == launcherId && launcher.RocketsLeft != -1) {
+                ++launcher.RocketsLeft;
+            }
+        }
+        ++RejectedLaunchesCount;
+    }
+}
+
+double RadarController::GetTimeToReady(const Launcher& launcher) const {
+    if (!launcher.IsReloading) {
+        return 0;
+    }
+    return std::max(0., Runtime.ReloadTime - launcher.ReloadTimer.GetElapsedTimeAsPreciseMs());
+}
+
+void RadarController::UpdatePositions() {
     double ms = Timer.GetElapsedTimeAsMs();
     Timer.Restart();
+    AdvancePositions(ms);
+}
+
+void RadarController::AdvancePositions(double ms) {
+    if (ShipTargetPos.Angle == -1 && TargetPos.Angle == -1) {
+        return;
+    }
+    const double step = Runtime.KinematicsStep;
+    for (double passed = 0; passed < ms; passed += step) {
+        double dt = std::min(step, ms - passed);
 
-    if (ShipTargetPos.Angle != -1 || TargetPos.Angle != -1) {
         auto PrevShipPosAngle = ShipPos.Angle;
-        ShipPos = UpdateRadarPos(ShipPos, ShipTargetPos, Params.ship().max_eps(), ms);
+        ShipPos = UpdateRadarPos(ShipPos, ShipTargetPos, Runtime.ShipMaxEps, dt);
 
         Pos.Angle += ShipPos.Angle - PrevShipPosAngle;
-        Pos = UpdateRadarPos(Pos, TargetPos, Params.small_radar().max_eps(), ms);
+        Pos = UpdateRadarPos(Pos, TargetPos, Runtime.SmallRadarMaxEps, dt);
     }
+}
+
+RadarController::Result RadarController::GetAngleAndMeetPoints() {
+    UpdatePositions();
 
     RadarController::Result res{
         .RadarAngle = Pos.Angle,
         .ShipAngle = ShipPos.Angle,
         .FollowedTargetIds = FollowedTargetIds,
-        .MeetPointsAndTargetIds = MeetPointsAndTargetIds
+        .MeetPointsAndTargetIds = MeetPointsAndTargetIds,
+        .LauncherIds = LauncherIds
     };
     MeetPointsAndTargetIds.clear();
+    LauncherIds.clear();
     return res;
 }
 
+void RadarController::Snapshot::Clear() {
+    Ids.clear();
+    Positions.clear();
+    Priorities.clear();
+    EntryPoints.clear();
+    ApproximateMeetPoints.clear();
+    IsFollowed.clear();
+    IsRocketLaunched.clear();
+    FollowedTargetIds.clear();
+    MeetPointsAndTargetIds.clear();
+    LauncherIds.clear();
+    ExtraRadars.clear();
+}
+
+void RadarController::GetSnapshot(Snapshot& snapshot) {
+    snapshot.Clear();
+    snapshot.Radar = Pos;
+    snapshot.RadarTarget = TargetPos;
+    snapshot.Ship = ShipPos;
+    snapshot.ShipTarget = ShipTargetPos;
+
+    for (const auto* target : Targets) {
+        snapshot.Ids.push_back(target->GetId());
+        snapshot.Positions.push_back(target->GetPosition());
+        snapshot.Priorities.push_back(target->GetPriority());
+        snapshot.EntryPoints.push_back(target->GetEntryPoint());
+        snapshot.ApproximateMeetPoints.push_back(target->GetApproximateMeetPoint());
+        snapshot.IsFollowed.push_back(IsInVector(FollowedTargetIds, target->GetId()));
+        snapshot.IsRocketLaunched.push_back(target->IsRocketLaunched());
+    }
+    snapshot.FollowedTargetIds.insert(
+        snapshot.FollowedTargetIds.end(), FollowedTargetIds.begin(), FollowedTargetIds.end()
+    );
+    snapshot.MeetPointsAndTargetIds.swap(MeetPointsAndTargetIds);
+    snapshot.LauncherIds.swap(LauncherIds);
+}
+
 std::vector<Vector3d> RadarController::GetEntryPoints() const {
     std::vector<Vector3d> res;
     for (const auto* target : Targets) {
@@ -737,20 +1238,42 @@ std::map<int, double> RadarController::GetPriorities() const {
 }
 
 bool RadarController::IsTargetInRadarSector(const RC::Target* target) const {
-    double startAng = Pos.Angle - Params.small_radar().view_angle() / 2;
-    double endAng = Pos.Angle + Params.small_radar().view_angle() / 2;
-    auto polarPos = CartesianToCylindrical(target->GetPosition());
-    return polarPos.X <= Params.small_radar().radius() && startAng <= polarPos.Y && polarPos.Y <= endAng;
+    double startAng = Pos.Angle - Runtime.SmallRadarHalfViewAngle;
+    double endAng = Pos.Angle + Runtime.SmallRadarHalfViewAngle;
+    auto pos = target->GetPosition();
+    auto angle = target->GetPosAngle();
+    return pos.X * pos.X + pos.Y * pos.Y <= Runtime.SmallRadarRadius * Runtime.SmallRadarRadius
+        && startAng <= angle && angle <= endAng;
 }
 
 bool RadarController::IsTargetInResponsibleSector(const RC::Target* target) const {
-    auto meetPoint = target->GetApproximateMeetPoint();
-    if (meetPoint == Vector3d::Zero())
+    auto meetAngle = target->GetMeetAngle();
+    if (meetAngle == -1)
         return true;
-    auto meetPointPolar = CartesianToCylindrical(meetPoint);
     return
-        Params.small_radar().responsible_sector_start() <= meetPointPolar.Y
-        && meetPointPolar.Y <= Params.small_radar().responsible_sector_end();
+        Runtime.ResponsibleSectorStart <= meetAngle
+        && meetAngle <= Runtime.ResponsibleSectorEnd;
+}
+
+std::string RadarController::GetStatistics() const {
+    return "Deferred geometry updates:     " + std::to_string(LastProcessStats.TotalDeferredTargetsCount) + "\n"
+        + "Saved geometry updates:        " + std::to_string(LastProcessStats.SavedGeometryUpdatesCount) + "\n"
+        + "Rotation time cache hits:      " + std::to_string(RotationTimes.GetHitsCount())
+        + "/" + std::to_string(RotationTimes.GetHitsCount() + RotationTimes.GetMissesCount()) + "\n"
+        + "Tick arena overflows:          " + std::to_string(TickArenaUpstream.GetAllocationsCount()) + "\n"
+        + "Coalesced measurements:        " + std::to_string(LastProcessStats.TotalCoalescedMeasurementsCount) + "\n"
+        + "Ordered launches:              " + std::to_string(LaunchedRocketsCount)
+        + (
+            !Runtime.HasLaunchers
+            ? ""
+            : "\nRejected launches:             " + std::to_string(RejectedLaunchesCount)
+                + "\nMax launchers assignment time: " + std::to_string(LastProcessStats.MaxAssignmentMs) + " ms"
+        )
+        + (
+            Runtime.TargetSelection != Proto::Parameters::General::BEAM_SEARCH
+            ? ""
+            : "\n" + Planner.GetStatistics()
+        );
 }
 
 RadarController::~RadarController() {
@@ -2,11 +2,21 @@
 #define RADAR_CONTROLLER_H
 
 #include "data.h"
+#include "kalman_filter.h"
 #include "proto/generated/params.pb.h"
+#include "radar_planner.h"
+#include "rotation_time_cache.h"
+#include "util/memory.h"
 #include "util/points.h"
+#include "util/runtime_params.h"
 #include "util/timer.h"
 #include "util/util.h"
+#include "util/task_scheduler.h"
 
+#include <cstddef>
+#include <memory_resource>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 
@@ -15,10 +25,11 @@ namespace RC {
     class Target {
     public:
         Target(int id, double presetPriority, double deathTime, const Proto::Parameters& params);
-        Target(const BigRadarData& data, double deathTime, const Proto::Parameters& params);
+        Target(const BigRadarData& data, double deathTime, const Proto::Parameters& params, double ageMs = 0);
 
-        void SmallRadarUpdate(Vector3d pos);
-        void BigRadarUpdate(Vector3d pos, Vector3d speed);
+        // ageMs - time passed since measurement
+        void SmallRadarUpdate(Vector3d pos, double ageMs = 0);
+        void BigRadarUpdate(Vector3d pos, Vector3d speed, double ageMs = 0);
 
         int GetId() const { return Id; }
         double GetPriority() const { return Priority; }
@@ -26,12 +37,19 @@ namespace RC {
         void SetPriority(double p) { Priority = p; }
 
         Vector3d GetUnfilteredPosition() const { return UnfilteredPos; }
+        Vector3d GetLastBigRadarPosition() const { return LastBigRadarPos; }
         Vector3d GetPosition() const { return Pos; }
-        double GetPosAngle() const { return CalculateAngle(Pos); }
-
-        bool HavePreciseSpeed() const { return CurrSmallRadarMeasureCount >= SmallRadarMeasureCount; }
-        Vector3d GetFilteredSpeed() const { return (CurrSmallRadarMeasureCount < ApproxSmallRadarMeasureCount ? SpeedFromBigRadar : FilteredSpeed); }
-        int GetMeasureCountToPreciseSpeed() const { return std::max(0, SmallRadarMeasureCount - CurrSmallRadarMeasureCount); }
+        double GetPosAngle() const { return (IsPosAngleActual ? PosAngle : CalculateAngle(Pos)); }
+        // controller calculates angles of all moved targets in one batch
+        bool NeedToUpdatePosAngle() const { return !IsPosAngleActual; }
+        void SetPosAngle(double angle) { PosAngle = angle; IsPosAngleActual = true; }
+
+        bool HavePreciseSpeed() const { return GetMeasureCountToPreciseSpeed() == 0; }
+        Vector3d GetFilteredSpeed() const { return Speed; }
+        double GetSpeedAbs() const { return SpeedAbs; }
+        int GetMeasureCountToPreciseSpeed() const;
+        // nullptr if track isn't filtered by Kalman filter
+        const KalmanFilter::Covariance* GetCovariance() const;
 
         bool IsDead() const { return (double) Timer.GetElapsedTimeAsMs() >= DeathTime; }
         void SetFollowed(bool f) { IsFollowedFlag = f; }
@@ -39,26 +57,41 @@ namespace RC {
         void SetIsRocketLaunched(bool f) { IsRocketLaunchedFlag = f; }
         bool IsRocketLaunched() const { return IsRocketLaunchedFlag; }
         bool CanBeFollowed() const { return EntryPoint != Vector3d::Zero() && ApproximateMeetPoint != Vector3d::Zero(); }
-        bool CanLaunchRocket() const { return CurrSmallRadarMeasureCount >= SmallRadarMeasureCount; }
-
-        void SetEntryPoint(Vector3d p) { EntryPoint = p; }
+        bool CanLaunchRocket() const { return HavePreciseSpeed(); }
+        bool NeedToUpdateGeometry() const {
+            return NeedToUpdateEntryPointFlag
+                || NeedToUpdateNearPointFlag
+                || (NeedToUpdateMeetPointFlag && !IsRocketLaunchedFlag);
+        }
+        // true if state deviates from one used for last calculation of entry, near and meet points
+        bool IsGeometryChanged(double posTolerance, double speedTolerance, bool isInRadarSector) const;
+        void SetGeometryCalculated(bool isInRadarSector);
+        // ticks in a row, on which geometry update was deferred because of time budget
+        int GetDeferredTicksCount() const { return DeferredTicksCount; }
+        void SetDeferredTicksCount(int count) { DeferredTicksCount = count; }
+
+        void SetEntryPoint(Vector3d p) { EntryPoint = p; EntryAngle = PointAngle(p); TimeToEntryPoint = TimeToPoint(p); }
         Vector3d GetEntryPoint() const { return EntryPoint; }
-        double GetEntryAngle() const { return (EntryPoint == Vector3d::Zero() ? -1 : CalculateAngle(EntryPoint)); }
-        double GetTimeToEntryPoint() const { return Distance(Pos, EntryPoint) / SqrtOfSumSquares(GetFilteredSpeed()); }
+        double GetEntryAngle() const { return EntryAngle; }
+        double GetTimeToEntryPoint() const { return TimeToEntryPoint; }
         bool NeedToUpdateEntryPoint() const { return NeedToUpdateEntryPointFlag; }
         void SetNeedToUpdateEntryPoint(bool f) { NeedToUpdateEntryPointFlag = f; }
 
-        void SetNearPoint(Vector3d p) { NearPoint = p; }
+        void SetNearPoint(Vector3d p) { NearPoint = p; NearAngle = PointAngle(p); TimeToNearPoint = TimeToPoint(p); }
         Vector3d GetNearPoint() const { return NearPoint; }
-        double GetNearAngle() const { return (NearPoint == Vector3d::Zero() ? -1 : CalculateAngle(NearPoint)); }
-        double GetTimeToNearPoint() const { return Distance(Pos, NearPoint) / SqrtOfSumSquares(GetFilteredSpeed()); }
+        double GetNearAngle() const { return NearAngle; }
+        double GetTimeToNearPoint() const { return TimeToNearPoint; }
         bool NeedToUpdateNearPoint() const { return NeedToUpdateNearPointFlag; }
         void SetNeedToUpdateNearPoint(bool f) { NeedToUpdateNearPointFlag = f; }
 
-        void SetApproximateMeetPoint(Vector3d p) { ApproximateMeetPoint = p; }
+        void SetApproximateMeetPoint(Vector3d p) {
+            ApproximateMeetPoint = p;
+            MeetAngle = PointAngle(p);
+            TimeToMeetPoint = TimeToPoint(p);
+        }
         Vector3d GetApproximateMeetPoint() const { return ApproximateMeetPoint; }
-        double GetMeetAngle() const { return (ApproximateMeetPoint == Vector3d::Zero() ? -1 : CalculateAngle(ApproximateMeetPoint)); }
-        double GetTimeToMeetPoint() const { return Distance(Pos, ApproximateMeetPoint) / SqrtOfSumSquares(GetFilteredSpeed()); }
+        double GetMeetAngle() const { return MeetAngle; }
+        double GetTimeToMeetPoint() const { return TimeToMeetPoint; }
         bool NeedToUpdateMeetPoint() const { return NeedToUpdateMeetPointFlag; }
         void SetNeedToUpdateMeetPoint(bool f) { NeedToUpdateMeetPointFlag = f; }
 
@@ -68,6 +101,13 @@ namespace RC {
 
         std::string DebugString() const;
 
+    private:
+        void SetPosition(Vector3d p) { Pos = p; IsPosAngleActual = false; }
+        // refreshes speed and times to points after position, speeds or measure counts change
+        void UpdateKinematics();
+        double TimeToPoint(Vector3d p) const { return Distance(Pos, p) / SpeedAbs; }
+        static double PointAngle(Vector3d p) { return (p == Vector3d::Zero() ? -1 : CalculateAngle(p)); }
+
     private:
         int Id;
         double Priority = -1;
@@ -75,17 +115,45 @@ namespace RC {
         double SmallRadarRadius;
 
         Vector3d UnfilteredPos;
+        Vector3d LastBigRadarPos; // big radar resends it until it measures target again
         Vector3d Pos;
         Vector3d SpeedFromBigRadar;
         Vector3d FilteredSpeed;
+        Vector3d Speed; // speed from big radar until filtered speed is known
+        double SpeedAbs = 0;
 
         Vector3d EntryPoint;
         Vector3d NearPoint;
         Vector3d ApproximateMeetPoint;
 
+        // angles are cached, as they are read many times per tick, -1 if point isn't calculated
+        double PosAngle = 0;
+        bool IsPosAngleActual = false;
+        double EntryAngle = -1;
+        double NearAngle = -1;
+        double MeetAngle = -1;
+
+        int DeferredTicksCount = 0;
+
+        double TimeToEntryPoint = 0;
+        double TimeToNearPoint = 0;
+        double TimeToMeetPoint = 0;
+
         SimpleTimer Timer;
         double DeathTime;
 
+        const bool IsKalmanFilter;
+        KalmanFilter Kalman;
+        double KalmanInitialSpeedStddev;
+        double KalmanPreciseSpeedStddev;
+        int KalmanMeasureCountToPreciseSpeed = 0;
+
+        // state for which entry, near and meet points were calculated
+        Vector3d GeometryPos;
+        Vector3d GeometrySpeed;
+        bool GeometryInRadarSector = false;
+        SimpleTimer GeometryTimer;
+
         bool IsFollowedFlag = false;
         bool IsRocketLaunchedFlag = false;
         bool NeedToUpdateEntryPointFlag = false;
@@ -109,28 +177,133 @@ public:
         double ShipAngle;
         std::vector<int> FollowedTargetIds;
         std::vector<std::pair<Vector3d, int>> MeetPointsAndTargetIds;
+        std::vector<int> LauncherIds; // launcher of i-th rocket, -1 if launchers aren't modeled
     };
 
-    RadarController(const Proto::Parameters& params, double startAngle, double shipStartAngle);
+    // all controller outputs in one structure of arrays, buffers are reused between calls
+    struct Snapshot {
+        RadarPos Radar;
+        RadarTargetPos RadarTarget;
+        RadarPos Ship;
+        RadarTargetPos ShipTarget;
+
+        // per track, i-th elements of all arrays belong to the same track
+        std::vector<int> Ids;
+        std::vector<Vector3d> Positions;
+        std::vector<double> Priorities;
+        std::vector<Vector3d> EntryPoints; // zero if not calculated
+        std::vector<Vector3d> ApproximateMeetPoints; // zero if not calculated
+        std::vector<char> IsFollowed;
+        std::vector<char> IsRocketLaunched;
+
+        std::vector<int> FollowedTargetIds;
+        std::vector<std::pair<Vector3d, int>> MeetPointsAndTargetIds; // rockets to launch since previous call
+        std::vector<int> LauncherIds; // launcher of i-th rocket, -1 if launchers aren't modeled
+
+        std::vector<RadarPos> ExtraRadars; // radars of other controllers, filled by RadarCoordinator
+
+        size_t Size() const { return Ids.size(); }
+        void Clear();
+    };
+
+    // radars measurements of one tick
+    struct Frame {
+        std::vector<BigRadarData> BigDatas;
+        std::vector<SmallRadarData> SmallDatas;
+        double AgeMs = 0; // time passed since measurements
+    };
+
+    struct ProcessStats {
+        int UpdatedTargetsCount = 0; // targets which geometry was refreshed during last Process
+        int DeferredTargetsCount = 0; // targets which geometry refresh was shed during last Process
+        // cumulative over all Process calls
+        int TotalDeferredTargetsCount = 0;
+        long long SavedGeometryUpdatesCount = 0; // recalculations skipped as target moved within tolerances
+        long long TotalCoalescedMeasurementsCount = 0; // measurements of frame batches superseded by later ones
+        double AssignmentMs = 0; // time of launchers assignment during last Process
+        double MaxAssignmentMs = 0;
+        double ElapsedMs = 0;
+    };
+
+    // if ship isn't controlled, ship motion is set by FollowShip and only radar is planned,
+    // launchers of controller have ids starting from firstLauncherId, without scheduler everything is serial
+    RadarController(
+        const Proto::Parameters& params,
+        double startAngle,
+        double shipStartAngle,
+        bool isShipControlled = true,
+        int firstLauncherId = 0,
+        TaskScheduler* scheduler = nullptr
+    );
 
     void Process(const std::vector<BigRadarData>&, const std::vector<SmallRadarData>&);
+    // frames queued while controller was busy, from oldest to newest, every track is updated by its measurements
+    // in order of frames, but geometry and targets selection are calculated once for the newest state
+    void ProcessFrames(const std::vector<Frame>& frames);
+    void FollowShip(RadarPos shipPos, RadarTargetPos shipTargetPos);
+    // launches, which defense didn't perform, given as target and launcher ids,
+    // rocket is returned to launcher and target may be assigned again
+    void RejectLaunches(const std::vector<std::pair<int, int>>& targetAndLauncherIds);
 
     Result GetAngleAndMeetPoints();
+    void GetSnapshot(Snapshot& snapshot);
+
+    // rotates radar and ship by fixed kinematics steps
+    void AdvancePositions(double ms);
     std::vector<Vector3d> GetEntryPoints() const;
     std::vector<Vector3d> GetApproximateMeetPoints() const;
     std::map<int, double> GetPriorities() const;
 
     bool IsThereAnyTargets() const { return !Targets.empty(); };
+    // ids of targets, which were lost during last Process
+    const std::vector<int>& GetRemovedTargetIds() const { return RemovedTargetIds; }
+    RadarPos GetShipPos() const { return ShipPos; }
+    RadarTargetPos GetShipTargetPos() const { return ShipTargetPos; }
+    const ProcessStats& GetLastProcessStats() const { return LastProcessStats; }
+    std::string GetStatistics() const;
 
     ~RadarController();
 
 private:
+    struct Launcher {
+        int Id;
+        int RocketsLeft; // -1 - unlimited
+        bool IsReloading = false;
+        SimpleTimer ReloadTimer;
+    };
+
+private:
+    using TargetsById = std::pmr::unordered_map<int, RC::Target*>;
+
+    // small radar measurements of tracks from supersededIds are skipped
+    void UpdateFromRadars(
+        const std::vector<BigRadarData>& bigDatas,
+        const std::vector<SmallRadarData>& smallDatas,
+        double ageMs,
+        const std::pmr::unordered_set<int>& supersededIds,
+        TargetsById& targetsById
+    );
+    // everything after radars update: geometry, targets selection and launches
+    void ProcessTargets(const SimpleTimer& timer);
+    void UpdatePositions();
+    void UpdatePosAngles();
+    // serial for few targets, otherwise targets are spread over Scheduler
+    void UpdateTargetsGeometry(RC::Target* const* targets, int count);
+    // returns count of points which recalculation was saved by tolerances,
+    // rotation time cache isn't filled if isConcurrent
+    int UpdateTargetGeometry(RC::Target* target, bool isConcurrent);
     void RemoveDeadTargets();
+    void LaunchRockets();
+    void AssignLaunchers();
+    void LaunchRocket(RC::Target* target, int launcherId);
+    double GetTimeToReady(const Launcher& launcher) const;
     bool IsTargetInRadarSector(const RC::Target* target) const;
     bool IsTargetInResponsibleSector(const RC::Target* target) const;
 
 private:
     const Proto::Parameters& Params;
+    const RuntimeParams Runtime;
+    const bool IsShipControlled;
 
     RadarPos Pos;
     RadarTargetPos TargetPos;
@@ -139,11 +312,34 @@ private:
     RadarTargetPos ShipTargetPos;
 
     std::vector<RC::Target*> Targets;
+    std::vector<int> RemovedTargetIds;
 
     std::vector<int> FollowedTargetIds;
     std::vector<std::pair<Vector3d, int>> MeetPointsAndTargetIds;
+    std::vector<int> LauncherIds;
+
+    std::vector<Launcher> Launchers; // empty if launchers aren't modeled
+    long long LaunchedRocketsCount = 0;
+    long long RejectedLaunchesCount = 0;
 
     SimpleTimer Timer;
+    ProcessStats LastProcessStats;
+    RotationTimeCache RotationTimes;
+    RadarPlanner Planner;
+    TaskScheduler* Scheduler;
+    std::vector<int> GeometrySavedCounts; // per target of parallel geometry update
+
+    // scratch buffers of batch angles calculation
+    std::vector<RC::Target*> MovedTargets;
+    std::vector<double> MovedTargetsX;
+    std::vector<double> MovedTargetsY;
+    std::vector<double> MovedTargetsAngles;
+
+    // temporary containers of Process live in arena, which is released at start of every Process,
+    // upstream counts allocations that didn't fit into preallocated buffer
+    CountingMemoryResource TickArenaUpstream;
+    std::vector<std::byte> TickArenaBuffer;
+    std::pmr::monotonic_buffer_resource TickArena;
 };
 
 
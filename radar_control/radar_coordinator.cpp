@@ -0,0 +1,227 @@
+#include "radar_coordinator.h"
+#include "util/proto.h"
+#include "util/util.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+
+RadarCoordinator::RadarCoordinator(
+    const Proto::Parameters& params,
+    double startAngle,
+    double shipStartAngle,
+    TaskScheduler* scheduler
+)
+    : Params(params)
+    , Scheduler(scheduler)
+{
+    const int radarsCount = GetSmallRadarsCount(Params);
+    for (int i = 0; i < radarsCount; ++i) {
+        auto& controllerParams = ControllersParams.emplace_back(Params);
+        *controllerParams.mutable_small_radar() = GetSmallRadar(Params, i);
+        controllerParams.clear_extra_small_radars();
+
+        // launchers are split between controllers, so no launcher is used by two of them
+        const int launchersCount = Params.defense().launchers_count();
+        const int firstLauncherId = launchersCount * i / radarsCount;
+        if (Params.defense().has_launchers_count()) {
+            controllerParams.mutable_defense()->set_launchers_count(
+                launchersCount * (i + 1) / radarsCount - firstLauncherId
+            );
+        }
+
+        // extra radars start looking at the middle of their responsible sectors
+        const auto& radar = controllerParams.small_radar();
+        const double radarStartAngle =
+            (i == 0 ? startAngle : (radar.responsible_sector_start() + radar.responsible_sector_end()) / 2);
+        Controllers.push_back(
+            new RadarController(controllerParams, radarStartAngle, shipStartAngle, i == 0, firstLauncherId, scheduler)
+        );
+    }
+    BigDatas.resize(radarsCount);
+    SmallDatas.resize(radarsCount);
+    Errors.resize(radarsCount);
+}
+
+void RadarCoordinator::Process(
+    const std::vector<BigRadarData>& bigDatas,
+    const std::vector<std::vector<SmallRadarData>>& smallDatas
+) {
+    PartitionData(bigDatas, smallDatas);
+
+    // controller 0 is processed by calling thread
+    if (Scheduler) {
+        TaskScheduler::TaskGroup group(*Scheduler);
+        for (int i = 1; i < Controllers.size(); ++i) {
+            group.Run([this, i] { ProcessController(i); });
+        }
+        ProcessController(0);
+        group.Wait();
+    } else {
+        for (int i = 0; i < Controllers.size(); ++i) {
+            ProcessController(i);
+        }
+    }
+    for (auto& error : Errors) {
+        if (error) {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+    RemoveLostTracks();
+
+    // extra controllers planned for previous ship target, from now on they move with ship as it is planned now
+    const auto* mainController = Controllers[0];
+    for (int i = 1; i < Controllers.size(); ++i) {
+        Controllers[i]->FollowShip(mainController->GetShipPos(), mainController->GetShipTargetPos());
+    }
+}
+
+void RadarCoordinator::AdvancePositions(double ms) {
+    for (auto* controller : Controllers) {
+        controller->AdvancePositions(ms);
+    }
+}
+
+void RadarCoordinator::RejectLaunches(const std::vector<std::pair<int, int>>& targetAndLauncherIds) {
+    if (targetAndLauncherIds.empty()) {
+        return;
+    }
+    std::vector<std::vector<std::pair<int, int>>> controllersRejects(Controllers.size());
+    for (const auto& reject : targetAndLauncherIds) {
+        auto it = TrackOwners.find(reject.first);
+        if (it != TrackOwners.end()) {
+            controllersRejects[it->second].push_back(reject);
+        }
+    }
+    for (int i = 0; i < Controllers.size(); ++i) {
+        Controllers[i]->RejectLaunches(controllersRejects[i]);
+    }
+}
+
+void RadarCoordinator::GetSnapshot(RadarController::Snapshot& snapshot) {
+    auto append = [](auto& to, const auto& from) {
+        to.insert(to.end(), from.begin(), from.end());
+    };
+
+    Controllers[0]->GetSnapshot(snapshot);
+    for (int i = 1; i < Controllers.size(); ++i) {
+        Controllers[i]->GetSnapshot(ControllerSnapshot);
+        // tracks aren't duplicated between controllers, so arrays are just concatenated
+        append(snapshot.Ids, ControllerSnapshot.Ids);
+        append(snapshot.Positions, ControllerSnapshot.Positions);
+        append(snapshot.Priorities, ControllerSnapshot.Priorities);
+        append(snapshot.EntryPoints, ControllerSnapshot.EntryPoints);
+        append(snapshot.ApproximateMeetPoints, ControllerSnapshot.ApproximateMeetPoints);
+        append(snapshot.IsFollowed, ControllerSnapshot.IsFollowed);
+        append(snapshot.IsRocketLaunched, ControllerSnapshot.IsRocketLaunched);
+        append(snapshot.FollowedTargetIds, ControllerSnapshot.FollowedTargetIds);
+        append(snapshot.MeetPointsAndTargetIds, ControllerSnapshot.MeetPointsAndTargetIds);
+        append(snapshot.LauncherIds, ControllerSnapshot.LauncherIds);
+        snapshot.ExtraRadars.push_back(ControllerSnapshot.Radar);
+    }
+}
+
+bool RadarCoordinator::IsThereAnyTargets() const {
+    return std::any_of(
+        Controllers.begin(),
+        Controllers.end(),
+        [](const RadarController* controller) { return controller->IsThereAnyTargets(); }
+    );
+}
+
+std::string RadarCoordinator::GetStatistics() const {
+    if (Controllers.size() == 1) {
+        return Controllers[0]->GetStatistics();
+    }
+    std::string res;
+    for (int i = 0; i < Controllers.size(); ++i) {
+        res += (i == 0 ? "" : "\n") + std::string("Radar ") + std::to_string(i) + ":\n" + Controllers[i]->GetStatistics();
+    }
+    return res;
+}
+
+int RadarCoordinator::ChooseOwner(const BigRadarData& data) const {
+    // controller which responsible sector contains target or is the closest one
+    const double angle = CalculateAngle(data.Pos);
+    int owner = 0;
+    double minDistance = std::numeric_limits<double>::max();
+    for (int i = 0; i < Controllers.size(); ++i) {
+        const auto& radar = GetSmallRadar(Params, i);
+        const double distance = std::max({
+            0.,
+            radar.responsible_sector_start() - angle,
+            angle - radar.responsible_sector_end()
+        });
+        if (distance < minDistance) {
+            owner = i;
+            minDistance = distance;
+        }
+    }
+    return owner;
+}
+
+void RadarCoordinator::PartitionData(
+    const std::vector<BigRadarData>& bigDatas,
+    const std::vector<std::vector<SmallRadarData>>& smallDatas
+) {
+    for (int i = 0; i < Controllers.size(); ++i) {
+        BigDatas[i].clear();
+        SmallDatas[i].clear();
+    }
+
+    for (const auto& data : bigDatas) {
+        auto it = TrackOwners.find(data.Id);
+        if (it == TrackOwners.end()) {
+            it = TrackOwners.emplace(data.Id, ChooseOwner(data)).first;
+        }
+        BigDatas[it->second].push_back(data);
+    }
+
+    // track gets one measurement per tick, measurement of owner's radar is preferred
+    MeasuredTracks.clear();
+    for (int radar = 0; radar < smallDatas.size(); ++radar) {
+        for (const auto& data : smallDatas[radar]) {
+            auto it = TrackOwners.find(data.Id);
+            if (it != TrackOwners.end() && it->second == radar) {
+                SmallDatas[radar].push_back(data);
+                MeasuredTracks.insert(data.Id);
+            }
+        }
+    }
+    for (const auto& radarDatas : smallDatas) {
+        for (const auto& data : radarDatas) {
+            auto it = TrackOwners.find(data.Id);
+            if (it != TrackOwners.end() && MeasuredTracks.insert(data.Id).second) {
+                SmallDatas[it->second].push_back(data);
+            }
+        }
+    }
+}
+
+void RadarCoordinator::RemoveLostTracks() {
+    // controllers report tracks they dropped, so cost doesn't depend on number of owned tracks
+    for (int i = 0; i < Controllers.size(); ++i) {
+        for (auto id : Controllers[i]->GetRemovedTargetIds()) {
+            auto it = TrackOwners.find(id);
+            if (it != TrackOwners.end() && it->second == i) {
+                TrackOwners.erase(it);
+            }
+        }
+    }
+}
+
+void RadarCoordinator::ProcessController(int idx) {
+    try {
+        Controllers[idx]->Process(BigDatas[idx], SmallDatas[idx]);
+    } catch (...) {
+        Errors[idx] = std::current_exception();
+    }
+}
+
+RadarCoordinator::~RadarCoordinator() {
+    for (auto* controller : Controllers) {
+        delete controller;
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef RADAR_COORDINATOR_H
+#define RADAR_COORDINATOR_H
+
+#include "data.h"
+#include "proto/generated/params.pb.h"
+#include "radar_controller.h"
+#include "util/task_scheduler.h"
+
+#include <deque>
+#include <exception>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+// Runs one controller per small radar. Controller of main small radar turns ship, others follow it.
+// Every track is owned by exactly one controller, owner is chosen by responsible sectors when track appears.
+// Controllers are processed in parallel as tasks of scheduler, serially if there is no scheduler.
+class RadarCoordinator {
+public:
+    RadarCoordinator(
+        const Proto::Parameters& params,
+        double startAngle,
+        double shipStartAngle,
+        TaskScheduler* scheduler = nullptr
+    );
+
+    // smallDatas[i] - measurements of i-th small radar
+    void Process(
+        const std::vector<BigRadarData>& bigDatas,
+        const std::vector<std::vector<SmallRadarData>>& smallDatas
+    );
+
+    void AdvancePositions(double ms);
+    // passes launches, which defense didn't perform, to controllers owning their tracks
+    void RejectLaunches(const std::vector<std::pair<int, int>>& targetAndLauncherIds);
+    // tracks of all controllers, radar of main controller is Radar, others are ExtraRadars
+    void GetSnapshot(RadarController::Snapshot& snapshot);
+
+    int GetRadarsCount() const { return Controllers.size(); }
+    bool IsThereAnyTargets() const;
+    std::string GetStatistics() const;
+
+    ~RadarCoordinator();
+
+private:
+    int ChooseOwner(const BigRadarData& data) const;
+    void PartitionData(
+        const std::vector<BigRadarData>& bigDatas,
+        const std::vector<std::vector<SmallRadarData>>& smallDatas
+    );
+    void RemoveLostTracks();
+    void ProcessController(int idx);
+
+private:
+    const Proto::Parameters& Params;
+
+    std::deque<Proto::Parameters> ControllersParams; // controllers keep references, so deque
+    std::vector<RadarController*> Controllers;
+
+    std::unordered_map<int, int> TrackOwners; // track id -> controller index
+    // per controller input of current tick, buffers are reused
+    std::vector<std::vector<BigRadarData>> BigDatas;
+    std::vector<std::vector<SmallRadarData>> SmallDatas;
+    std::unordered_set<int> MeasuredTracks;
+    RadarController::Snapshot ControllerSnapshot;
+
+    TaskScheduler* Scheduler;
+    std::vector<std::exception_ptr> Errors; // per controller
+};
+
+
+#endif // RADAR_COORDINATOR_H
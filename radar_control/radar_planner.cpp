@@ -0,0 +1,384 @@
+#include "radar_planner.h"
+#include "util/timer.h"
+#include "util/util.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace {
+
+    const double INF = std::numeric_limits<double>::infinity();
+    // per ms of plan, among plans serving the same tracks the fastest one is chosen
+    const double END_TIME_PENALTY = 1e-6;
+
+}
+
+
+RadarPlanner::RadarPlanner(const Proto::Parameters& params, TaskScheduler* scheduler)
+    : Params(params)
+    , Horizon(params.general().planner_horizon())
+    , BeamWidth(params.general().planner_beam_width())
+    , MaxDepth(params.general().planner_max_depth())
+    , HalfWindow(params.small_radar().view_angle() / 2 - params.general().margin_angle())
+    , ShipMaxSpeed(params.ship().max_angle_speed())
+    , ShipMaxEps(params.ship().max_eps())
+    , RadarMaxSpeed(params.small_radar().max_angle_speed())
+    , RadarMaxEps(params.small_radar().max_eps())
+    , DeadZones(AngleSegments::FromProto(params.ship().dead_zones()))
+    , InvertedDeadZones(DeadZones)
+    , Scheduler(scheduler)
+{
+    InvertedDeadZones.Invert(M_PI, params.general().margin_angle());
+}
+
+std::pmr::vector<int> RadarPlanner::Plan(
+    const std::pmr::vector<Track>& tracks,
+    RadarPos radarPos,
+    RotationTimeCache& rotationTimes,
+    RadarPos shipPos,
+    double shipTargetAngle,
+    bool isShipControlled,
+    std::pmr::memory_resource* arena
+) {
+    SimpleTimer timer;
+    Tracks = &tracks;
+    ShipPos = shipPos;
+    ShipTargetAngle = shipTargetAngle;
+    IsShipControlled = isShipControlled;
+    PinnedBonus = 1;
+    for (const auto& track : tracks) {
+        PinnedBonus += track.Weight;
+    }
+    BuildWindows(rotationTimes);
+
+    States.clear();
+    States.push_back(State{
+        .Parent = -1,
+        .WindowIdx = -1,
+        .IsFullDwell = false,
+        .StartTime = 0,
+        .EndTime = 0,
+        .RadarAngle = radarPos.Angle,
+        .ShipAngle = (isShipControlled || shipTargetAngle == -1 ? shipPos.Angle : shipTargetAngle),
+        .Score = 0
+    });
+
+    SeedStates.resize(MaxDepth + 1);
+    for (auto& seedStates : SeedStates) {
+        seedStates.clear();
+    }
+    // previous plan as it is and without its first dwell, which may be finished by now
+    AddSeed(0);
+    AddSeed(1);
+
+    Beam.assign(1, 0);
+    int best = 0;
+    for (int depth = 1; depth <= MaxDepth && !Beam.empty(); ++depth) {
+        const int beamSize = Beam.size();
+        if (Children.size() < beamSize) {
+            Children.resize(beamSize);
+            Served.resize(beamSize);
+        }
+        auto expand = [this](int i) {
+            Expand(Beam[i], Children[i], Served[i]);
+        };
+        if (Scheduler) {
+            Scheduler->ParallelFor(beamSize, expand, 1);
+        } else {
+            for (int i = 0; i < beamSize; ++i) {
+                expand(i);
+            }
+        }
+
+        // seeds go first, so on equal scores previous plan is kept
+        Candidates.assign(SeedStates[depth].begin(), SeedStates[depth].end());
+        for (int i = 0; i < beamSize; ++i) {
+            for (const auto& child : Children[i]) {
+                Candidates.push_back(States.size());
+                States.push_back(child);
+            }
+        }
+        std::stable_sort(
+            Candidates.begin(),
+            Candidates.end(),
+            [this](int l, int r) { return States[l].Score > States[r].Score; }
+        );
+        if (Candidates.size() > BeamWidth) {
+            Candidates.resize(BeamWidth);
+        }
+        Beam.swap(Candidates);
+        if (!Beam.empty() && States[Beam[0]].Score > States[best].Score) {
+            best = Beam[0];
+        }
+    }
+
+    std::pmr::vector<int> res(arena);
+    BestPlan.clear();
+    int first = -1;
+    for (int i = best; States[i].Parent != -1; i = States[i].Parent) {
+        BestPlan.push_back(Step{
+            .StartTrackId = Windows[States[i].WindowIdx].StartTrackId,
+            .IsFullDwell = States[i].IsFullDwell
+        });
+        first = i;
+    }
+    std::reverse(BestPlan.begin(), BestPlan.end());
+
+    if (first != -1) {
+        if (IsInVector(SeedStates[1], first)) {
+            ++ReusedPlansCount;
+        }
+        const auto& window = Windows[States[first].WindowIdx];
+        res.assign(
+            WindowMembers.begin() + window.FirstMember,
+            WindowMembers.begin() + window.FirstMember + window.MembersCount
+        );
+    }
+    PrevPlan.swap(BestPlan);
+
+    ++PlansCount;
+    MaxPlanMs = std::max(MaxPlanMs, timer.GetElapsedTimeAsPreciseMs());
+    return res;
+}
+
+void RadarPlanner::BuildWindows(RotationTimeCache& rotationTimes) {
+    const auto& tracks = *Tracks;
+    const double width = 2 * HalfWindow;
+
+    TracksOrder.resize(tracks.size());
+    for (int i = 0; i < tracks.size(); ++i) {
+        TracksOrder[i] = i;
+    }
+    std::sort(
+        TracksOrder.begin(),
+        TracksOrder.end(),
+        [&tracks](int l, int r) {
+            return std::make_pair(tracks[l].MinAngle, tracks[l].Id) < std::make_pair(tracks[r].MinAngle, tracks[r].Id);
+        }
+    );
+
+    auto shipDeadZones = DeadZones;
+    shipDeadZones.Shift(ShipTargetAngle == -1 ? ShipPos.Angle : ShipTargetAngle);
+
+    Windows.clear();
+    WindowMembers.clear();
+    for (int i = 0; i < TracksOrder.size(); ++i) {
+        const auto& startTrack = tracks[TracksOrder[i]];
+        if (
+            startTrack.MaxAngle - startTrack.MinAngle > width
+            // window would be the same as previous one
+            || (i > 0 && tracks[TracksOrder[i - 1]].MinAngle == startTrack.MinAngle)
+        ) {
+            continue;
+        }
+
+        const int windowIdx = Windows.size();
+        if (WindowAngles.size() <= windowIdx) {
+            WindowAngles.resize(windowIdx + 1);
+        }
+        auto& angles = WindowAngles[windowIdx];
+        angles.clear();
+
+        Window window{
+            .StartTrackId = startTrack.Id,
+            .MinAngle = startTrack.MinAngle,
+            .MaxAngle = startTrack.MaxAngle,
+            .FirstMember = (int) WindowMembers.size(),
+            .MembersCount = 0,
+            .FirstSlew = 0,
+            .IsShipFeasible = true
+        };
+        const double end = startTrack.MinAngle + width;
+        for (int j = i; j < TracksOrder.size() && tracks[TracksOrder[j]].MinAngle <= end; ++j) {
+            const auto& track = tracks[TracksOrder[j]];
+            if (track.MaxAngle > end) {
+                continue;
+            }
+            WindowMembers.push_back(TracksOrder[j]);
+            ++window.MembersCount;
+            window.MaxAngle = std::max(window.MaxAngle, track.MaxAngle);
+            angles.push_back(track.MinAngle);
+            angles.push_back(track.MaxAngle);
+            if (shipDeadZones.Contains(track.MinAngle) || shipDeadZones.Contains(track.MaxAngle)) {
+                window.IsShipFeasible = false;
+            }
+        }
+        // radar doesn't move during Process, so first slews are taken from shared cache
+        window.FirstSlew = rotationTimes.GetTimeToRotate(window.MinAngle, window.MaxAngle);
+        Windows.push_back(window);
+    }
+}
+
+void RadarPlanner::Expand(int stateIdx, std::vector<State>& children, std::vector<char>& served) const {
+    children.clear();
+    if (States[stateIdx].EndTime >= Horizon) {
+        return;
+    }
+    served.assign(Tracks->size(), false);
+    MarkServed(stateIdx, served);
+    for (int w = 0; w < Windows.size(); ++w) {
+        EvaluateWindow(stateIdx, w, served, children);
+    }
+}
+
+void RadarPlanner::EvaluateWindow(
+    int parentIdx,
+    int windowIdx,
+    const std::vector<char>& served,
+    std::vector<State>& children
+) const {
+    const auto& tracks = *Tracks;
+    const auto& parent = States[parentIdx];
+    const auto& window = Windows[windowIdx];
+    const bool isFirstDwell = (parent.Parent == -1);
+
+    // radar center at which all tracks of window are in view
+    const double radarAngle = Clip(parent.RadarAngle, window.MaxAngle - HalfWindow, window.MinAngle + HalfWindow);
+    const double radarSlew = (
+        isFirstDwell
+        ? window.FirstSlew
+        : TimeToRotate(
+            RadarPos{.Angle = parent.RadarAngle, .Speed = 0},
+            RadarTargetPos{.Angle = radarAngle, .Speed = RadarMaxSpeed},
+            RadarMaxEps
+        )
+    );
+
+    double shipAngle = parent.ShipAngle;
+    double shipSlew = 0;
+    if (IsShipControlled) {
+        const double shipTargetAngle = (isFirstDwell && ShipTargetAngle != -1 ? ShipTargetAngle : parent.ShipAngle);
+        shipAngle = CalculateShipAngleMultiTarget(
+            parent.ShipAngle,
+            shipTargetAngle,
+            WindowAngles[windowIdx],
+            InvertedDeadZones
+        );
+        if (shipAngle == -1) {
+            return;
+        }
+        shipSlew = TimeToRotate(
+            (isFirstDwell ? ShipPos : RadarPos{.Angle = parent.ShipAngle, .Speed = 0}),
+            RadarTargetPos{.Angle = shipAngle, .Speed = ShipMaxSpeed},
+            ShipMaxEps
+        );
+    } else if (!window.IsShipFeasible) {
+        return;
+    }
+
+    const double startTime = parent.EndTime + std::max(radarSlew, shipSlew);
+    double pinnedGain = 0;
+    double minDone = INF;
+    double maxDone = -INF;
+    for (int i = window.FirstMember; i < window.FirstMember + window.MembersCount; ++i) {
+        const auto& track = tracks[WindowMembers[i]];
+        if (track.IsPinned) {
+            pinnedGain += (isFirstDwell ? PinnedBonus : 0);
+            continue;
+        }
+        if (track.Weight == 0 || served[WindowMembers[i]]) {
+            continue;
+        }
+        const double done = std::max(startTime, track.ReadyTime) + track.MeasureTime;
+        if (done <= track.Deadline && done <= Horizon) {
+            minDone = std::min(minDone, done);
+            maxDone = std::max(maxDone, done);
+        }
+    }
+
+    auto addChild = [&](double endTime, bool isFullDwell) {
+        double gain = pinnedGain;
+        for (int i = window.FirstMember; i < window.FirstMember + window.MembersCount; ++i) {
+            const auto& track = tracks[WindowMembers[i]];
+            if (track.IsPinned || track.Weight == 0 || served[WindowMembers[i]]) {
+                continue;
+            }
+            const double done = std::max(startTime, track.ReadyTime) + track.MeasureTime;
+            if (done <= track.Deadline && done <= endTime) {
+                gain += track.Weight;
+            }
+        }
+        children.push_back(State{
+            .Parent = parentIdx,
+            .WindowIdx = windowIdx,
+            .IsFullDwell = isFullDwell,
+            .StartTime = startTime,
+            .EndTime = endTime,
+            .RadarAngle = radarAngle,
+            .ShipAngle = shipAngle,
+            .Score = parent.Score + gain - END_TIME_PENALTY * (endTime - parent.EndTime)
+        });
+    };
+
+    if (minDone == INF) {
+        // nothing to measure, but rockets guided to window tracks need it
+        if (pinnedGain > 0) {
+            addChild(startTime, false);
+        }
+        return;
+    }
+    addChild(minDone, false);
+    if (maxDone > minDone) {
+        addChild(maxDone, true);
+    }
+}
+
+void RadarPlanner::MarkServed(int stateIdx, std::vector<char>& served) const {
+    const auto& tracks = *Tracks;
+    for (int s = stateIdx; States[s].Parent != -1; s = States[s].Parent) {
+        const auto& state = States[s];
+        const auto& window = Windows[state.WindowIdx];
+        for (int i = window.FirstMember; i < window.FirstMember + window.MembersCount; ++i) {
+            const auto& track = tracks[WindowMembers[i]];
+            const double done = std::max(state.StartTime, track.ReadyTime) + track.MeasureTime;
+            if (done <= track.Deadline && done <= state.EndTime) {
+                served[WindowMembers[i]] = true;
+            }
+        }
+    }
+}
+
+void RadarPlanner::AddSeed(int firstStep) {
+    int parentIdx = 0;
+    for (int step = firstStep, depth = 1; step < PrevPlan.size() && depth <= MaxDepth; ++step, ++depth) {
+        const int windowIdx = FindWindow(PrevPlan[step].StartTrackId);
+        if (windowIdx == -1) {
+            return;
+        }
+        SeedServed.assign(Tracks->size(), false);
+        MarkServed(parentIdx, SeedServed);
+        SeedChildren.clear();
+        EvaluateWindow(parentIdx, windowIdx, SeedServed, SeedChildren);
+
+        // dwell may have become shorter than planned, if its last track was served meanwhile
+        const State* child = nullptr;
+        for (const auto& state : SeedChildren) {
+            if (!child || state.IsFullDwell == PrevPlan[step].IsFullDwell) {
+                child = &state;
+            }
+        }
+        if (!child) {
+            return;
+        }
+        parentIdx = States.size();
+        States.push_back(*child);
+        SeedStates[depth].push_back(parentIdx);
+    }
+}
+
+int RadarPlanner::FindWindow(int startTrackId) const {
+    for (int i = 0; i < Windows.size(); ++i) {
+        if (Windows[i].StartTrackId == startTrackId) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+std::string RadarPlanner::GetStatistics() const {
+    return "Planned ticks:                 " + std::to_string(PlansCount) + "\n"
+        + "Reused plans:                  " + std::to_string(ReusedPlansCount) + "\n"
+        + "Max planning time:             " + std::to_string(MaxPlanMs) + " ms";
+}
@@ -0,0 +1,134 @@
+#ifndef RADAR_PLANNER_H
+#define RADAR_PLANNER_H
+
+#include "calculations.h"
+#include "data.h"
+#include "proto/generated/params.pb.h"
+#include "rotation_time_cache.h"
+#include "util/interval_set.h"
+#include "util/task_scheduler.h"
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+
+// Receding horizon planner of radar and ship slews.
+// Plan is a sequence of dwells, radar looks at one view window during dwell. Track is served by dwell
+// if it gets into view and stays there until its speed is precise, before rocket must be launched at it.
+// Beam search looks for sequence with max total weight of served tracks, only first dwell is executed,
+// remainder of best plan seeds search of the next tick.
+class RadarPlanner {
+public:
+    struct Track {
+        int Id;
+        double MinAngle;
+        double MaxAngle;
+        double Weight; // 0 - track doesn't need to be served
+        double ReadyTime; // ms until track may be measured by small radar
+        double MeasureTime; // ms of continuous measurements until speed is precise
+        double Deadline; // ms until speed must be precise
+        bool IsPinned; // rocket is guided to track, so track must stay in view
+    };
+
+    // beam is expanded in parallel if scheduler is given
+    RadarPlanner(const Proto::Parameters& params, TaskScheduler* scheduler);
+
+    // returns indices of tracks in view window of first dwell, empty if no track can be served
+    std::pmr::vector<int> Plan(
+        const std::pmr::vector<Track>& tracks,
+        RadarPos radarPos,
+        RotationTimeCache& rotationTimes, // filled for radarPos
+        RadarPos shipPos,
+        double shipTargetAngle, // -1 if ship has no target
+        bool isShipControlled,
+        std::pmr::memory_resource* arena
+    );
+
+    long long GetPlansCount() const { return PlansCount; }
+    long long GetReusedPlansCount() const { return ReusedPlansCount; }
+    std::string GetStatistics() const;
+
+private:
+    struct Window {
+        int StartTrackId; // window starts at min angle of this track, so windows of consecutive ticks are matched
+        double MinAngle;
+        double MaxAngle;
+        int FirstMember; // in WindowMembers
+        int MembersCount;
+        double FirstSlew; // ms to rotate radar from current position
+        bool IsShipFeasible; // used only if ship isn't controlled
+    };
+
+    struct State {
+        int Parent; // -1 for root
+        int WindowIdx;
+        bool IsFullDwell; // dwell lasts until all its tracks are served, otherwise until the first one is
+        double StartTime; // radar and ship are rotated
+        double EndTime;
+        double RadarAngle;
+        double ShipAngle;
+        double Score;
+    };
+
+    // steps of plan are kept between ticks by start tracks, as windows are rebuilt every tick
+    struct Step {
+        int StartTrackId;
+        bool IsFullDwell;
+    };
+
+    void BuildWindows(RotationTimeCache& rotationTimes);
+    void Expand(int stateIdx, std::vector<State>& children, std::vector<char>& served) const;
+    void EvaluateWindow(int parentIdx, int windowIdx, const std::vector<char>& served, std::vector<State>& children) const;
+    void MarkServed(int stateIdx, std::vector<char>& served) const;
+    // adds states of previous plan starting from given step to SeedStates
+    void AddSeed(int firstStep);
+    int FindWindow(int startTrackId) const;
+
+private:
+    const Proto::Parameters& Params;
+    const double Horizon;
+    const int BeamWidth;
+    const int MaxDepth;
+    const double HalfWindow; // half of view angle without margins
+    const double ShipMaxSpeed;
+    const double ShipMaxEps;
+    const double RadarMaxSpeed;
+    const double RadarMaxEps;
+    AngleSegments DeadZones;
+    AngleSegments InvertedDeadZones;
+
+    TaskScheduler* Scheduler; // nullptr - serial
+
+    // current tick
+    const std::pmr::vector<Track>* Tracks = nullptr;
+    RadarPos ShipPos;
+    double ShipTargetAngle = -1;
+    bool IsShipControlled = true;
+    double PinnedBonus = 0;
+
+    // buffers are kept between ticks, so planner doesn't allocate after warm up
+    std::vector<int> TracksOrder; // by min angle
+    std::vector<Window> Windows;
+    std::vector<int> WindowMembers;
+    std::vector<AngleList> WindowAngles; // angles of members, ship must keep them out of dead zones
+
+    std::vector<State> States; // all states of current search, children refer to parents by index
+    std::vector<std::vector<State>> Children; // per expanded state
+    std::vector<std::vector<char>> Served; // per expanded state
+    std::vector<int> Beam;
+    std::vector<int> Candidates;
+    std::vector<std::vector<int>> SeedStates; // by depth
+    std::vector<State> SeedChildren;
+    std::vector<char> SeedServed;
+
+    std::vector<Step> PrevPlan; // best plan of previous tick
+    std::vector<Step> BestPlan;
+
+    long long PlansCount = 0;
+    long long ReusedPlansCount = 0; // plans, which first dwell was continued from previous plan
+    double MaxPlanMs = 0;
+};
+
+
+#endif // RADAR_PLANNER_H
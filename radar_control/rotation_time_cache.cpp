@@ -0,0 +1,121 @@
+#include "rotation_time_cache.h"
+#include "calculations.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace {
+
+    const size_t INITIAL_ENTRIES_COUNT = 256;
+
+    size_t Hash(uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return key;
+    }
+
+}
+
+
+RotationTimeCache::RotationTimeCache(const RuntimeParams& runtime)
+    : Runtime(runtime)
+    , Step(runtime.RotationCacheStep)
+    , Entries(INITIAL_ENTRIES_COUNT)
+{}
+
+void RotationTimeCache::Reset(RadarPos pos, RadarTargetPos targetPos) {
+    Pos = pos;
+    TargetPos = targetPos;
+    ++Generation;
+    EntriesCount = 0;
+}
+
+double RotationTimeCache::GetTimeToRotate(const AngleList& targetAngles) {
+    return GetTimeToRotate(
+        *std::min_element(targetAngles.begin(), targetAngles.end()),
+        *std::max_element(targetAngles.begin(), targetAngles.end())
+    );
+}
+
+double RotationTimeCache::GetTimeToRotate(double minAngle, double maxAngle) {
+    if (Step <= 0) {
+        ++MissesCount;
+        return CalculateTimeToRotate(minAngle, maxAngle);
+    }
+
+    const int minQ = Quantize(minAngle);
+    const int maxQ = Quantize(maxAngle);
+    const uint64_t key = (uint64_t(uint32_t(minQ)) << 32) | uint32_t(maxQ);
+
+    const size_t mask = Entries.size() - 1;
+    size_t idx = Hash(key) & mask;
+    for (; Entries[idx].Generation == Generation; idx = (idx + 1) & mask) {
+        if (Entries[idx].Key == key) {
+            ++HitsCount;
+            return Entries[idx].Time;
+        }
+    }
+    ++MissesCount;
+
+    // quantized angles are used, so result doesn't depend on which target filled cache
+    const double time = CalculateTimeToRotate(minQ * Step, maxQ * Step);
+    Entries[idx] = Entry{.Key = key, .Generation = Generation, .Time = time};
+    if (++EntriesCount * 2 > Entries.size()) {
+        Grow();
+    }
+    return time;
+}
+
+double RotationTimeCache::FindTimeToRotate(double minAngle, double maxAngle) const {
+    if (Step <= 0) {
+        return CalculateTimeToRotate(minAngle, maxAngle);
+    }
+
+    const int minQ = Quantize(minAngle);
+    const int maxQ = Quantize(maxAngle);
+    const uint64_t key = (uint64_t(uint32_t(minQ)) << 32) | uint32_t(maxQ);
+
+    const size_t mask = Entries.size() - 1;
+    for (size_t idx = Hash(key) & mask; Entries[idx].Generation == Generation; idx = (idx + 1) & mask) {
+        if (Entries[idx].Key == key) {
+            return Entries[idx].Time;
+        }
+    }
+    return CalculateTimeToRotate(minQ * Step, maxQ * Step);
+}
+
+int RotationTimeCache::Quantize(double angle) const {
+    return (int) std::lround(angle / Step);
+}
+
+double RotationTimeCache::CalculateTimeToRotate(double minAngle, double maxAngle) const {
+    auto to = CalculateRadarAngleOneTarget(
+        Pos.Angle,
+        TargetPos.Angle,
+        minAngle,
+        maxAngle,
+        Runtime.SmallRadarViewAngle,
+        Runtime.MarginAngle
+    );
+    return TimeToRotate(
+        Pos,
+        RadarTargetPos{.Angle=to, .Speed=Runtime.SmallRadarMaxAngleSpeed},
+        Runtime.SmallRadarMaxEps
+    );
+}
+
+void RotationTimeCache::Grow() {
+    std::vector<Entry> entries(Entries.size() * 2);
+    const size_t mask = entries.size() - 1;
+    for (const auto& entry : Entries) {
+        if (entry.Generation != Generation) continue;
+        size_t idx = Hash(entry.Key) & mask;
+        while (entries[idx].Generation == Generation) {
+            idx = (idx + 1) & mask;
+        }
+        entries[idx] = entry;
+    }
+    Entries.swap(entries);
+}
@@ -0,0 +1,59 @@
+#ifndef ROTATION_TIME_CACHE_H
+#define ROTATION_TIME_CACHE_H
+
+#include "calculations.h"
+#include "data.h"
+#include "util/runtime_params.h"
+
+#include <cstdint>
+#include <vector>
+
+
+// Memoizes TimeToRotateToTarget during one controller tick.
+// Radar state is fixed within tick, so result depends only on target angles, which are quantized to form key.
+// Open addressing table isn't cleared between ticks, entries of previous ticks are told apart by generation,
+// so after warm up cache doesn't allocate.
+class RotationTimeCache {
+public:
+    // runtime must outlive cache
+    RotationTimeCache(const RuntimeParams& runtime);
+
+    // drops cached values, must be called when radar state changes
+    void Reset(RadarPos pos, RadarTargetPos targetPos);
+
+    double GetTimeToRotate(double minAngle, double maxAngle);
+    double GetTimeToRotate(const AngleList& targetAngles);
+    // the same value as GetTimeToRotate, but cache isn't filled, so it may be called from several threads
+    double FindTimeToRotate(double minAngle, double maxAngle) const;
+
+    long long GetHitsCount() const { return HitsCount; }
+    long long GetMissesCount() const { return MissesCount; }
+
+private:
+    struct Entry {
+        uint64_t Key = 0;
+        uint32_t Generation = 0; // 0 - never used
+        double Time = 0;
+    };
+
+    int Quantize(double angle) const;
+    double CalculateTimeToRotate(double minAngle, double maxAngle) const;
+    void Grow();
+
+private:
+    const RuntimeParams& Runtime;
+    const double Step; // 0 - no quantization, cache is bypassed
+
+    RadarPos Pos;
+    RadarTargetPos TargetPos;
+
+    std::vector<Entry> Entries; // size is power of two
+    uint32_t Generation = 1;
+    size_t EntriesCount = 0; // of current generation
+
+    long long HitsCount = 0;
+    long long MissesCount = 0;
+};
+
+
+#endif // ROTATION_TIME_CACHE_H
@@ -0,0 +1,238 @@
+#include "track_associator.h"
+#include "assignment.h"
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+
+namespace {
+
+    // cost of pair out of gate, greater than cost of leaving track without detection
+    const double INFEASIBLE_COST = 1e12;
+
+    // exact comparison, big radar repeats detection bit to bit
+    bool IsLess(const Vector3d& a, const Vector3d& b) {
+        return std::tie(a.X, a.Y, a.Z) < std::tie(b.X, b.Y, b.Z);
+    }
+
+}
+
+
+TrackAssociator::TrackAssociator(const Proto::Parameters& params)
+    : Gate(params.general().association_gate())
+    , DeathTime(params.general().death_time())
+    , Grid(params.general().association_gate())
+    , Costs(&Pool)
+{
+}
+
+void TrackAssociator::Associate(
+    std::vector<BigRadarData>& bigDatas,
+    std::vector<std::vector<SmallRadarData>>& smallDatas
+) {
+    SimpleTimer timer;
+    const double now = Clock.GetElapsedTimeAsPreciseMs();
+
+    Predicted.resize(Tracks.size());
+    for (int i = 0; i < Tracks.size(); ++i) {
+        auto& track = Tracks[i];
+        Predicted[i] = track.Pos + track.Speed * (now - track.UpdateTime);
+        track.IsUpdatedBySmall = false;
+    }
+
+    // every radar measures target at most once, so radars are assigned independently
+    for (auto& datas : smallDatas) {
+        IsGated.assign(Tracks.size(), true);
+        Detections.clear();
+        for (const auto& data : datas) {
+            Detections.push_back(data.Pos);
+        }
+        Assign(Detections);
+
+        int keptCount = 0;
+        for (int i = 0; i < datas.size(); ++i) {
+            const int trackIdx = DetectionTracks[i];
+            if (trackIdx < 0) {
+                ++DroppedCount;
+                continue;
+            }
+            auto& track = Tracks[trackIdx];
+            track.Pos = datas[i].Pos;
+            track.UpdateTime = now;
+            track.IsUpdatedBySmall = true;
+            datas[keptCount] = datas[i];
+            datas[keptCount].Id = track.Id;
+            ++keptCount;
+        }
+        datas.resize(keptCount);
+        AssociatedCount += keptCount;
+    }
+
+    // repeated big radar detection keeps its label and doesn't update track
+    IsGated.assign(Tracks.size(), true);
+    StaleOrder.resize(Tracks.size());
+    std::iota(StaleOrder.begin(), StaleOrder.end(), 0);
+    std::sort(StaleOrder.begin(), StaleOrder.end(), [this](int a, int b) {
+        return IsLess(Tracks[a].LastBigPos, Tracks[b].LastBigPos);
+    });
+    Detections.clear();
+    FreshDetections.clear();
+    for (int i = 0; i < bigDatas.size(); ++i) {
+        auto& data = bigDatas[i];
+        auto it = std::lower_bound(StaleOrder.begin(), StaleOrder.end(), data.Pos, [this](int idx, const Vector3d& pos) {
+            return IsLess(Tracks[idx].LastBigPos, pos);
+        });
+        if (it != StaleOrder.end() && IsGated[*it] && !IsLess(data.Pos, Tracks[*it].LastBigPos)) {
+            data.Id = Tracks[*it].Id;
+            IsGated[*it] = false;
+            ++AssociatedCount;
+        } else {
+            Detections.push_back(data.Pos);
+            FreshDetections.push_back(i);
+        }
+    }
+    Assign(Detections);
+
+    const int oldTracksCount = Tracks.size();
+    for (int i = 0; i < FreshDetections.size(); ++i) {
+        auto& data = bigDatas[FreshDetections[i]];
+        const int trackIdx = DetectionTracks[i];
+        if (trackIdx < 0) {
+            data.Id = NextId++;
+            Tracks.push_back(Track{
+                .Id = data.Id,
+                .Pos = data.Pos,
+                .Speed = data.Speed,
+                .UpdateTime = now,
+                .LastBigPos = data.Pos,
+                .IsUpdatedBySmall = false
+            });
+            ++InitiatedCount;
+            continue;
+        }
+        auto& track = Tracks[trackIdx];
+        data.Id = track.Id;
+        if (!track.IsUpdatedBySmall) {
+            track.Pos = data.Pos;
+        }
+        track.Speed = data.Speed;
+        track.LastBigPos = data.Pos;
+        track.UpdateTime = now;
+        ++AssociatedCount;
+    }
+
+    // controller forgets target after the same time without measurements
+    for (int i = oldTracksCount - 1; i >= 0; --i) {
+        if (now - Tracks[i].UpdateTime > DeathTime) {
+            Tracks[i] = Tracks.back();
+            Tracks.pop_back();
+            ++DeletedCount;
+        }
+    }
+
+    MaxAssociationMs = std::max(MaxAssociationMs, timer.GetElapsedTimeAsPreciseMs());
+}
+
+void TrackAssociator::Assign(const std::vector<Vector3d>& detections) {
+    const int tracksCount = Tracks.size();
+    DetectionTracks.assign(detections.size(), -1);
+    if (detections.empty() || tracksCount == 0) {
+        return;
+    }
+
+    Grid.Build(detections);
+    Pairs.clear();
+    Parents.resize(tracksCount + detections.size());
+    std::iota(Parents.begin(), Parents.end(), 0);
+    for (int track = 0; track < tracksCount; ++track) {
+        if (!IsGated[track]) {
+            continue;
+        }
+        Grid.ForEachNear(Predicted[track], Predicted[track], Gate, [&](int detection, double distance) {
+            Pairs.push_back(GatedPair{
+                .Component = -1,
+                .Track = track,
+                .Detection = detection,
+                .Cost = distance * distance
+            });
+            Parents[FindRoot(track)] = FindRoot(tracksCount + detection);
+        });
+    }
+
+    for (auto& pair : Pairs) {
+        pair.Component = FindRoot(pair.Track);
+    }
+    std::sort(Pairs.begin(), Pairs.end(), [](const GatedPair& a, const GatedPair& b) {
+        return std::tie(a.Component, a.Track, a.Detection) < std::tie(b.Component, b.Track, b.Detection);
+    });
+
+    LocalIndices.assign(Parents.size(), -1);
+    for (int first = 0; first < Pairs.size();) {
+        int last = first + 1;
+        while (last < Pairs.size() && Pairs[last].Component == Pairs[first].Component) {
+            ++last;
+        }
+        AssignComponent(first, last);
+        first = last;
+    }
+}
+
+void TrackAssociator::AssignComponent(int firstPair, int lastPair) {
+    // isolated track with the only detection in gate
+    if (lastPair - firstPair == 1) {
+        DetectionTracks[Pairs[firstPair].Detection] = Pairs[firstPair].Track;
+        return;
+    }
+
+    const int tracksCount = Tracks.size();
+    ComponentTracks.clear();
+    ComponentDetections.clear();
+    for (int i = firstPair; i < lastPair; ++i) {
+        const auto& pair = Pairs[i];
+        if (LocalIndices[pair.Track] < 0) {
+            LocalIndices[pair.Track] = ComponentTracks.size();
+            ComponentTracks.push_back(pair.Track);
+        }
+        if (LocalIndices[tracksCount + pair.Detection] < 0) {
+            LocalIndices[tracksCount + pair.Detection] = ComponentDetections.size();
+            ComponentDetections.push_back(pair.Detection);
+        }
+    }
+
+    // track may be left without detection for the cost of detection on gate border
+    const int rowsCount = ComponentTracks.size();
+    const int detectionsCount = ComponentDetections.size();
+    const int colsCount = detectionsCount + rowsCount;
+    Costs.assign((size_t) rowsCount * colsCount, INFEASIBLE_COST);
+    for (int row = 0; row < rowsCount; ++row) {
+        Costs[row * colsCount + detectionsCount + row] = Gate * Gate;
+    }
+    for (int i = firstPair; i < lastPair; ++i) {
+        const auto& pair = Pairs[i];
+        Costs[LocalIndices[pair.Track] * colsCount + LocalIndices[tracksCount + pair.Detection]] = pair.Cost;
+    }
+
+    const auto cols = SolveAssignment(Costs, rowsCount, colsCount, &Pool);
+    for (int row = 0; row < rowsCount; ++row) {
+        if (cols[row] < detectionsCount) {
+            DetectionTracks[ComponentDetections[cols[row]]] = ComponentTracks[row];
+        }
+    }
+}
+
+int TrackAssociator::FindRoot(int node) {
+    while (Parents[node] != node) {
+        Parents[node] = Parents[Parents[node]];
+        node = Parents[node];
+    }
+    return node;
+}
+
+std::string TrackAssociator::GetStatistics() const {
+    return "Associated detections:         " + std::to_string(AssociatedCount) + "\n"
+        + "Initiated tracks:              " + std::to_string(InitiatedCount) + "\n"
+        + "Deleted tracks:                " + std::to_string(DeletedCount) + "\n"
+        + "Dropped detections:            " + std::to_string(DroppedCount) + "\n"
+        + "Max association time:          " + std::to_string(MaxAssociationMs) + " ms";
+}
@@ -0,0 +1,85 @@
+#ifndef TRACK_ASSOCIATOR_H
+#define TRACK_ASSOCIATOR_H
+
+#include "data.h"
+#include "proto/generated/params.pb.h"
+#include "util/spatial_grid.h"
+#include "util/timer.h"
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+
+// Labels detections without target ids by track ids, runs ahead of controllers.
+// Detection may belong to track if it is within gate of track's predicted position, detections of one radar
+// are assigned to tracks by Hungarian method with min total squared distance. Assignment problem is split by
+// connected components of gating graph, so it stays small however many detections there are.
+// Track is initiated by big radar detection, which isn't assigned to any track, and deleted after death time
+// without measurements. Small radar detections without track are dropped.
+class TrackAssociator {
+public:
+    explicit TrackAssociator(const Proto::Parameters& params);
+
+    // sets ids of detections in place, smallDatas[i] - detections of i-th small radar
+    void Associate(std::vector<BigRadarData>& bigDatas, std::vector<std::vector<SmallRadarData>>& smallDatas);
+
+    int GetTracksCount() const { return Tracks.size(); }
+    std::string GetStatistics() const;
+
+private:
+    struct Track {
+        int Id;
+        Vector3d Pos;
+        Vector3d Speed; // per ms, known from big radar only
+        double UpdateTime; // ms of last measurement
+        Vector3d LastBigPos; // big radar repeats detection until target is measured again
+        bool IsUpdatedBySmall; // in current frame
+    };
+
+    // fills DetectionTracks by index of track for each detection or -1, track gets at most one detection,
+    // only tracks with IsGated flag are considered
+    void Assign(const std::vector<Vector3d>& detections);
+    void AssignComponent(int firstPair, int lastPair);
+    int FindRoot(int node);
+
+private:
+    const double Gate;
+    const double DeathTime;
+
+    std::vector<Track> Tracks;
+    int NextId = 0;
+    SimpleTimer Clock;
+
+    // buffers are kept between frames
+    std::vector<Vector3d> Predicted; // positions of tracks
+    std::vector<char> IsGated; // per track
+    std::vector<Vector3d> Detections;
+    std::vector<int> DetectionTracks;
+    std::vector<int> StaleOrder; // tracks by last big radar position
+    std::vector<int> FreshDetections; // big radar detections, which weren't seen in previous frames
+    SpatialGrid Grid; // over detections
+
+    struct GatedPair {
+        int Component; // root node, tracks are nodes [0, tracks), detections follow them
+        int Track;
+        int Detection;
+        double Cost;
+    };
+    std::vector<GatedPair> Pairs;
+    std::vector<int> Parents; // disjoint sets of gating graph
+    std::vector<int> ComponentTracks;
+    std::vector<int> ComponentDetections;
+    std::vector<int> LocalIndices; // per node, index of track or detection in its component
+    std::pmr::unsynchronized_pool_resource Pool; // scratch of assignment solver
+    std::pmr::vector<double> Costs;
+
+    long long AssociatedCount = 0;
+    long long InitiatedCount = 0;
+    long long DeletedCount = 0;
+    long long DroppedCount = 0;
+    double MaxAssociationMs = 0;
+};
+
+
+#endif // TRACK_ASSOCIATOR_H
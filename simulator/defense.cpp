@@ -1,96 +1,248 @@
 #include "defense.h"
 #include "util/points.h"
 
+#include <algorithm>
+#include <limits>
 
-DefRocket::DefRocket(Vector3d meetPoint, double speed, unsigned timeToLaunchMs)
-    : Pos()
-    , MeetPoint(meetPoint)
-    , Speed(MeetPoint * speed / SqrtOfSumSquares(meetPoint)), TimeToLaunchMs(timeToLaunchMs)
-{}
 
-void DefRocket::UpdatePosition() {
-    double ms = Timer.GetElapsedTimeAsMs();
-    if (!IsLaunchedFlag || IsExplodedFlag) {
-        if (ms < TimeToLaunchMs || IsExplodedFlag) {
-            return;
-        } else {
-            ms -= TimeToLaunchMs;
-            TestTimer.Restart();
-            IsLaunchedFlag = true;
-        }
-    }
-    Timer.Restart();
+namespace {
 
-    Pos += Speed * ms;
+    // intercepts of fewer rockets are checked serially
+    const size_t MIN_PARALLEL_ROCKETS = 256;
 
-    if (IsSignsEqual(Pos - MeetPoint, Speed)) {
-        Pos = MeetPoint;
-        IsExplodedFlag = true;
-    }
 }
 
-Vector3d DefRocket::GetPosition() const {
-    return Pos;
-}
 
-Vector3d DefRocket::GetMeetPoint() const {
-    return MeetPoint;
+void Defense::RocketArrays::Add(Vector3d meetPoint, double launchDelay, int targetId) {
+    const double meetDistance = SqrtOfSumSquares(meetPoint);
+    const auto dir = (meetDistance > 0 ? meetPoint / meetDistance : Vector3d::Zero());
+    DirX.push_back(dir.X);
+    DirY.push_back(dir.Y);
+    DirZ.push_back(dir.Z);
+    MeetDistances.push_back(meetDistance);
+    LaunchDelays.push_back(launchDelay);
+    Distances.push_back(0);
+    PrevDistances.push_back(0);
+    MinTargetDistances.push_back(std::numeric_limits<double>::infinity());
+    TargetIds.push_back(targetId);
 }
 
-bool DefRocket::IsLaunched() const {
-    return IsLaunchedFlag;
+void Defense::RocketArrays::SwapRemove(size_t i) {
+    auto swapRemove = [i](auto& vec) {
+        vec[i] = vec.back();
+        vec.pop_back();
+    };
+    swapRemove(DirX);
+    swapRemove(DirY);
+    swapRemove(DirZ);
+    swapRemove(MeetDistances);
+    swapRemove(LaunchDelays);
+    swapRemove(Distances);
+    swapRemove(PrevDistances);
+    swapRemove(MinTargetDistances);
+    swapRemove(TargetIds);
 }
 
-bool DefRocket::IsExploded() const {
-    return IsExplodedFlag;
-}
 
+Defense::Defense(const Proto::Parameters& params, TaskScheduler* scheduler)
+    : Runtime(CompileParams(params))
+    , TargetsGrid(Runtime.KillRadius)
+    , Scheduler(scheduler)
+{
+    if (Runtime.HasLaunchers) {
+        const int magazineSize = Runtime.MagazineSize;
+        for (int i = 0; i < Runtime.LaunchersCount; ++i) {
+            Launchers.push_back(Launcher{.RocketsLeft = (magazineSize == 0 ? -1 : magazineSize)});
+        }
+    }
+}
 
-Defense::Defense(const Proto::Parameters& params)
-    : Params(params)
-{}
+bool Defense::TryUseLauncher(int launcherId) {
+    if (launcherId < 0 || launcherId >= Launchers.size()) {
+        return false;
+    }
+    auto& launcher = Launchers[launcherId];
+    // controller tracks reload on its own clock, which may run up to one tick ahead
+    const double tolerance = Runtime.SmallRadarPeriod;
+    const bool isReloaded =
+        !launcher.IsReloading
+        || launcher.ReloadTimer.GetElapsedTimeAsPreciseMs() + tolerance >= Runtime.ReloadTime;
+    if (launcher.RocketsLeft == 0 || !isReloaded) {
+        return false;
+    }
+    if (launcher.RocketsLeft != -1) {
+        --launcher.RocketsLeft;
+    }
+    launcher.IsReloading = true;
+    launcher.ReloadTimer.Restart();
+    return true;
+}
 
-void Defense::LaunchRockets(const std::vector<std::pair<Vector3d, int>>& meetPointsAndTargetIds) {
-    for (const auto& [point, targetId] : meetPointsAndTargetIds) {
-        Rockets.emplace_back(
-            DefRocket(point, Params.defense().rocket_speed(), Params.defense().time_to_launch_rocket()),
+std::vector<std::pair<int, int>> Defense::LaunchRockets(
+    const std::vector<std::pair<Vector3d, int>>& meetPointsAndTargetIds,
+    const std::vector<int>& launcherIds
+) {
+    std::vector<std::pair<int, int>> rejected;
+    for (int i = 0; i < meetPointsAndTargetIds.size(); ++i) {
+        const auto& [point, targetId] = meetPointsAndTargetIds[i];
+        const int launcherId = (i < launcherIds.size() ? launcherIds[i] : -1);
+        if (Runtime.HasLaunchers && !TryUseLauncher(launcherId)) {
+            ++RejectedLaunchesCount;
+            rejected.emplace_back(targetId, launcherId);
+            continue;
+        }
+        ++LaunchedRocketsCount;
+        // next update advances rockets by time since previous one, which passed before this launch
+        Rockets.Add(
+            point,
+            Runtime.TimeToLaunchRocket + UpdateTimer.GetElapsedTimeAsPreciseMs(),
             targetId
         );
     }
+    return rejected;
 }
 
-std::vector<int> Defense::GetDestroyedTargetsId() {
+std::vector<int> Defense::GetDestroyedTargetsId(
+    const std::vector<int>& targetIds,
+    const std::vector<Vector3d>& targetPositions,
+    const std::vector<Vector3d>& targetSpeeds
+) {
+    const double dt = UpdateTimer.GetElapsedTimeAsPreciseMs();
+    UpdateTimer.Restart();
+
+    // motion of all rockets, branchless, so compiler vectorizes it
+    const size_t count = Rockets.Size();
+    double* launchDelays = Rockets.LaunchDelays.data();
+    double* distances = Rockets.Distances.data();
+    double* prevDistances = Rockets.PrevDistances.data();
+    const double* meetDistances = Rockets.MeetDistances.data();
+    const double rocketSpeed = Runtime.RocketSpeed;
+    for (size_t i = 0; i < count; ++i) {
+        const double flightTime = std::min(std::max(dt - launchDelays[i], 0.), dt);
+        launchDelays[i] = std::max(launchDelays[i] - dt, 0.);
+        prevDistances[i] = distances[i];
+        distances[i] = std::min(distances[i] + rocketSpeed * flightTime, meetDistances[i]);
+    }
+
+    TargetPositions = targetPositions;
+    PrevTargetPositions.resize(targetPositions.size());
+    MaxTargetShift = 0;
+    for (int i = 0; i < targetPositions.size(); ++i) {
+        PrevTargetPositions[i] = targetPositions[i] - targetSpeeds[i] * dt;
+        MaxTargetShift = std::max(MaxTargetShift, SqrtOfSumSquares(targetSpeeds[i]) * dt);
+    }
+    // cells of query radius, so rocket path visits only cells next to the ones it crosses
+    TargetsGrid.Build(targetPositions, Runtime.KillRadius + MaxTargetShift);
+    IsTargetDestroyed.assign(targetIds.size(), false);
+    TargetIndices.clear();
+    for (int i = 0; i < targetIds.size(); ++i) {
+        TargetIndices[targetIds[i]] = i;
+    }
+
+    // rockets don't affect each other until some target is destroyed, so closest targets are found in parallel
+    ClosestTargets.assign(count, -1);
+    auto findClosestTarget = [&](int i) {
+        if (Rockets.LaunchDelays[i] > 0) {
+            return;
+        }
+        // whole path since previous update is tested, so fast rockets don't jump over targets
+        const auto from = Rockets.GetPosition(i, Rockets.PrevDistances[i]);
+        const auto to = Rockets.GetPosition(i, Rockets.Distances[i]);
+
+        auto it = TargetIndices.find(Rockets.TargetIds[i]);
+        if (it != TargetIndices.end()) {
+            Rockets.MinTargetDistances[i] = std::min(
+                Rockets.MinTargetDistances[i],
+                GetApproachDistance(from, to, it->second)
+            );
+        }
+        ClosestTargets[i] = FindClosestTarget(from, to);
+    };
+    if (Scheduler && count >= MIN_PARALLEL_ROCKETS) {
+        Scheduler->ParallelFor(count, findClosestTarget);
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            findClosestTarget(i);
+        }
+    }
+
     std::vector<int> res;
-    for (int i = 0; i < Rockets.size(); i++) {
-        auto& rocket = Rockets[i].first;
-        rocket.UpdatePosition();
-
-        if (rocket.IsExploded()) {
-            res.push_back(Rockets[i].second);
-            Rockets.erase(Rockets.begin() + i);
-            i--;
+    RocketsPositions.clear();
+    for (size_t i = 0; i < Rockets.Size();) {
+        if (Rockets.LaunchDelays[i] > 0) {
+            ++i;
+            continue;
+        }
+        const auto to = Rockets.GetPosition(i, Rockets.Distances[i]);
+
+        // the closest target is hit, target is destroyed by one rocket only
+        int hitIdx = ClosestTargets[i];
+        if (hitIdx != -1 && IsTargetDestroyed[hitIdx]) {
+            hitIdx = FindClosestTarget(Rockets.GetPosition(i, Rockets.PrevDistances[i]), to);
+        }
+
+        if (hitIdx != -1) {
+            IsTargetDestroyed[hitIdx] = true;
+            res.push_back(targetIds[hitIdx]);
+            ++HitsCount;
+        } else if (Rockets.Distances[i] >= Rockets.MeetDistances[i]) {
+            // rocket explodes at meet point
+            ++MissesCount;
+            if (TargetIndices.count(Rockets.TargetIds[i])) {
+                ++MeasuredMissesCount;
+                MissDistancesSum += Rockets.MinTargetDistances[i];
+            }
+        } else {
+            RocketsPositions.push_back(to);
+            ++i;
+            continue;
         }
+        Rockets.SwapRemove(i);
+        ClosestTargets[i] = ClosestTargets.back();
+        ClosestTargets.pop_back();
     }
     return res;
 }
 
-std::vector<Vector3d> Defense::GetRocketsPositions() {
-    std::vector<Vector3d> res;
-    for (auto& [rocket, _] : Rockets) {
-        if (rocket.IsLaunched() && !rocket.IsExploded()) {
-            rocket.UpdatePosition();
-            res.push_back(rocket.GetPosition());
+double Defense::GetApproachDistance(Vector3d from, Vector3d to, int targetIdx) const {
+    // target is still in its own frame, where rocket moves along segment of relative positions
+    return DistancePoint2Segment(
+        Vector3d::Zero(),
+        from - PrevTargetPositions[targetIdx],
+        to - TargetPositions[targetIdx]
+    );
+}
+
+int Defense::FindClosestTarget(Vector3d from, Vector3d to) const {
+    int res = -1;
+    double minDistance = Runtime.KillRadius;
+    // target came within kill radius of rocket only if it is now within kill radius plus its shift of rocket path
+    TargetsGrid.ForEachNear(from, to, Runtime.KillRadius + MaxTargetShift, [&](int idx, double) {
+        if (IsTargetDestroyed[idx]) {
+            return;
         }
-    }
+        const double distance = GetApproachDistance(from, to, idx);
+        if (distance <= minDistance) {
+            res = idx;
+            minDistance = distance;
+        }
+    });
     return res;
 }
 
-std::vector<Vector3d> Defense::GetMeetPoints() {
+std::vector<Vector3d> Defense::GetMeetPoints() const {
     std::vector<Vector3d> res;
-    for (auto& [rocket, _] : Rockets) {
-        if (!rocket.IsExploded()) {
-            res.push_back(rocket.GetMeetPoint());
-        }
+    for (size_t i = 0; i < Rockets.Size(); ++i) {
+        res.push_back(Rockets.GetPosition(i, Rockets.MeetDistances[i]));
     }
     return res;
 }
+
+std::string Defense::GetStatistics() const {
+    return "Launched rockets:              " + std::to_string(LaunchedRocketsCount) + "\n"
+        + "Rejected launches:             " + std::to_string(RejectedLaunchesCount) + "\n"
+        + "Rocket hits:                   " + std::to_string(HitsCount) + "\n"
+        + "Rocket misses:                 " + std::to_string(MissesCount) + "\n"
+        + "Mean miss distance:            "
+        + (MeasuredMissesCount == 0 ? "-" : std::to_string(MissDistancesSum / MeasuredMissesCount));
+}
@@ -3,48 +3,103 @@
 
 #include "proto/generated/params.pb.h"
 #include "util/points.h"
+#include "util/runtime_params.h"
+#include "util/spatial_grid.h"
+#include "util/task_scheduler.h"
 #include "util/timer.h"
 
-
-class DefRocket {
-public:
-    DefRocket(Vector3d meetPoint, double speed, unsigned timeToLaunchMs);
-
-    void UpdatePosition();
-
-    Vector3d GetPosition() const;
-    Vector3d GetMeetPoint() const;
-    bool IsLaunched() const;
-    bool IsExploded() const;
-
-private:
-    Vector3d Pos;
-    Vector3d MeetPoint;
-    Vector3d Speed;
-
-    SimpleTimer Timer;
-    SimpleTimer TestTimer;
-
-    bool IsLaunchedFlag = false;
-    bool IsExplodedFlag = false;
-    unsigned TimeToLaunchMs;
-};
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 
 class Defense {
 public:
-    Defense(const Proto::Parameters& params);
+    // without scheduler intercepts are checked serially
+    Defense(const Proto::Parameters& params, TaskScheduler* scheduler = nullptr);
+
+    // launcherIds[i] - launcher of i-th rocket, launch is rejected if launcher isn't ready or has no rockets,
+    // returns target and launcher ids of rejected launches, which controller has to know to engage targets again
+    std::vector<std::pair<int, int>> LaunchRockets(
+        const std::vector<std::pair<Vector3d, int>>& meetPointsAndTargetIds,
+        const std::vector<int>& launcherIds = {}
+    );
+
+    // Advances all rockets by time since previous call, must be called once per tick.
+    // targetPositions[i] and targetSpeeds[i] - real position and speed of target with id targetIds[i],
+    // target is destroyed by rocket, which came within kill radius from it since previous call,
+    // both rocket and target move along straight lines during that time
+    std::vector<int> GetDestroyedTargetsId(
+        const std::vector<int>& targetIds,
+        const std::vector<Vector3d>& targetPositions,
+        const std::vector<Vector3d>& targetSpeeds
+    );
+    // positions of launched rockets after last GetDestroyedTargetsId
+    const std::vector<Vector3d>& GetRocketsPositions() const { return RocketsPositions; }
+    std::vector<Vector3d> GetMeetPoints() const;
+
+    std::string GetStatistics() const;
 
-    void LaunchRockets(const std::vector<std::pair<Vector3d, int>>& meetPointsAndTargetIds);
-
-    std::vector<int> GetDestroyedTargetsId();
-    std::vector<Vector3d> GetRocketsPositions();
-    std::vector<Vector3d> GetMeetPoints();
+private:
+    struct Launcher {
+        int RocketsLeft; // -1 - unlimited
+        bool IsReloading = false;
+        SimpleTimer ReloadTimer;
+    };
+
+    // Rockets fly straight from ship to meet point with the same speed, so rocket state is its distance from ship.
+    // i-th elements of all arrays belong to the same rocket, removed rocket is replaced by the last one.
+    struct RocketArrays {
+        std::vector<double> DirX; // unit direction of flight
+        std::vector<double> DirY;
+        std::vector<double> DirZ;
+        std::vector<double> MeetDistances;
+        std::vector<double> LaunchDelays; // ms until launch
+        std::vector<double> Distances;
+        std::vector<double> PrevDistances; // before last update, intercepts are checked along path from there
+        std::vector<double> MinTargetDistances; // closest approach to its target so far
+        std::vector<int> TargetIds;
+
+        size_t Size() const { return TargetIds.size(); }
+        void Add(Vector3d meetPoint, double launchDelay, int targetId);
+        void SwapRemove(size_t i);
+        Vector3d GetPosition(size_t i, double distance) const {
+            return Vector3d(DirX[i], DirY[i], DirZ[i]) * distance;
+        }
+    };
 
 private:
-    const Proto::Parameters& Params;
+    bool TryUseLauncher(int launcherId);
+    // closest approach of rocket, moved from -> to, and target since previous call
+    double GetApproachDistance(Vector3d from, Vector3d to, int targetIdx) const;
+    // index of the closest not destroyed target, which rocket came within kill radius from, -1 if there is no such target
+    int FindClosestTarget(Vector3d from, Vector3d to) const;
 
-    std::vector<std::pair<DefRocket, int>> Rockets;
+private:
+    const RuntimeParams Runtime;
+
+    RocketArrays Rockets;
+    SimpleTimer UpdateTimer;
+    std::vector<Vector3d> RocketsPositions;
+
+    // broadphase of intercept check, buffers are reused between calls
+    SpatialGrid TargetsGrid;
+    std::vector<Vector3d> TargetPositions;
+    std::vector<Vector3d> PrevTargetPositions; // at previous call
+    double MaxTargetShift = 0; // since previous call, widens grid query, which is built on current positions
+    std::vector<char> IsTargetDestroyed;
+    std::unordered_map<int, int> TargetIndices; // id -> index in targets of current call
+    std::vector<int> ClosestTargets; // per rocket, found before any target of current call is destroyed
+
+    TaskScheduler* Scheduler;
+
+    std::vector<Launcher> Launchers; // empty if launchers aren't modeled
+    int LaunchedRocketsCount = 0;
+    int RejectedLaunchesCount = 0;
+    int HitsCount = 0;
+    int MissesCount = 0;
+    int MeasuredMissesCount = 0; // misses, which target was alive until rocket exploded
+    double MissDistancesSum = 0;
 };
 
 
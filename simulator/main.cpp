@@ -1,8 +1,13 @@
 #include "defense.h"
 #include "proto/generated/params.pb.h"
 #include "radar_control/radar_controller.h"
+#include "radar_control/radar_coordinator.h"
+#include "radar_control/track_associator.h"
 #include "simulator.h"
 #include "util/proto.h"
+#include "util/proto_cache.h"
+#include "util/task_scheduler.h"
+#include "util/tick_scheduler.h"
 #include "util/util.h"
 #include "visualizer.h"
 
@@ -39,6 +44,9 @@ int main(int argc, char* argv[]) {
            .help("name of scenario file, if not specified random scenario will be used.\nAvailable scenarios: "
            + VectorToString(available_scenarios) + ".")
            .default_value<std::string>("");
+    program.add_argument("-c", "--config")
+           .help("name of config file in config directory")
+           .default_value<std::string>("default");
     program.parse_args(argc, argv);
 
     if (program["--help"] == true) {
@@ -49,10 +57,13 @@ int main(int argc, char* argv[]) {
 
 
     std::string config_dir = getenv("RADARCONTROL_CONFIG_DIR") ? getenv("RADARCONTROL_CONFIG_DIR") : "../config";
-    std::string config_path = config_dir + "/default.pbtxt";
+    std::string config_path = config_dir + "/" + program.get<std::string>("--config") + ".pbtxt";
 
-    auto params = ParseProtoFromFile<Proto::Parameters>(config_path);
-    PrepareParams(params);
+    // prepared config and scenario are loaded from binary cache, if their files weren't changed since previous run
+    std::string cache_dir = getenv("RADARCONTROL_CACHE_DIR") ? getenv("RADARCONTROL_CACHE_DIR") : "../cache";
+    ProtoCache protoCache(cache_dir);
+
+    auto params = protoCache.LoadParams(config_path);
 
     if (params.simulator().has_random_seed()) {
         srand(params.simulator().random_seed());
@@ -62,54 +73,87 @@ int main(int argc, char* argv[]) {
 
     TargetScheduler targetScheduler(params);
     if (!scenario_name.empty()) {
-        targetScheduler.SetScenario(scenariod_dir + "/" + scenario_name + scenario_extension);
+        targetScheduler.SetScenario(protoCache.LoadScenario(scenariod_dir + "/" + scenario_name + scenario_extension, params));
     }
 
-    RadarController radarController(params, targetScheduler.GetRadarStartAngle(), targetScheduler.GetShipStartAngle());
+    // one pool of threads for all parallel stages
+    TaskScheduler taskScheduler(params.general().scheduler_threads() - 1, params.general().scheduler_pin_threads());
+
+    RadarCoordinator radarCoordinator(
+        params,
+        targetScheduler.GetRadarStartAngle(),
+        targetScheduler.GetShipStartAngle(),
+        &taskScheduler
+    );
     Simulator simulator(
         params,
         targetScheduler.GetRadarStartAngle(),
         targetScheduler.GetShipStartAngle(),
-        !scenario_name.empty()
+        !scenario_name.empty(),
+        &taskScheduler
     );
-    Defense defense(params);
+    TrackAssociator trackAssociator(params);
+    Defense defense(params, &taskScheduler);
     Visualizer visualizer(params);
 
+    TickScheduler tickScheduler(1000. / params.small_radar().frequency());
+
+    std::vector<BigRadarData> bigRadarTargets;
+    std::vector<std::vector<SmallRadarData>> smallRadarTargets(radarCoordinator.GetRadarsCount());
+    std::vector<int> targetIds;
+    std::vector<Vector3d> targetPositions;
+    std::vector<Vector3d> targetSpeeds;
+    RadarController::Snapshot controllerSnapshot;
+    RadarController::Snapshot prevControllerSnapshot;
+    radarCoordinator.GetSnapshot(controllerSnapshot);
     bool wasScenarioEndedSuccefully = false;
 
     while (visualizer.IsWindowOpen()) {
-        if (targetScheduler.IsScenarioEnded() && !simulator.IsThereAnyTargets() && !radarController.IsThereAnyTargets()) {
+        if (targetScheduler.IsScenarioEnded() && !simulator.IsThereAnyTargets() && !radarCoordinator.IsThereAnyTargets()) {
             wasScenarioEndedSuccefully = true;
             break;
         }
 
-        targetScheduler.LaunchTargets(simulator);
-
-        const auto& bigRadarTargets = simulator.GetBigRadarTargets();
-        const auto& smallRadarTargets = simulator.GetSmallRadarTargets();
-
-        radarController.Process(bigRadarTargets, smallRadarTargets);
-
-        auto res = radarController.GetAngleAndMeetPoints();
-
-        defense.LaunchRockets(res.MeetPointsAndTargetIds);
+        // controller and simulator run at radar frequency, rendering runs as fast as visualizer allows
+        if (int periods = tickScheduler.PollTick(); periods > 0) {
+            targetScheduler.LaunchTargets(simulator);
+
+            bigRadarTargets = simulator.GetBigRadarTargets();
+            for (int i = 0; i < smallRadarTargets.size(); ++i) {
+                smallRadarTargets[i] = simulator.GetSmallRadarTargets(i);
+            }
+            if (params.simulator().strip_ids()) {
+                trackAssociator.Associate(bigRadarTargets, smallRadarTargets);
+            }
+
+            radarCoordinator.Process(bigRadarTargets, smallRadarTargets);
+            radarCoordinator.AdvancePositions(periods * tickScheduler.GetPeriodMs());
+
+            std::swap(prevControllerSnapshot, controllerSnapshot);
+            radarCoordinator.GetSnapshot(controllerSnapshot);
+
+            radarCoordinator.RejectLaunches(
+                defense.LaunchRockets(controllerSnapshot.MeetPointsAndTargetIds, controllerSnapshot.LauncherIds)
+            );
+
+            simulator.GetTargetsPositions(targetIds, targetPositions, targetSpeeds);
+            simulator.RemoveTargets(defense.GetDestroyedTargetsId(targetIds, targetPositions, targetSpeeds));
+            simulator.SetRadarPosition(controllerSnapshot.Radar.Angle);
+            for (int i = 0; i < controllerSnapshot.ExtraRadars.size(); ++i) {
+                simulator.SetRadarPosition(controllerSnapshot.ExtraRadars[i].Angle, i + 1);
+            }
+            simulator.SetShipPosition(controllerSnapshot.Ship.Angle);
+            simulator.UpdateTargets();
+        }
 
         visualizer.DrawFrame(
             bigRadarTargets,
             smallRadarTargets,
-            radarController.GetPriorities(),
-            res.FollowedTargetIds,
-            defense.GetRocketsPositions(),
-            radarController.GetEntryPoints(),
-            radarController.GetApproximateMeetPoints(),
-            res.RadarAngle,
-            res.ShipAngle
+            prevControllerSnapshot,
+            controllerSnapshot,
+            tickScheduler.GetInterpolationFactor(),
+            defense.GetRocketsPositions()
         );
-
-        simulator.RemoveTargets(defense.GetDestroyedTargetsId());
-        simulator.SetRadarPosition(res.RadarAngle);
-        simulator.SetShipPosition(res.ShipAngle);
-        simulator.UpdateTargets();
     }
 
     if (!scenario_name.empty()) {
@@ -120,7 +164,13 @@ int main(int argc, char* argv[]) {
         }
         std::cout << "\n";
     }
-    std::cout << simulator.GetStatistics() << std::endl;
+    std::cout << simulator.GetStatistics() << "\n";
+    std::cout << tickScheduler.GetStatistics() << "\n";
+    std::cout << defense.GetStatistics() << "\n";
+    std::cout << radarCoordinator.GetStatistics() << std::endl;
+    if (params.simulator().strip_ids()) {
+        std::cout << "\n" << trackAssociator.GetStatistics() << std::endl;
+    }
 
     return 0;
 }
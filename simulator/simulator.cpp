@@ -1,6 +1,7 @@
 #include "simulator.h"
 #include "proto/generated/scenario.pb.h"
 #include "radar_control/calculations.h"
+#include "util/interval_set.h"
 #include "util/points.h"
 #include "util/proto.h"
 #include "util/util.h"
@@ -12,52 +13,48 @@
 using namespace SIM;
 
 
+namespace {
+
+    // sectors of fewer targets are checked serially
+    const int MIN_PARALLEL_TARGETS = 256;
+
+}
+
+
 Target::Target(
-    const Proto::Parameters& params,
+    const RuntimeParams& params,
     unsigned int id,
     double presetPriority,
     Vector3d pos,
     Vector3d speed,
     double msFromStart
 )
-    : Params(params)
+    : Runtime(params)
     , Id(id)
     , PresetPriority(presetPriority)
     , RealPos(pos)
     , RealSpeed(speed)
-    , BigRadarUpdatePeriodMs(1000. / Params.big_radar().frequency())
+    , BigRadarUpdatePeriodMs(Runtime.BigRadarPeriod)
 {
     RealPos += RealSpeed * msFromStart;
     FilteredPos = RealPos;
 }
 
-void Target::UpdatePosition(bool isInSector) {
-    if (!isInSector && Timer.GetElapsedTimeAsMs() < BigRadarUpdatePeriodMs) {
+void Target::UpdatePosition(const RuntimeParams* smallRadar, bool isInResponsibleSector) {
+    if (!smallRadar && Timer.GetElapsedTimeAsMs() < BigRadarUpdatePeriodMs) {
         return;
     }
     Vector3d stddev;
-    if (isInSector) {
-        stddev = Vector3d(
-            Params.small_radar().rad_stddev(),
-            Params.small_radar().ang_stddev(),
-            Params.small_radar().h_stddev()
-        );
-        if (IsInSector(
-            Params.small_radar().radius(),
-            Params.small_radar().responsible_sector_start(),
-            Params.small_radar().responsible_sector_end()
-        )) {
+    if (smallRadar) {
+        stddev = smallRadar->SmallRadarStddev;
+        if (isInResponsibleSector) {
             WasInResponsibleFlag = true;
         }
     } else {
-        stddev = Vector3d(
-            Params.big_radar().rad_stddev(),
-            Params.big_radar().ang_stddev(),
-            Params.big_radar().h_stddev()
-        );
+        stddev = Runtime.BigRadarStddev;
     }
 
-    double dt = Timer.GetElapsedTimeAsMs();
+    double dt = Timer.GetElapsedTimeAsPreciseMs();
     Timer.Restart();
 
     RealPos += RealSpeed * dt;
@@ -75,7 +72,11 @@ void Target::UpdatePosition(bool isInSector) {
 }
 
 Vector3d Target::GetCurrentRealPosition() const {
-    return RealPos + RealSpeed * Timer.GetElapsedTimeAsMs();
+    return RealPos + RealSpeed * Timer.GetElapsedTimeAsPreciseMs();
+}
+
+Vector3d Target::GetRealSpeed() const {
+    return RealSpeed;
 }
 
 SmallRadarData Target::GetSmallRadarData() const {
@@ -147,37 +148,83 @@ LaunchParams GetRandomLaunchParams(const Proto::Parameters& params, bool isAccur
 }
 
 
-Simulator::Simulator(const Proto::Parameters& params, double radarStartAngle, double shipStartAngle, bool isUsingScenario)
+Simulator::Simulator(
+    const Proto::Parameters& params,
+    double radarStartAngle,
+    double shipStartAngle,
+    bool isUsingScenario,
+    TaskScheduler* scheduler
+)
     : Params(params)
+    , Runtime(CompileParams(params))
+    , Scheduler(scheduler)
     , NewTargetProbability((double) Params.simulator().targets_per_minute() / Params.small_radar().frequency() / 60)
     , IsUsingScenario(isUsingScenario)
-    , SmallRadarAngPosition(radarStartAngle)
     , ShipAngPosition(shipStartAngle)
-{}
+{
+    SmallRadarAngPositions.push_back(radarStartAngle);
+    // extra radars start looking at the middle of their responsible sectors, as RadarCoordinator sets them
+    for (const auto& radar : Params.extra_small_radars()) {
+        SmallRadarAngPositions.push_back((radar.responsible_sector_start() + radar.responsible_sector_end()) / 2);
+    }
+    for (int i = 0; i < SmallRadarAngPositions.size(); ++i) {
+        auto radarParams = Params;
+        *radarParams.mutable_small_radar() = GetSmallRadar(Params, i);
+        RadarsRuntime.push_back(CompileParams(radarParams));
+    }
+    SetShipPosition(shipStartAngle);
+}
 
-bool Simulator::IsTargetInDeadZone(const SIM::Target& target) const {
-    auto deadZones = ShiftedSegmentsFromProto(Params.ship().dead_zones(), ShipAngPosition);
-    for (const auto& seg : deadZones) {
-        if (target.IsInSector(Params.small_radar().radius(), seg.first, seg.second)) {
+bool Simulator::IsTargetInDeadZone(const SIM::Target& target, double radius) const {
+    for (const auto& seg : DeadZones) {
+        if (target.IsInSector(radius, seg.first, seg.second)) {
             return true;
         }
     }
     return false;
 }
 
-bool Simulator::IsTargetInSector(const Target& target) const {
+bool Simulator::IsTargetInSector(const Target& target, int radarIdx) const {
+    const auto& radar = RadarsRuntime[radarIdx];
+    const double radarAngPosition = SmallRadarAngPositions[radarIdx];
     return
         target.IsInSector(
-            Params.small_radar().radius(),
-            SmallRadarAngPosition - Params.small_radar().view_angle() / 2,
-            SmallRadarAngPosition + Params.small_radar().view_angle() / 2
+            radar.SmallRadarRadius,
+            radarAngPosition - radar.SmallRadarHalfViewAngle,
+            radarAngPosition + radar.SmallRadarHalfViewAngle
         )
-        && !IsTargetInDeadZone(target);
+        && !IsTargetInDeadZone(target, radar.SmallRadarRadius);
 }
 
 void Simulator::UpdateTargets() {
-    for (auto* target : Targets) {
-        target->UpdatePosition(IsTargetInSector(*target));
+    SeeingRadars.assign(Targets.size(), nullptr);
+    IsInResponsibleSectors.assign(Targets.size(), false);
+    auto checkSectors = [this](int targetIdx) {
+        const auto& target = *Targets[targetIdx];
+        for (int i = 0; i < SmallRadarAngPositions.size(); ++i) {
+            if (!IsTargetInSector(target, i)) continue;
+
+            const auto& radar = RadarsRuntime[i];
+            if (!SeeingRadars[targetIdx]) {
+                SeeingRadars[targetIdx] = &radar;
+            }
+            IsInResponsibleSectors[targetIdx] = IsInResponsibleSectors[targetIdx] || target.IsInSector(
+                radar.SmallRadarRadius,
+                radar.ResponsibleSectorStart,
+                radar.ResponsibleSectorEnd
+            );
+        }
+    };
+    if (Scheduler && Targets.size() >= MIN_PARALLEL_TARGETS) {
+        Scheduler->ParallelFor(Targets.size(), checkSectors);
+    } else {
+        for (int i = 0; i < Targets.size(); ++i) {
+            checkSectors(i);
+        }
+    }
+    // measurement noise comes from one random generator, so positions are updated serially
+    for (int i = 0; i < Targets.size(); ++i) {
+        Targets[i]->UpdatePosition(SeeingRadars[i], IsInResponsibleSectors[i]);
     }
 
     if (!IsUsingScenario && GetRandomTrue(NewTargetProbability)) {
@@ -186,7 +233,7 @@ void Simulator::UpdateTargets() {
 
     std::vector<int> FlownAwayTargetIds;
     for (const auto* target : Targets) {
-        if (target->IsOutOfView(Params.big_radar().radius())) {
+        if (target->IsOutOfView(Runtime.BigRadarRadius)) {
             if (target->WasInResponsible()){
                 ++ResponsibleTargetsCount;
             }
@@ -196,12 +243,15 @@ void Simulator::UpdateTargets() {
     RemoveTargets(FlownAwayTargetIds, false);
 }
 
-void Simulator::SetRadarPosition(double angPos) {
-    SmallRadarAngPosition = angPos;
+void Simulator::SetRadarPosition(double angPos, int radarIdx) {
+    SmallRadarAngPositions.at(radarIdx) = angPos;
 }
 
 void Simulator::SetShipPosition(double angPos) {
     ShipAngPosition = angPos;
+    // shifted once per ship move, not per checked target
+    DeadZones = Runtime.DeadZones;
+    DeadZones.Shift(ShipAngPosition);
 }
 
 void Simulator::RemoveTargets(std::vector<int> ids, bool isDestroyed) {
@@ -228,32 +278,53 @@ std::vector<BigRadarData> Simulator::GetBigRadarTargets() {
     std::vector<BigRadarData> res;
     for (const auto* target : Targets) {
         res.push_back(target->GetBigRadarData());
+        if (Runtime.IsStrippingIds) {
+            res.back().Id = -1;
+        }
     }
     return res;
 }
 
-std::vector<SmallRadarData> Simulator::GetSmallRadarTargets() {
+std::vector<SmallRadarData> Simulator::GetSmallRadarTargets(int radarIdx) {
     std::vector<SmallRadarData> res;
     for (const auto* target : Targets) {
-        if (IsTargetInSector(*target)) {
+        if (IsTargetInSector(*target, radarIdx)) {
             res.emplace_back(target->GetSmallRadarData());
+            if (Runtime.IsStrippingIds) {
+                res.back().Id = -1;
+            }
         }
     }
     return res;
 }
 
+void Simulator::GetTargetsPositions(
+    std::vector<int>& ids,
+    std::vector<Vector3d>& positions,
+    std::vector<Vector3d>& speeds
+) const {
+    ids.clear();
+    positions.clear();
+    speeds.clear();
+    for (const auto* target : Targets) {
+        ids.push_back(target->GetId());
+        positions.push_back(target->GetCurrentRealPosition());
+        speeds.push_back(target->GetRealSpeed());
+    }
+}
+
 void Simulator::LaunchTarget(LaunchParams launchParams) {
     static int lastId = 0;
 
     double speedAngVertical = launchParams.AngPos - M_PI - launchParams.AngDeviation;
     double speedHorizontal = - launchParams.SpeedAbs * launchParams.HeightPos
-                            / Params.big_radar().radius() * launchParams.HSpeedCoef;
+                            / Runtime.BigRadarRadius * launchParams.HSpeedCoef;
 
     auto* targetPtr = new Target(
-        Params,
+        Runtime,
         lastId,
         launchParams.PresetPriority,
-        CylindricalToCartesian(Params.big_radar().radius(), launchParams.AngPos, launchParams.HeightPos),
+        CylindricalToCartesian(Runtime.BigRadarRadius, launchParams.AngPos, launchParams.HeightPos),
         CylindricalToCartesian(launchParams.SpeedAbs, speedAngVertical, speedHorizontal),
         launchParams.MsFromStart
     );
@@ -296,34 +367,18 @@ TargetScheduler::TargetScheduler(const Proto::Parameters& params)
 {}
 
 void TargetScheduler::SetScenario(const std::string& filename) {
-    const auto scenario = ParseProtoFromFile<Proto::TargetScenario>(filename);
-    RadarStartAngle = DegToRad(scenario.radar_start_angle());
-    ShipStartAngle = DegToRad(scenario.ship_start_angle());
+    auto scenario = ParseProtoFromFile<Proto::TargetScenario>(filename);
+    PrepareScenario(scenario, Params.general().play_speed());
+    SetScenario(scenario);
+}
+
+void TargetScheduler::SetScenario(const Proto::TargetScenario& scenario) {
+    RadarStartAngle = scenario.radar_start_angle();
+    ShipStartAngle = scenario.ship_start_angle();
     if (scenario.has_description()) {
         Description = scenario.description();
     }
-
-    for (const auto& launch : scenario.launches()) {
-        Proto::TargetScenario::Launch correctLaunch(launch);
-        correctLaunch.set_time(correctLaunch.time() * 1000. / Params.general().play_speed());
-        correctLaunch.set_angle_pos(correctLaunch.angle_pos() * M_PI / 180);
-        if (launch.has_angle_deviation()) {
-            correctLaunch.set_angle_deviation(correctLaunch.angle_deviation() * M_PI / 180);
-        }
-        if (launch.has_abs_speed()) {
-            correctLaunch.set_abs_speed(correctLaunch.abs_speed() * Params.general().play_speed() / 1000);
-        }
-
-        TargetLaunches.push_back(correctLaunch);
-    }
-
-    std::sort(
-        TargetLaunches.begin(),
-        TargetLaunches.end(),
-        [](const Proto::TargetScenario::Launch& l, const Proto::TargetScenario::Launch& r) {
-            return l.time() < r.time();
-        }
-    );
+    TargetLaunches.assign(scenario.launches().begin(), scenario.launches().end());
 }
 
 void TargetScheduler::LaunchTargets(Simulator& simulator) {
@@ -5,6 +5,8 @@
 #include "proto/generated/scenario.pb.h"
 #include "radar_control/data.h"
 #include "util/points.h"
+#include "util/runtime_params.h"
+#include "util/task_scheduler.h"
 #include "util/timer.h"
 
 
@@ -13,7 +15,7 @@ namespace SIM {
     class Target {
     public:
         Target(
-            const Proto::Parameters& params,
+            const RuntimeParams& params,
             unsigned int id,
             double presetPriority,
             Vector3d pos,
@@ -21,11 +23,14 @@ namespace SIM {
             double msFromStart = 0
         );
 
-        void UpdatePosition(bool isInSector);
+        // smallRadar - parameters of one of small radars which see target, nullptr if there is no such radar
+        void UpdatePosition(const RuntimeParams* smallRadar, bool isInResponsibleSector);
 
         SmallRadarData GetSmallRadarData() const;
         BigRadarData GetBigRadarData() const;
         unsigned int GetId() const;
+        Vector3d GetCurrentRealPosition() const;
+        Vector3d GetRealSpeed() const;
 
         bool IsInSector(double rad, double sectorStart, double sectorEnd) const;
         bool IsOutOfView(double rad) const;
@@ -35,10 +40,7 @@ namespace SIM {
         bool WasInResponsible() const;
 
     private:
-        Vector3d GetCurrentRealPosition() const;
-
-    private:
-        const Proto::Parameters& Params;
+        const RuntimeParams& Runtime;
 
         int Id;
         double PresetPriority = -1;
@@ -77,16 +79,26 @@ LaunchParams GetRandomLaunchParams(const Proto::Parameters& params, bool isAccur
 
 class Simulator {
 public:
-    Simulator(const Proto::Parameters& params, double radarStartAngle, double shipStartAngle, bool isUsingScenario);
+    // without scheduler targets are updated serially
+    Simulator(
+        const Proto::Parameters& params,
+        double radarStartAngle,
+        double shipStartAngle,
+        bool isUsingScenario,
+        TaskScheduler* scheduler = nullptr
+    );
 
     void UpdateTargets();
-    void SetRadarPosition(double angPos);
+    // radarIdx - index of small radar, 0 is main one, others are extra_small_radars
+    void SetRadarPosition(double angPos, int radarIdx = 0);
     void SetShipPosition(double angPos);
 
     void RemoveTargets(std::vector<int> ids, bool isDestroyed = true);
 
     std::vector<BigRadarData> GetBigRadarTargets();
-    std::vector<SmallRadarData> GetSmallRadarTargets();
+    std::vector<SmallRadarData> GetSmallRadarTargets(int radarIdx = 0);
+    // real positions and speeds of all targets at the moment of call, i-th ones belong to target with id ids[i]
+    void GetTargetsPositions(std::vector<int>& ids, std::vector<Vector3d>& positions, std::vector<Vector3d>& speeds) const;
 
     void LaunchTarget(LaunchParams launchParams);
     void LaunchRandomTarget();
@@ -97,19 +109,27 @@ public:
     ~Simulator();
 
 private:
-    bool IsTargetInSector(const SIM::Target& target) const;
-    bool IsTargetInDeadZone(const SIM::Target& target) const;
+    bool IsTargetInSector(const SIM::Target& target, int radarIdx) const;
+    bool IsTargetInDeadZone(const SIM::Target& target, double radius) const;
 
 private:
     const Proto::Parameters& Params;
+    const RuntimeParams Runtime;
+    std::vector<RuntimeParams> RadarsRuntime; // per small radar, compiled with it as small_radar
 
     std::vector<SIM::Target*> Targets;
+    // per target of UpdateTargets, radar which measures target, nullptr if there is no such radar
+    std::vector<const RuntimeParams*> SeeingRadars;
+    std::vector<char> IsInResponsibleSectors;
+
+    TaskScheduler* Scheduler;
 
     const float NewTargetProbability;
     const bool IsUsingScenario;
 
-    double SmallRadarAngPosition;
+    std::vector<double> SmallRadarAngPositions;
     double ShipAngPosition;
+    AngleSegments DeadZones; // shifted by ship position
 
     int TargetsCount = 0;
     int ResponsibleTargetsCount = 0;
@@ -123,6 +143,8 @@ public:
     TargetScheduler(const Proto::Parameters& params);
 
     void SetScenario(const std::string& filename);
+    // scenario prepared by PrepareScenario
+    void SetScenario(const Proto::TargetScenario& scenario);
 
     void LaunchTargets(Simulator& simulator);
 
@@ -1,13 +1,15 @@
 #include "visualizer.h"
+#include "util/interval_set.h"
 #include "util/points.h"
 #include "util/util.h"
 #include "util/proto.h"
 
 #include <raylib.h>
+#include <rlgl.h>
 #include <Color.hpp>
 #include <Vector2.hpp>
 
-#include <set>
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -80,11 +82,32 @@ namespace {
             col
         );
     }
+
+    void BeginLayerMode(const RenderTexture2D& layer) {
+        BeginTextureMode(layer);
+        ClearBackground(BLANK);
+        // keep alpha of translucent shapes, so layer is blended onto screen the same way as direct drawing
+        rlSetBlendFactorsSeparate(
+            RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD
+        );
+        BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    }
+
+    void EndLayerMode() {
+        EndBlendMode();
+        EndTextureMode();
+    }
+
+    bool IsAngleChanged(double cached, double current) {
+        const double tolerance = 1e-4;
+        return std::isnan(cached) || std::abs(current - cached) > tolerance;
+    }
 }
 
 
 Visualizer::Visualizer(const Proto::Parameters& params)
     : Params(params)
+    , Runtime(CompileParams(params))
     , WindowSize(
         2 * Params.big_radar().radius() + 100,
         Params.big_radar().radius() + 5 + Params.simulator().max_height() + 30
@@ -92,8 +115,25 @@ Visualizer::Visualizer(const Proto::Parameters& params)
     , Window(WindowSize.x, WindowSize.y + 5, "RadarControl")
     , RadarPositionStraight(WindowSize.x / 2, WindowSize.y - Params.simulator().max_height() - 30)
     , RadarPositionSide(WindowSize.x / 2, WindowSize.y)
+    , SpriteSize(std::max(2.f * (Params.visualizer().target_radius() + 5) + 4, 2.f * 7 + 4))
+    , LayersRadarPosAngles(GetSmallRadarsCount(Params), NAN)
+    , LayersShipPosAngle(NAN)
 {
-    SetTargetFPS(Params.small_radar().frequency());
+    SetTargetFPS(Params.visualizer().fps());
+
+    SpritesAtlas = LoadRenderTexture(SpriteSize * SPRITES_COUNT, SpriteSize);
+    RadarsLayer = LoadRenderTexture(Window.GetWidth(), Window.GetHeight());
+    RadarSectorLayer = LoadRenderTexture(Window.GetWidth(), Window.GetHeight());
+    DeadZonesLayer = LoadRenderTexture(Window.GetWidth(), Window.GetHeight());
+
+    PrepareSprites();
+
+    BeginLayerMode(RadarsLayer);
+    {
+        DrawRadars(View::STRAIGHT);
+        DrawRadars(View::SIDE);
+    }
+    EndLayerMode();
 }
 
 bool Visualizer::IsWindowOpen() const {
@@ -102,26 +142,44 @@ bool Visualizer::IsWindowOpen() const {
 
 void Visualizer::DrawFrame(
     const std::vector<BigRadarData>& bigDatas,
-    const std::vector<SmallRadarData>& smallDatas,
-    const std::map<int, double>& priorities,
-    const std::vector<int>& followedTargetIds,
-    const std::vector<Vector3d>& rockets,
-    const std::vector<Vector3d>& entryPoints,
-    const std::vector<Vector3d>& approximateMeetPoints,
-    double radarPosAngle,
-    double shipPosAngle
+    const std::vector<std::vector<SmallRadarData>>& smallDatas,
+    const RadarController::Snapshot& prevControllerSnapshot,
+    const RadarController::Snapshot& controllerSnapshot,
+    double interpolationFactor,
+    const std::vector<Vector3d>& rockets
 ) {
+    auto interpolate = [interpolationFactor](double prev, double curr) {
+        return prev + (curr - prev) * interpolationFactor;
+    };
+    RadarPosAngles.clear();
+    RadarPosAngles.push_back(interpolate(prevControllerSnapshot.Radar.Angle, controllerSnapshot.Radar.Angle));
+    for (int i = 0; i < controllerSnapshot.ExtraRadars.size(); ++i) {
+        const double prevAngle = (
+            i < prevControllerSnapshot.ExtraRadars.size()
+            ? prevControllerSnapshot.ExtraRadars[i].Angle
+            : controllerSnapshot.ExtraRadars[i].Angle
+        );
+        RadarPosAngles.push_back(interpolate(prevAngle, controllerSnapshot.ExtraRadars[i].Angle));
+    }
+    UpdateLayers(
+        RadarPosAngles,
+        interpolate(prevControllerSnapshot.Ship.Angle, controllerSnapshot.Ship.Angle)
+    );
+    PrepareTargets(bigDatas, smallDatas, controllerSnapshot);
+
     BeginDrawing();
     {
         Window.ClearBackground(raylib::Color::RayWhite());
 
+        DrawLayer(DeadZonesLayer);
+        DrawLayer(RadarsLayer);
+        DrawLayer(RadarSectorLayer);
+
         for (auto view : {View::STRAIGHT, View::SIDE}) {
-            DrawDeadZones(shipPosAngle, view);
-            DrawRadars(radarPosAngle, view);
-            DrawTargets(bigDatas, smallDatas, priorities, followedTargetIds, view);
+            DrawTargets(view);
             DrawRockets(rockets, view);
-            DrawEntryPoints(entryPoints, view);
-            DrawApproximateMeetPoints(approximateMeetPoints, view);
+            DrawEntryPoints(controllerSnapshot.EntryPoints, view);
+            DrawApproximateMeetPoints(controllerSnapshot.ApproximateMeetPoints, view);
         }
     }
     EndDrawing();
@@ -140,76 +198,165 @@ raylib::Vector2 Visualizer::ToWindowCoords(const Vector3d& pos, View view) const
     }
 }
 
-void Visualizer::DrawTarget(const SmallRadarData& data, double priority, bool isFollowed, View view) {
-    auto targetPos = ToWindowCoords(data.Pos, view);
-    DrawCircleV(targetPos, Params.visualizer().target_radius(), GetTargetColor(priority));
-    DrawCircleLinesV(targetPos, Params.visualizer().target_radius(), raylib::Color::Black());
-    if (isFollowed) {
-        DrawCircleDashedLines(targetPos, Params.visualizer().target_radius() + 5, raylib::Color::Black());
+void Visualizer::PrepareSprites() {
+    const float radius = Runtime.TargetRadius;
+
+    BeginLayerMode(SpritesAtlas);
+    for (int sprite = 0; sprite < SPRITES_COUNT; ++sprite) {
+        raylib::Vector2 center(SpriteSize * (sprite + 0.5f), SpriteSize * 0.5f);
+        switch (sprite) {
+            case TARGET:
+                // white to be tinted by priority color, outline stays black
+                DrawCircleV(center, radius, raylib::Color::White());
+                DrawCircleLinesV(center, radius, raylib::Color::Black());
+                break;
+            case FOLLOWED_MARK:
+                DrawCircleDashedLines(center, radius + 5, raylib::Color::Black());
+                break;
+            case ROCKET:
+                DrawPoly(center, 3, 7, 0, raylib::Color::Red());
+                break;
+            case MEET_POINT:
+                DrawCross(center, radius * 1.5, raylib::Color::Red());
+                break;
+            case ENTRY_POINT:
+                DrawCircleLinesV(center, radius, raylib::Color::Gray());
+                break;
+        }
+    }
+    EndLayerMode();
+}
+
+void Visualizer::DrawSprite(Sprite sprite, raylib::Vector2 center, raylib::Color tint) {
+    // render texture is flipped vertically, so source height is negative
+    DrawTextureRec(
+        SpritesAtlas.texture,
+        Rectangle{SpriteSize * sprite, 0, SpriteSize, -SpriteSize},
+        center - raylib::Vector2(SpriteSize * 0.5f, SpriteSize * 0.5f),
+        tint
+    );
+}
+
+void Visualizer::UpdateLayers(const std::vector<double>& radarPosAngles, double shipPosAngle) {
+    bool isAnyRadarMoved = false;
+    for (int i = 0; i < radarPosAngles.size() && i < LayersRadarPosAngles.size(); ++i) {
+        isAnyRadarMoved = isAnyRadarMoved || IsAngleChanged(LayersRadarPosAngles[i], radarPosAngles[i]);
+    }
+    if (isAnyRadarMoved) {
+        BeginLayerMode(RadarSectorLayer);
+        for (int i = 0; i < radarPosAngles.size() && i < LayersRadarPosAngles.size(); ++i) {
+            DrawRadarSector(GetSmallRadar(Params, i), radarPosAngles[i]);
+            LayersRadarPosAngles[i] = radarPosAngles[i];
+        }
+        EndLayerMode();
     }
+    if (IsAngleChanged(LayersShipPosAngle, shipPosAngle)) {
+        BeginLayerMode(DeadZonesLayer);
+        DrawDeadZones(shipPosAngle);
+        EndLayerMode();
+        LayersShipPosAngle = shipPosAngle;
+    }
+}
+
+void Visualizer::DrawLayer(const RenderTexture2D& layer) {
+    DrawTextureRec(
+        layer.texture,
+        Rectangle{0, 0, (float) layer.texture.width, (float) -layer.texture.height},
+        raylib::Vector2(0, 0),
+        raylib::Color::White()
+    );
 }
 
-void Visualizer::DrawTargets(
+void Visualizer::PrepareTargets(
     const std::vector<BigRadarData>& bigDatas,
-    const std::vector<SmallRadarData>& smallDatas,
-    const std::map<int, double>& priorities,
-    const std::vector<int>& followedTargetIds,
-    View view
+    const std::vector<std::vector<SmallRadarData>>& smallDatas,
+    const RadarController::Snapshot& controllerSnapshot
 ) {
-    std::set<uint32_t> drawnTargets;
-    std::set<int> followed(followedTargetIds.begin(), followedTargetIds.end());
-    for (const auto& data : smallDatas) {
-        drawnTargets.insert(data.Id);
-        DrawTarget(data, priorities.at(data.Id), followed.count(data.Id), view);
+    int maxId = -1;
+    for (const auto& data : bigDatas) {
+        maxId = std::max(maxId, data.Id);
+    }
+    // small radar may see target, which big radar hasn't reported yet
+    for (const auto& radarDatas : smallDatas) {
+        for (const auto& data : radarDatas) {
+            maxId = std::max(maxId, data.Id);
+        }
+    }
+    for (auto id : controllerSnapshot.Ids) {
+        maxId = std::max(maxId, id);
+    }
+    PriorityById.assign(maxId + 1, -1);
+    IsFollowedById.assign(maxId + 1, false);
+    IsDrawnById.assign(maxId + 1, false);
+
+    for (int i = 0; i < controllerSnapshot.Size(); ++i) {
+        PriorityById[controllerSnapshot.Ids[i]] = controllerSnapshot.Priorities[i];
+        IsFollowedById[controllerSnapshot.Ids[i]] = controllerSnapshot.IsFollowed[i];
+    }
+
+    Targets.clear();
+    auto addTarget = [this](const SmallRadarData& data) {
+        IsDrawnById[data.Id] = true;
+        Targets.push_back(TargetToDraw{
+            .Pos = data.Pos,
+            .Color = GetTargetColor(PriorityById[data.Id]),
+            .IsFollowed = (bool) IsFollowedById[data.Id]
+        });
+    };
+    // target seen by several small radars is drawn once
+    for (const auto& radarDatas : smallDatas) {
+        for (const auto& data : radarDatas) {
+            if (!IsDrawnById[data.Id]) {
+                addTarget(data);
+            }
+        }
     }
     for (const auto& data : bigDatas) {
-        if (!drawnTargets.count(data.Id)) {
-            DrawTarget(data, priorities.at(data.Id), followed.count(data.Id), view);
+        if (!IsDrawnById[data.Id]) {
+            addTarget(data);
         }
     }
 }
 
-void Visualizer::DrawRadars(double radarPosAngle, View view) {
+void Visualizer::DrawTargets(View view) {
+    for (const auto& target : Targets) {
+        auto targetPos = ToWindowCoords(target.Pos, view);
+        DrawSprite(TARGET, targetPos, target.Color);
+        if (target.IsFollowed) {
+            DrawSprite(FOLLOWED_MARK, targetPos);
+        }
+    }
+}
+
+void Visualizer::DrawRadars(View view) {
     switch (view) {
         case STRAIGHT: {
-            DrawDashedRadius(
-                RadarPositionStraight,
-                Params.big_radar().radius(),
-                Params.small_radar().responsible_sector_start(),
-                raylib::Color::Gray()
-            );
-            DrawDashedRadius(
-                RadarPositionStraight,
-                Params.big_radar().radius(),
-                Params.small_radar().responsible_sector_end(),
-                raylib::Color::Gray()
-            );
-            DrawCircleSector(
-                RadarPositionStraight,
-                Params.big_radar().radius(),
-                -Params.small_radar().responsible_sector_start() * 180 / M_PI,
-                -Params.small_radar().responsible_sector_end() * 180 / M_PI,
-                30,
-                raylib::Color(0, 0, 0, 15)
-            );
-\
-            float radarPos = RadToDeg(radarPosAngle);
-            float halfview = RadToDeg(Params.small_radar().view_angle()) / 2;
-            float start = std::max(0.f, radarPos - halfview);
-            float end   = std::min(180.f, radarPos + halfview);
-
-            DrawCircleSectorLines(
-                RadarPositionStraight,
-                Params.small_radar().radius(),
-                -start,
-                -end,
-                30,
-                raylib::Color::Black()
-            );
-
+            for (int i = 0; i < GetSmallRadarsCount(Params); ++i) {
+                const auto& radar = GetSmallRadar(Params, i);
+                DrawDashedRadius(
+                    RadarPositionStraight,
+                    Runtime.BigRadarRadius,
+                    radar.responsible_sector_start(),
+                    raylib::Color::Gray()
+                );
+                DrawDashedRadius(
+                    RadarPositionStraight,
+                    Runtime.BigRadarRadius,
+                    radar.responsible_sector_end(),
+                    raylib::Color::Gray()
+                );
+                DrawCircleSector(
+                    RadarPositionStraight,
+                    Runtime.BigRadarRadius,
+                    -radar.responsible_sector_start() * 180 / M_PI,
+                    -radar.responsible_sector_end() * 180 / M_PI,
+                    30,
+                    raylib::Color(0, 0, 0, 15)
+                );
+            }
             DrawCircleSectorLines(
                 RadarPositionStraight,
-                Params.big_radar().radius(),
+                Runtime.BigRadarRadius,
                 0,
                 -180,
                 50,
@@ -219,8 +366,8 @@ void Visualizer::DrawRadars(double radarPosAngle, View view) {
             break;
         }
         case SIDE: {
-            float width = 2 * Params.big_radar().radius();
-            float height = Params.simulator().max_height();
+            float width = 2 * Runtime.BigRadarRadius;
+            float height = Runtime.MaxHeight;
 
             DrawRectangleLines(
                 RadarPositionSide.x - width/2,
@@ -235,57 +382,68 @@ void Visualizer::DrawRadars(double radarPosAngle, View view) {
     }
 }
 
-void Visualizer::DrawDeadZones(double shipPosAngle, View view) {
-    switch (view) {
-        case STRAIGHT: {
-            auto deadZones = ShiftedSegmentsFromProto(Params.ship().dead_zones(), shipPosAngle);
-
-            for (const auto& seg : deadZones) {
-                float start = std::max(0.f, (float) RadToDeg(seg.first));
-                float end = std::min(180.f, (float) RadToDeg(seg.second));
-                if (std::abs(end - start) > 0.1) {
-                    DrawCircleSector(
-                        RadarPositionStraight,
-                        Params.small_radar().radius(),
-                        -start,
-                        -end,
-                        30,
-                        raylib::Color(0, 0, 0, 35)
-                    );
-                }
-            }
-            break;
+void Visualizer::DrawRadarSector(const Proto::Parameters::SmallRadar& radar, double radarPosAngle) {
+    float radarPos = RadToDeg(radarPosAngle);
+    float halfview = RadToDeg(radar.view_angle()) / 2;
+    float start = std::max(0.f, radarPos - halfview);
+    float end   = std::min(180.f, radarPos + halfview);
+
+    DrawCircleSectorLines(
+        RadarPositionStraight,
+        radar.radius(),
+        -start,
+        -end,
+        30,
+        raylib::Color::Black()
+    );
+}
+
+void Visualizer::DrawDeadZones(double shipPosAngle) {
+    auto deadZones = Runtime.DeadZones;
+    deadZones.Shift(shipPosAngle);
+
+    for (const auto& seg : deadZones) {
+        float start = std::max(0.f, (float) RadToDeg(seg.first));
+        float end = std::min(180.f, (float) RadToDeg(seg.second));
+        if (std::abs(end - start) > 0.1) {
+            DrawCircleSector(
+                RadarPositionStraight,
+                Runtime.SmallRadarRadius,
+                -start,
+                -end,
+                30,
+                raylib::Color(0, 0, 0, 35)
+            );
         }
-        case SIDE:
-            break;
     }
 }
 
 
 void Visualizer::DrawRockets(const std::vector<Vector3d>& rockets, View view) {
     for (const auto& rocketPos : rockets) {
-        DrawPoly(ToWindowCoords(rocketPos, view), 3, 7, 0, raylib::Color::Red());
+        DrawSprite(ROCKET, ToWindowCoords(rocketPos, view));
     }
 }
 
 void Visualizer::DrawEntryPoints(const std::vector<Vector3d>& entryPoints, View view) {
-    if (Params.visualizer().draw_entry_points()) {
+    if (Runtime.IsDrawingEntryPoints) {
         for (const auto& point : entryPoints) {
-            DrawCircleLinesV(
-                ToWindowCoords(point, view),
-                Params.visualizer().target_radius(),
-                raylib::Color::Gray()
-            );
+            if (point == Vector3d::Zero()) continue;
+            DrawSprite(ENTRY_POINT, ToWindowCoords(point, view));
         }
     }
 }
 
 void Visualizer::DrawApproximateMeetPoints(const std::vector<Vector3d>& approximateMeetPoints, View view) {
     for (const auto& point : approximateMeetPoints) {
-        DrawCross(
-            ToWindowCoords(point, view),
-            Params.visualizer().target_radius() * 1.5,
-            raylib::Color::Red()
-        );
+        if (point == Vector3d::Zero()) continue;
+        DrawSprite(MEET_POINT, ToWindowCoords(point, view));
     }
 }
+
+Visualizer::~Visualizer() {
+    UnloadRenderTexture(DeadZonesLayer);
+    UnloadRenderTexture(RadarSectorLayer);
+    UnloadRenderTexture(RadarsLayer);
+    UnloadRenderTexture(SpritesAtlas);
+}
@@ -3,7 +3,9 @@
 
 #include "proto/generated/params.pb.h"
 #include "radar_control/data.h"
+#include "radar_control/radar_controller.h"
 #include "util/points.h"
+#include "util/runtime_params.h"
 
 #include <raylib-cpp.hpp>
 
@@ -19,43 +21,83 @@ public:
 
     bool IsWindowOpen() const;
 
+    // smallDatas[i] - measurements of i-th small radar
     void DrawFrame(
         const std::vector<BigRadarData>& bigDatas,
-        const std::vector<SmallRadarData>& smallDatas,
-        const std::map<int, double>& priorities,
-        const std::vector<int>& followedTargetIds,
-        const std::vector<Vector3d>& rockets,
-        const std::vector<Vector3d>& entryPoints,
-        const std::vector<Vector3d>& approximateMeetPoints,
-        double radarPosAngle,
-        double shipPosAngle
+        const std::vector<std::vector<SmallRadarData>>& smallDatas,
+        const RadarController::Snapshot& prevControllerSnapshot,
+        const RadarController::Snapshot& controllerSnapshot,
+        double interpolationFactor, // radar and ship are drawn between previous and current snapshots
+        const std::vector<Vector3d>& rockets
     );
 
+    ~Visualizer();
+
+private:
+    // all sprites are prerendered into one atlas, so dynamic objects are drawn in one batch
+    enum Sprite {
+        TARGET,
+        FOLLOWED_MARK,
+        ROCKET,
+        MEET_POINT,
+        ENTRY_POINT,
+        SPRITES_COUNT,
+    };
+
+    struct TargetToDraw {
+        Vector3d Pos;
+        raylib::Color Color;
+        bool IsFollowed;
+    };
+
 private:
     raylib::Vector2 ToWindowCoords(const Vector3d& p, View view) const;
 
-    void DrawTarget(const SmallRadarData& data, double priority, bool isFollowed, View view);
-    void DrawTargets(
+    void PrepareSprites();
+    void DrawSprite(Sprite sprite, raylib::Vector2 center, raylib::Color tint = raylib::Color::White());
+
+    void UpdateLayers(const std::vector<double>& radarPosAngles, double shipPosAngle);
+    void DrawLayer(const RenderTexture2D& layer);
+
+    void PrepareTargets(
         const std::vector<BigRadarData>& bigDatas,
-        const std::vector<SmallRadarData>& smallDatas,
-        const std::map<int, double>& priorities,
-        const std::vector<int>& followedTargetIds,
-        View view
+        const std::vector<std::vector<SmallRadarData>>& smallDatas,
+        const RadarController::Snapshot& controllerSnapshot
     );
+    void DrawTargets(View view);
     void DrawRockets(const std::vector<Vector3d>& rockets, View view);
     void DrawEntryPoints(const std::vector<Vector3d>& entryPoints, View view);
     void DrawApproximateMeetPoints(const std::vector<Vector3d>& approximateMeetPoints, View view);
-    void DrawRadars(double radarPosAngle, View view);
-    void DrawDeadZones(double shipPosAngle, View view);
+    void DrawRadars(View view);
+    void DrawRadarSector(const Proto::Parameters::SmallRadar& radar, double radarPosAngle);
+    void DrawDeadZones(double shipPosAngle);
 
 private:
     const Proto::Parameters& Params;
+    const RuntimeParams Runtime;
 
     raylib::Vector2 WindowSize;
     raylib::Window Window;
 
     const raylib::Vector2 RadarPositionStraight;
     const raylib::Vector2 RadarPositionSide;
+
+    const float SpriteSize;
+    RenderTexture2D SpritesAtlas;
+
+    // static geometry, redrawn only when corresponding angle changes
+    RenderTexture2D RadarsLayer;
+    RenderTexture2D RadarSectorLayer;
+    RenderTexture2D DeadZonesLayer;
+    std::vector<double> LayersRadarPosAngles; // per small radar
+    double LayersShipPosAngle;
+    std::vector<double> RadarPosAngles; // reused between frames
+
+    std::vector<TargetToDraw> Targets;
+    // indexed by target id, reused between frames
+    std::vector<double> PriorityById;
+    std::vector<char> IsFollowedById;
+    std::vector<char> IsDrawnById;
 };
 
 
@@ -0,0 +1,104 @@
+#include "proto/generated/params.pb.h"
+#include "radar_control/datagram.h"
+#include "simulator/simulator.h"
+#include "util/proto_cache.h"
+#include "util/tick_scheduler.h"
+#include "util/timer.h"
+
+#include <argparse/argparse.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+
+// Stands in for real sensors: runs simulator without controller and sends its radar data to RadarIngest.
+// Radar stays at scenario start angle, because there is no feedback from controller.
+int main(int argc, char* argv[]) {
+    argparse::ArgumentParser program("RadarEmitter");
+    program.add_argument("--socket")
+           .help("path of receiver socket")
+           .default_value<std::string>("/tmp/radar_control.sock");
+    program.add_argument("-s", "--scenario")
+           .help("name of scenario file, if not specified only random targets are launched")
+           .default_value<std::string>("");
+    program.add_argument("-t", "--targets")
+           .help("count of random targets launched at start")
+           .default_value(0)
+           .scan<'i', int>();
+    program.add_argument("-f", "--frames")
+           .help("count of frames to send, 0 - until scenario ends")
+           .default_value(0)
+           .scan<'i', int>();
+    program.add_argument("--no-pacing")
+           .help("send frames as fast as possible instead of small radar frequency")
+           .flag();
+    program.parse_args(argc, argv);
+
+    auto socket_path = program.get<std::string>("--socket");
+    auto scenario_name = program.get<std::string>("--scenario");
+    auto targets_count = program.get<int>("--targets");
+    auto frames_limit = program.get<int>("--frames");
+    auto is_pacing = !program.get<bool>("--no-pacing");
+
+    std::string scenariod_dir =
+        getenv("RADARCONTROL_SCENARIOS_DIR") ? getenv("RADARCONTROL_SCENARIOS_DIR") : "../scenarios";
+    std::string config_dir = getenv("RADARCONTROL_CONFIG_DIR") ? getenv("RADARCONTROL_CONFIG_DIR") : "../config";
+    std::string cache_dir = getenv("RADARCONTROL_CACHE_DIR") ? getenv("RADARCONTROL_CACHE_DIR") : "../cache";
+    ProtoCache protoCache(cache_dir);
+
+    auto params = protoCache.LoadParams(config_dir + "/default.pbtxt");
+    if (params.simulator().has_random_seed()) {
+        srand(params.simulator().random_seed());
+    } else {
+        srand(time(NULL));
+    }
+
+    TargetScheduler targetScheduler(params);
+    if (!scenario_name.empty()) {
+        targetScheduler.SetScenario(protoCache.LoadScenario(scenariod_dir + "/" + scenario_name + ".pbtxt", params));
+    }
+    Simulator simulator(
+        params,
+        targetScheduler.GetRadarStartAngle(),
+        targetScheduler.GetShipStartAngle(),
+        !scenario_name.empty()
+    );
+    for (int i = 0; i < targets_count; ++i) {
+        simulator.LaunchRandomTarget();
+    }
+
+    DatagramSender sender(socket_path);
+    TickScheduler tickScheduler(1000. / params.small_radar().frequency());
+
+    long long framesCount = 0, datagramsCount = 0, recordsCount = 0;
+    SimpleTimer timer;
+
+    while (frames_limit == 0 || framesCount < frames_limit) {
+        if (!scenario_name.empty() && targetScheduler.IsScenarioEnded() && !simulator.IsThereAnyTargets()) {
+            break;
+        }
+        if (is_pacing && tickScheduler.PollTick() == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        if (!scenario_name.empty()) {
+            targetScheduler.LaunchTargets(simulator);
+        }
+
+        const auto& bigRadarTargets = simulator.GetBigRadarTargets();
+        const auto& smallRadarTargets = simulator.GetSmallRadarTargets();
+        datagramsCount += sender.SendFrame(bigRadarTargets, smallRadarTargets);
+        recordsCount += bigRadarTargets.size() + smallRadarTargets.size();
+        ++framesCount;
+
+        simulator.UpdateTargets();
+    }
+
+    double seconds = timer.GetElapsedTimeAsPreciseMs() / 1000;
+    std::cout << "Sent frames:    " << framesCount << " (" << framesCount / seconds << " per second)\n"
+              << "Sent datagrams: " << datagramsCount << "\n"
+              << "Sent records:   " << recordsCount << " (" << recordsCount / seconds << " per second)" << std::endl;
+
+    return 0;
+}
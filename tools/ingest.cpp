@@ -0,0 +1,86 @@
+#include "proto/generated/params.pb.h"
+#include "radar_control/datagram.h"
+#include "radar_control/radar_controller.h"
+#include "util/proto.h"
+#include "util/timer.h"
+
+#include <argparse/argparse.hpp>
+
+#include <cmath>
+#include <csignal>
+#include <iostream>
+
+
+namespace {
+
+    volatile std::sig_atomic_t IsStopped = 0;
+
+}
+
+
+// Runs controller on radar data received from sensors process (or RadarEmitter) over UNIX domain socket.
+int main(int argc, char* argv[]) {
+    argparse::ArgumentParser program("RadarIngest");
+    program.add_argument("--socket")
+           .help("path of socket to receive datagrams on")
+           .default_value<std::string>("/tmp/radar_control.sock");
+    program.add_argument("-b", "--batch")
+           .help("max count of datagrams received by one call")
+           .default_value(64)
+           .scan<'i', int>();
+    program.parse_args(argc, argv);
+
+    auto socket_path = program.get<std::string>("--socket");
+    auto batch_size = program.get<int>("--batch");
+
+    std::string config_dir = getenv("RADARCONTROL_CONFIG_DIR") ? getenv("RADARCONTROL_CONFIG_DIR") : "../config";
+    auto params = ParseProtoFromFile<Proto::Parameters>(config_dir + "/default.pbtxt");
+    PrepareParams(params);
+
+    std::signal(SIGINT, [](int) { IsStopped = 1; });
+    std::signal(SIGTERM, [](int) { IsStopped = 1; });
+
+    RadarController radarController(params, M_PI_2, 0);
+    DatagramReceiver receiver(socket_path, batch_size);
+    RadarController::Snapshot controllerSnapshot;
+
+    const double periodMs = 1000. / params.small_radar().frequency();
+    long long lastFramesCount = 0, lastRecordsCount = 0, lastProcessCallsCount = 0;
+    double lastProcessMs = 0;
+    SimpleTimer reportTimer;
+
+    while (!IsStopped) {
+        int frames = receiver.ReceiveAndProcess(radarController, 100, periodMs);
+        if (frames > 0) {
+            radarController.AdvancePositions(frames * periodMs);
+            radarController.GetSnapshot(controllerSnapshot);
+        }
+
+        if (reportTimer.GetElapsedTimeAsMs() >= 1000) {
+            const auto& stats = receiver.GetStats();
+            double seconds = reportTimer.GetElapsedTimeAsPreciseMs() / 1000;
+            auto framesCount = stats.FramesCount - lastFramesCount;
+            auto processCallsCount = stats.ProcessCallsCount - lastProcessCallsCount;
+            std::cout << "frames/s: " << framesCount / seconds
+                      << ", records/s: " << (stats.RecordsCount - lastRecordsCount) / seconds
+                      << ", tracks: " << controllerSnapshot.Size()
+                      << ", mean Process ms: "
+                      << (processCallsCount != 0 ? (stats.ProcessMs - lastProcessMs) / processCallsCount : 0)
+                      << std::endl;
+            lastFramesCount = stats.FramesCount;
+            lastRecordsCount = stats.RecordsCount;
+            lastProcessCallsCount = stats.ProcessCallsCount;
+            lastProcessMs = stats.ProcessMs;
+            reportTimer.Restart();
+        }
+    }
+
+    const auto& stats = receiver.GetStats();
+    std::cout << "Received frames:    " << stats.FramesCount << "\n"
+              << "Received datagrams: " << stats.DatagramsCount << " in " << stats.BatchesCount << " batches\n"
+              << "Received records:   " << stats.RecordsCount << "\n"
+              << "Invalid datagrams:  " << stats.InvalidDatagramsCount << "\n"
+              << "Incomplete frames:  " << stats.IncompleteFramesCount << std::endl;
+
+    return 0;
+}
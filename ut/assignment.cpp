@@ -0,0 +1,71 @@
+#include "radar_control/assignment.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+
+namespace {
+
+    double TotalCost(const std::pmr::vector<double>& costs, int colsCount, const std::pmr::vector<int>& cols) {
+        double res = 0;
+        for (int row = 0; row < cols.size(); ++row) {
+            res += costs[row * colsCount + cols[row]];
+        }
+        return res;
+    }
+
+    // tries all assignments of rows to columns
+    double BruteForceMinCost(const std::pmr::vector<double>& costs, int rowsCount, int colsCount) {
+        std::vector<int> perm(colsCount);
+        std::iota(perm.begin(), perm.end(), 0);
+        double res = std::numeric_limits<double>::max();
+        do {
+            double cost = 0;
+            for (int row = 0; row < rowsCount; ++row) {
+                cost += costs[row * colsCount + perm[row]];
+            }
+            res = std::min(res, cost);
+        } while (std::next_permutation(perm.begin(), perm.end()));
+        return res;
+    }
+
+}
+
+
+TEST(SolveAssignment, Square) {
+    std::pmr::vector<double> costs = {
+        4, 1, 3,
+        2, 0, 5,
+        3, 2, 2,
+    };
+    EXPECT_EQ(SolveAssignment(costs, 3, 3), std::pmr::vector<int>({1, 0, 2}));
+}
+
+TEST(SolveAssignment, Rectangular) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-10, 10);
+    for (int iter = 0; iter < 50; ++iter) {
+        const int rowsCount = 1 + iter % 4;
+        const int colsCount = rowsCount + iter % 3;
+        std::pmr::vector<double> costs(rowsCount * colsCount);
+        for (auto& cost : costs) {
+            cost = dist(gen);
+        }
+
+        auto cols = SolveAssignment(costs, rowsCount, colsCount);
+        ASSERT_EQ(cols.size(), rowsCount);
+        auto sorted = cols;
+        std::sort(sorted.begin(), sorted.end());
+        EXPECT_EQ(std::unique(sorted.begin(), sorted.end()), sorted.end());
+        EXPECT_NEAR(TotalCost(costs, colsCount, cols), BruteForceMinCost(costs, rowsCount, colsCount), 1e-9);
+    }
+}
+
+TEST(SolveAssignment, MoreRowsThanColumns) {
+    EXPECT_THROW(SolveAssignment(std::pmr::vector<double>(6), 3, 2), std::invalid_argument);
+}
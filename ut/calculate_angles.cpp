@@ -0,0 +1,25 @@
+#include "util/util.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+
+TEST(CalculateAngles, MatchesAtan2) {
+    std::vector<double> xs, ys;
+    for (int i = 0; i < 3600; ++i) {
+        double angle = i * M_PI / 1800 - M_PI + 1e-3;
+        double radius = 1 + i % 7 * 100;
+        xs.push_back(radius * std::cos(angle));
+        ys.push_back(radius * std::sin(angle));
+    }
+    xs.push_back(0); ys.push_back(0);
+    xs.push_back(0); ys.push_back(5);
+    xs.push_back(-5); ys.push_back(0);
+
+    std::vector<double> angles(xs.size());
+    CalculateAngles(xs.data(), ys.data(), angles.data(), xs.size());
+    for (int i = 0; i < xs.size(); ++i) {
+        EXPECT_NEAR(angles[i], std::atan2(ys[i], xs[i]), 1e-7) << xs[i] << " " << ys[i];
+    }
+}
@@ -0,0 +1,68 @@
+#include "util/interval_set.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+
+using Segments = std::vector<std::pair<double, double>>;
+
+template <size_t N>
+Segments ToVector(const IntervalSet<N>& set) {
+    return Segments(set.begin(), set.end());
+}
+
+
+TEST(IntervalSet, AddKeepsOrder) {
+    IntervalSet<4> set;
+    set.Add(5, 6);
+    set.Add(1, 2);
+    set.Add(3, 2); // empty
+    set.Add(3, 4);
+    EXPECT_EQ(ToVector(set), Segments({{1, 2}, {3, 4}, {5, 6}}));
+    EXPECT_THROW({ set.Add(7, 8); set.Add(9, 10); }, std::length_error);
+}
+
+TEST(IntervalSet, Find) {
+    IntervalSet<4> set;
+    set.Add(1, 2);
+    set.Add(3, 4);
+    EXPECT_EQ(set.Find(0), -1);
+    EXPECT_EQ(set.Find(1), 0);
+    EXPECT_EQ(set.Find(2.5), -1);
+    EXPECT_EQ(set.Find(4), 1);
+    EXPECT_EQ(set.Find(5), -1);
+}
+
+TEST(IntervalSet, Invert) {
+    IntervalSet<4> set;
+    set.Add(10, 20);
+    set.Add(30, 40);
+    set.Invert(100, 1);
+    EXPECT_EQ(ToVector(set), Segments({{-90, 9}, {21, 29}, {41, 140}}));
+
+    IntervalSet<4> close;
+    close.Add(10, 20);
+    close.Add(21, 40);
+    close.Invert(100, 1);
+    EXPECT_EQ(ToVector(close), Segments({{-90, 9}, {41, 140}}));
+
+    IntervalSet<4> empty;
+    empty.Invert(100, 1);
+    EXPECT_EQ(ToVector(empty), Segments({{-50, 50}}));
+}
+
+TEST(IntervalSet, ShiftReflectIntersect) {
+    IntervalSet<4> a;
+    a.Add(0, 10);
+    a.Add(20, 30);
+    a.Shift(5);
+    EXPECT_EQ(ToVector(a), Segments({{5, 15}, {25, 35}}));
+
+    IntervalSet<4> b = a;
+    b.Reflect(40);
+    EXPECT_EQ(ToVector(b), Segments({{5, 15}, {25, 35}}));
+    b.Shift(3);
+    a.Intersect(b);
+    EXPECT_EQ(ToVector(a), Segments({{8, 15}, {28, 35}}));
+}
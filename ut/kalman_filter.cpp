@@ -0,0 +1,55 @@
+#include "radar_control/kalman_filter.h"
+
+#include <gtest/gtest.h>
+
+
+const double DT = 10;
+
+
+TEST(KalmanFilter, ConstantSpeed) {
+    const Vector3d speed(0.01, -0.02, 0.005);
+    KalmanFilter filter(0.3, 1e-6);
+    filter.Reset(Vector3d::Zero(), Vector3d::Zero(), 0.1);
+    for (int i = 1; i <= 200; ++i) {
+        filter.Update(speed * (DT * i), DT);
+    }
+    EXPECT_NEAR(filter.GetSpeed().X, speed.X, 1e-6);
+    EXPECT_NEAR(filter.GetSpeed().Y, speed.Y, 1e-6);
+    EXPECT_NEAR(filter.GetSpeed().Z, speed.Z, 1e-6);
+    EXPECT_NEAR(filter.GetPosition().X, speed.X * DT * 200, 1e-3);
+}
+
+TEST(KalmanFilter, SteadyState) {
+    KalmanFilter filter(0.3, 1e-6);
+    filter.Reset(Vector3d::Zero(), Vector3d::Zero(), 0.1);
+    for (int i = 1; i <= 1000 && !filter.IsSteadyState(); ++i) {
+        filter.Update(Vector3d::Zero(), DT);
+    }
+    ASSERT_TRUE(filter.IsSteadyState());
+
+    auto covariance = filter.GetCovariance();
+    filter.Update(Vector3d::Zero(), DT);
+    EXPECT_DOUBLE_EQ(filter.GetCovariance().SpeedSpeed, covariance.SpeedSpeed);
+
+    // measurement period jitter keeps steady state
+    filter.Update(Vector3d::Zero(), 1.02 * DT);
+    EXPECT_TRUE(filter.IsSteadyState());
+    EXPECT_DOUBLE_EQ(filter.GetCovariance().SpeedSpeed, covariance.SpeedSpeed);
+
+    filter.Update(Vector3d::Zero(), 2 * DT);
+    EXPECT_FALSE(filter.IsSteadyState());
+}
+
+TEST(KalmanFilter, UpdatesCountToSpeedStddev) {
+    KalmanFilter filter(0.3, 1e-6);
+    filter.Reset(Vector3d::Zero(), Vector3d::Zero(), 0.1);
+    const double stddev = 1e-3;
+    int count = filter.GetUpdatesCountToSpeedStddev(stddev, DT, 1000);
+    ASSERT_LT(count, 1000);
+    for (int i = 1; i < count; ++i) {
+        filter.Update(Vector3d::Zero(), DT);
+    }
+    EXPECT_GT(filter.GetSpeedStddev(), stddev);
+    filter.Update(Vector3d::Zero(), DT);
+    EXPECT_LE(filter.GetSpeedStddev(), stddev);
+}
@@ -0,0 +1,150 @@
+#include "util/proto_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <iterator>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace {
+
+    const char* SCENARIO = R"(
+        radar_start_angle: 45
+        launches { time: 2 angle_pos: 90 abs_speed: 500 }
+        launches { time: 1 angle_pos: 180 }
+    )";
+
+    const char* PARAMS = R"(
+        small_radar {
+            radius: 400 view_angle: 60 frequency: 20 max_eps: 1 max_angle_speed: 5
+            rad_stddev: 0 ang_stddev: 0 h_stddev: 0 responsible_sector_start: 45 responsible_sector_end: 135
+        }
+        big_radar { radius: 700 frequency: 0.5 rad_stddev: 0 ang_stddev: 0 h_stddev: 0 }
+        ship { max_eps: 0.2 max_angle_speed: 2 }
+        general { margin_angle: 90 play_speed: 2 }
+        defense { rocket_speed: 500 }
+        simulator { max_height: 250 }
+        visualizer { }
+    )";
+
+    class ProtoCacheTest : public testing::Test {
+    protected:
+        void SetUp() override {
+            Dir = std::filesystem::temp_directory_path()
+                / ("proto_cache_ut_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+            std::filesystem::create_directories(Dir);
+            ScenarioPath = (Dir / "scenario.pbtxt").string();
+            CacheDir = (Dir / "cache").string();
+            Params.mutable_general()->set_play_speed(2);
+        }
+
+        void TearDown() override {
+            std::filesystem::remove_all(Dir);
+        }
+
+        void WriteScenario(const std::string& text) {
+            std::ofstream(ScenarioPath) << text;
+        }
+
+        std::filesystem::path Dir;
+        std::string ScenarioPath;
+        std::string CacheDir;
+        Proto::Parameters Params;
+    };
+
+}
+
+
+TEST_F(ProtoCacheTest, LoadsPreparedScenario) {
+    WriteScenario(SCENARIO);
+    ProtoCache cache(CacheDir);
+
+    const auto parsed = cache.LoadScenario(ScenarioPath, Params);
+    const auto cached = cache.LoadScenario(ScenarioPath, Params);
+    EXPECT_EQ(cache.GetMissesCount(), 1);
+    EXPECT_EQ(cache.GetHitsCount(), 1);
+    EXPECT_EQ(parsed.SerializeAsString(), cached.SerializeAsString());
+
+    // converted and sorted by time
+    EXPECT_NEAR(cached.radar_start_angle(), M_PI / 4, 1e-12);
+    ASSERT_EQ(cached.launches_size(), 2);
+    EXPECT_NEAR(cached.launches(0).time(), 500, 1e-9);
+    EXPECT_NEAR(cached.launches(0).angle_pos(), M_PI, 1e-12);
+    EXPECT_NEAR(cached.launches(1).time(), 1000, 1e-9);
+    EXPECT_NEAR(cached.launches(1).abs_speed(), 1, 1e-12);
+}
+
+TEST_F(ProtoCacheTest, LoadsPreparedParams) {
+    const auto paramsPath = (Dir / "params.pbtxt").string();
+    std::ofstream(paramsPath) << PARAMS;
+    ProtoCache cache(CacheDir);
+
+    const auto parsed = cache.LoadParams(paramsPath);
+    const auto cached = cache.LoadParams(paramsPath);
+    EXPECT_EQ(cache.GetMissesCount(), 1);
+    EXPECT_EQ(cache.GetHitsCount(), 1);
+    EXPECT_EQ(parsed.SerializeAsString(), cached.SerializeAsString());
+
+    // converted to radians and per ms, scaled by play speed
+    EXPECT_NEAR(cached.general().margin_angle(), M_PI / 2, 1e-12);
+    EXPECT_NEAR(cached.defense().rocket_speed(), 1, 1e-12);
+}
+
+TEST_F(ProtoCacheTest, InvalidatesChangedInputs) {
+    WriteScenario(SCENARIO);
+    ProtoCache(CacheDir).LoadScenario(ScenarioPath, Params);
+
+    ProtoCache cache(CacheDir);
+    cache.LoadScenario(ScenarioPath, Params);
+    EXPECT_EQ(cache.GetHitsCount(), 1);
+
+    // other play speed changes conversion
+    Params.mutable_general()->set_play_speed(4);
+    EXPECT_NEAR(cache.LoadScenario(ScenarioPath, Params).launches(0).time(), 250, 1e-9);
+    EXPECT_EQ(cache.GetMissesCount(), 1);
+
+    WriteScenario(std::string(SCENARIO) + "launches { time: 0 angle_pos: 0 }");
+    EXPECT_EQ(cache.LoadScenario(ScenarioPath, Params).launches_size(), 3);
+    EXPECT_EQ(cache.GetMissesCount(), 2);
+
+    // disabled cache always parses
+    ProtoCache disabled("");
+    disabled.LoadScenario(ScenarioPath, Params);
+    disabled.LoadScenario(ScenarioPath, Params);
+    EXPECT_EQ(disabled.GetHitsCount(), 0);
+    EXPECT_THROW(disabled.LoadScenario((Dir / "missing.pbtxt").string(), Params), std::runtime_error);
+}
+
+TEST_F(ProtoCacheTest, ParsesBrokenEntry) {
+    WriteScenario(SCENARIO);
+    const auto parsed = ProtoCache(CacheDir).LoadScenario(ScenarioPath, Params);
+    ASSERT_EQ(std::distance(std::filesystem::directory_iterator(CacheDir), {}), 1);
+    const auto entryPath = std::filesystem::directory_iterator(CacheDir)->path();
+    const auto entrySize = std::filesystem::file_size(entryPath);
+
+    auto expectParsed = [&]() {
+        ProtoCache cache(CacheDir);
+        EXPECT_EQ(cache.LoadScenario(ScenarioPath, Params).SerializeAsString(), parsed.SerializeAsString());
+        EXPECT_EQ(cache.GetMissesCount(), 1);
+    };
+
+    std::filesystem::resize_file(entryPath, entrySize - 1);
+    expectParsed();
+
+    // rewritten entry is read again
+    ProtoCache cache(CacheDir);
+    cache.LoadScenario(ScenarioPath, Params);
+    EXPECT_EQ(cache.GetHitsCount(), 1);
+
+    {
+        std::fstream entry(entryPath, std::ios::binary | std::ios::in | std::ios::out);
+        entry.seekp(entrySize - 1);
+        entry.put('\xff');
+    }
+    expectParsed();
+}
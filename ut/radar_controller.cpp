@@ -0,0 +1,161 @@
+#include "radar_control/calculations.h"
+#include "radar_control/radar_controller.h"
+#include "util/proto.h"
+
+#include <gtest/gtest.h>
+
+#include <google/protobuf/text_format.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    const char* PARAMS = R"(
+        small_radar {
+            radius: 400 view_angle: 60 frequency: 20 max_eps: 1 max_angle_speed: 5
+            rad_stddev: 0 ang_stddev: 0 h_stddev: 0 responsible_sector_start: 45 responsible_sector_end: 135
+        }
+        big_radar { radius: 700 frequency: 0.5 rad_stddev: 0 ang_stddev: 0 h_stddev: 0 }
+        ship { max_eps: 0.2 max_angle_speed: 2 }
+        general { big_radar_measure_cnt: 1 margin_angle: 3 }
+        defense { }
+        simulator { max_height: 250 }
+        visualizer { }
+    )";
+
+    // not prepared, so tests may change parameters in config units
+    Proto::Parameters MakeParams() {
+        Proto::Parameters params;
+        EXPECT_TRUE(google::protobuf::TextFormat::ParseFromString(PARAMS, &params));
+        return params;
+    }
+
+    BigRadarData MakeBig(Vector3d pos, Vector3d speed) {
+        return BigRadarData{SmallRadarData{.Id = 1, .Pos = pos}, .Speed = speed};
+    }
+
+    // frames are 10 ms apart, the last one is fresh
+    void SetAges(std::vector<RadarController::Frame>& frames) {
+        for (int i = 0; i < frames.size(); ++i) {
+            frames[i].AgeMs = (frames.size() - 1 - i) * 10.;
+        }
+    }
+
+}
+
+
+TEST(RadarController, LaunchesAtKalmanSpeed) {
+    auto params = MakeParams();
+    params.mutable_general()->set_track_filter(Proto::Parameters::General::KALMAN);
+    params.mutable_general()->set_kalman_measurement_stddev(0.01);
+    params.mutable_general()->set_small_radar_measure_cnt(20);
+    params.mutable_general()->set_aprox_small_radar_measure_cnt(50);
+    PrepareParams(params);
+
+    // speed of big radar is wrong, track is measured by small radar until its speed is precise
+    const Vector3d startPos(0, 200, 10);
+    const Vector3d speed(0.002, 0, 0);
+    const Vector3d bigRadarSpeed(0, 0.002, 0);
+    std::vector<RadarController::Frame> frames(21);
+    frames[0].BigDatas = {MakeBig(startPos, bigRadarSpeed)};
+    for (int i = 1; i < frames.size(); ++i) {
+        frames[i].SmallDatas = {SmallRadarData{.Id = 1, .Pos = startPos + speed * (10. * i)}};
+    }
+    SetAges(frames);
+
+    RadarController controller(params, M_PI_2, 0);
+    controller.ProcessFrames(frames);
+    RadarController::Snapshot snapshot;
+    controller.GetSnapshot(snapshot);
+    ASSERT_EQ(snapshot.MeetPointsAndTargetIds.size(), 1);
+    ASSERT_EQ(snapshot.Size(), 1);
+
+    auto meetPoint = [&](Vector3d targetSpeed) {
+        return CalculateMeetPoint(
+            snapshot.Positions[0] + targetSpeed * params.defense().time_to_launch_rocket(),
+            targetSpeed,
+            params.defense().rocket_speed()
+        );
+    };
+    const auto launchPoint = snapshot.MeetPointsAndTargetIds[0].first;
+    EXPECT_LT(Distance(launchPoint, meetPoint(speed)), 0.5);
+    EXPECT_GT(Distance(launchPoint, meetPoint(bigRadarSpeed)), 5);
+}
+
+TEST(RadarController, KeepsSmallRadarMeasurementsOnResentBigRadarData) {
+    auto params = MakeParams();
+    PrepareParams(params);
+    const Vector3d bigPos(0, 200, 10);
+    const Vector3d speed(0.05, 0, 0);
+
+    // radar leaves track after three small radar measurements, big radar keeps resending its measurement
+    std::vector<RadarController::Frame> frames(6);
+    frames[0].BigDatas = {MakeBig(bigPos, speed)};
+    for (int i = 1; i <= 3; ++i) {
+        frames[i].BigDatas = {MakeBig(bigPos, speed)};
+        frames[i].SmallDatas = {SmallRadarData{.Id = 1, .Pos = bigPos + speed * (10. * i)}};
+    }
+    frames[4].BigDatas = frames[5].BigDatas = {MakeBig(bigPos, speed)};
+    SetAges(frames);
+
+    RadarController controller(params, M_PI_2, 0);
+    controller.ProcessFrames(frames);
+    RadarController::Snapshot snapshot;
+    controller.GetSnapshot(snapshot);
+    EXPECT_EQ(controller.GetLastProcessStats().TotalCoalescedMeasurementsCount, 0);
+    ASSERT_EQ(snapshot.Size(), 1);
+    EXPECT_NE(snapshot.Positions[0], bigPos);
+
+    // new big radar measurement supersedes earlier small radar ones
+    const Vector3d newBigPos = bigPos + speed * 50.;
+    frames[5].BigDatas = {MakeBig(newBigPos, speed)};
+    RadarController supersededController(params, M_PI_2, 0);
+    supersededController.ProcessFrames(frames);
+    supersededController.GetSnapshot(snapshot);
+    EXPECT_EQ(supersededController.GetLastProcessStats().TotalCoalescedMeasurementsCount, 3);
+    ASSERT_EQ(snapshot.Size(), 1);
+    EXPECT_EQ(snapshot.Positions[0], newBigPos);
+}
+
+TEST(RadarController, ReassignsRejectedLaunch) {
+    auto params = MakeParams();
+    params.mutable_general()->set_track_filter(Proto::Parameters::General::KALMAN);
+    params.mutable_general()->set_kalman_measurement_stddev(0.01);
+    params.mutable_general()->set_small_radar_measure_cnt(20);
+    params.mutable_defense()->set_launchers_count(1);
+    params.mutable_defense()->set_magazine_size(1);
+    params.mutable_defense()->set_reload_time(0);
+    PrepareParams(params);
+
+    const Vector3d startPos(0, 200, 10);
+    const Vector3d speed(0.002, 0, 0);
+    auto makeFrames = [&](int first, int count) {
+        std::vector<RadarController::Frame> frames(count);
+        for (int i = 0; i < count; ++i) {
+            frames[i].SmallDatas = {SmallRadarData{.Id = 1, .Pos = startPos + speed * (10. * (first + i))}};
+        }
+        if (first == 0) {
+            frames[0].BigDatas = {MakeBig(startPos, speed)};
+        }
+        SetAges(frames);
+        return frames;
+    };
+
+    RadarController controller(params, M_PI_2, 0);
+    controller.ProcessFrames(makeFrames(0, 21));
+    RadarController::Snapshot snapshot;
+    controller.GetSnapshot(snapshot);
+    ASSERT_EQ(snapshot.MeetPointsAndTargetIds.size(), 1);
+    EXPECT_EQ(snapshot.LauncherIds, std::vector<int>({0}));
+
+    // the only rocket wasn't launched, so it is spent on the same target again
+    controller.RejectLaunches({{1, 0}});
+    controller.ProcessFrames(makeFrames(21, 1));
+    controller.GetSnapshot(snapshot);
+    ASSERT_EQ(snapshot.MeetPointsAndTargetIds.size(), 1);
+    EXPECT_EQ(snapshot.MeetPointsAndTargetIds[0].second, 1);
+    EXPECT_EQ(snapshot.LauncherIds, std::vector<int>({0}));
+}
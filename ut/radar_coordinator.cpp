@@ -0,0 +1,101 @@
+#include "radar_control/radar_coordinator.h"
+#include "util/proto.h"
+#include "util/util.h"
+
+#include <gtest/gtest.h>
+
+#include <google/protobuf/text_format.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+    // main radar is responsible for angles 45-90, extra one for 90-135
+    const char* PARAMS = R"(
+        small_radar {
+            radius: 400 view_angle: 60 frequency: 20 max_eps: 1 max_angle_speed: 5
+            rad_stddev: 0 ang_stddev: 0 h_stddev: 0 responsible_sector_start: 45 responsible_sector_end: 90
+        }
+        extra_small_radars {
+            radius: 400 view_angle: 60 frequency: 20 max_eps: 1 max_angle_speed: 5
+            rad_stddev: 0 ang_stddev: 0 h_stddev: 0 responsible_sector_start: 90 responsible_sector_end: 135
+        }
+        big_radar { radius: 700 frequency: 0.5 rad_stddev: 0 ang_stddev: 0 h_stddev: 0 }
+        ship { max_eps: 0.2 max_angle_speed: 2 }
+        general { death_time: 50 big_radar_measure_cnt: 1 margin_angle: 3 }
+        defense { }
+        simulator { max_height: 250 }
+        visualizer { }
+    )";
+
+    Proto::Parameters MakeParams() {
+        Proto::Parameters params;
+        EXPECT_TRUE(google::protobuf::TextFormat::ParseFromString(PARAMS, &params));
+        PrepareParams(params);
+        return params;
+    }
+
+    Vector3d MakePos(double angleDeg) {
+        return CylindricalToCartesian(200, angleDeg * M_PI / 180, 10);
+    }
+
+    BigRadarData MakeBig(int id, double angleDeg) {
+        return BigRadarData{SmallRadarData{.Id = id, .Pos = MakePos(angleDeg)}, .Speed = Vector3d::Zero()};
+    }
+
+    // ids of main controller go first in snapshot
+    std::vector<int> GetIds(RadarCoordinator& coordinator) {
+        RadarController::Snapshot snapshot;
+        coordinator.GetSnapshot(snapshot);
+        return snapshot.Ids;
+    }
+
+}
+
+
+TEST(RadarCoordinator, KeepsTrackOwnerUntilTrackIsLost) {
+    const auto params = MakeParams();
+    RadarCoordinator coordinator(params, M_PI_2, M_PI_2);
+    const std::vector<std::vector<SmallRadarData>> noSmallDatas(2);
+
+    // owner is chosen by responsible sector
+    coordinator.Process({MakeBig(1, 60), MakeBig(2, 120)}, noSmallDatas);
+    EXPECT_EQ(GetIds(coordinator), std::vector<int>({1, 2}));
+
+    // track moved to other sector keeps its owner
+    coordinator.Process({MakeBig(1, 120), MakeBig(2, 60)}, noSmallDatas);
+    EXPECT_EQ(GetIds(coordinator), std::vector<int>({1, 2}));
+
+    // lost track gets new owner, when it appears again
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    coordinator.Process({}, noSmallDatas);
+    EXPECT_TRUE(GetIds(coordinator).empty());
+    coordinator.Process({MakeBig(1, 120), MakeBig(2, 60)}, noSmallDatas);
+    EXPECT_EQ(GetIds(coordinator), std::vector<int>({2, 1}));
+}
+
+TEST(RadarCoordinator, PrefersMeasurementOfOwnerRadar) {
+    const auto params = MakeParams();
+    RadarCoordinator coordinator(params, M_PI_2, M_PI_2);
+    coordinator.Process({MakeBig(1, 85)}, std::vector<std::vector<SmallRadarData>>(2));
+
+    // both radars see track of main controller
+    const auto ownerPos = MakePos(84);
+    const auto otherPos = MakePos(86);
+    coordinator.Process({}, {{SmallRadarData{.Id = 1, .Pos = ownerPos}}, {SmallRadarData{.Id = 1, .Pos = otherPos}}});
+    RadarController::Snapshot snapshot;
+    coordinator.GetSnapshot(snapshot);
+    ASSERT_EQ(snapshot.Size(), 1);
+    EXPECT_LT(Distance(snapshot.Positions[0], ownerPos), Distance(snapshot.Positions[0], otherPos));
+
+    // measurement of other radar is used, if owner's radar doesn't see track
+    const auto lastPos = snapshot.Positions[0];
+    coordinator.Process({}, {{}, {SmallRadarData{.Id = 1, .Pos = otherPos}}});
+    coordinator.GetSnapshot(snapshot);
+    ASSERT_EQ(snapshot.Size(), 1);
+    EXPECT_LT(Distance(snapshot.Positions[0], otherPos), Distance(lastPos, otherPos));
+}
@@ -0,0 +1,181 @@
+#include "radar_control/radar_planner.h"
+#include "util/proto.h"
+#include "util/runtime_params.h"
+
+#include <gtest/gtest.h>
+
+#include <google/protobuf/text_format.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <memory_resource>
+#include <vector>
+
+
+namespace {
+
+    // view window is 50 degrees wide without margins, radar turns fast, so slews are short
+    const char* PARAMS = R"(
+        small_radar {
+            radius: 400 view_angle: 60 frequency: 20 max_eps: 10000 max_angle_speed: 360
+            rad_stddev: 0 ang_stddev: 0 h_stddev: 0 responsible_sector_start: 0 responsible_sector_end: 180
+        }
+        big_radar { radius: 700 frequency: 0.5 rad_stddev: 0 ang_stddev: 0 h_stddev: 0 }
+        ship { max_eps: 0.2 max_angle_speed: 2 }
+        general { margin_angle: 5 planner_horizon: 10000 planner_max_depth: 1 }
+        defense { }
+        simulator { max_height: 250 }
+        visualizer { }
+    )";
+
+    const double NO_DEADLINE = 1e9;
+    const RadarPos RADAR_POS{.Angle = M_PI_2, .Speed = 0};
+    const RadarPos SHIP_POS{.Angle = M_PI_2, .Speed = 0};
+
+    // not prepared, so tests may change parameters in config units
+    Proto::Parameters MakeParams() {
+        Proto::Parameters params;
+        EXPECT_TRUE(google::protobuf::TextFormat::ParseFromString(PARAMS, &params));
+        return params;
+    }
+
+    RadarPlanner::Track MakeTrack(int id, double angleDeg, double weight) {
+        const double angle = angleDeg * M_PI / 180;
+        return RadarPlanner::Track{
+            .Id = id,
+            .MinAngle = angle,
+            .MaxAngle = angle,
+            .Weight = weight,
+            .ReadyTime = 0,
+            .MeasureTime = 100,
+            .Deadline = NO_DEADLINE,
+            .IsPinned = false
+        };
+    }
+
+    // ship isn't controlled and has no dead zones, so every window is feasible for it
+    class PlannerRunner {
+    public:
+        PlannerRunner(const Proto::Parameters& params, TaskScheduler* scheduler = nullptr)
+            : Params(params)
+            , Runtime(CompileParams(Params))
+            , RotationTimes(Runtime)
+            , Planner(Params, scheduler)
+        {}
+
+        std::vector<int> Plan(const std::vector<RadarPlanner::Track>& tracks) {
+            RotationTimes.Reset(RADAR_POS, RadarTargetPos{.Angle = RADAR_POS.Angle, .Speed = 0});
+            const std::pmr::vector<RadarPlanner::Track> pmrTracks(tracks.begin(), tracks.end());
+            const auto res = Planner.Plan(
+                pmrTracks, RADAR_POS, RotationTimes, SHIP_POS, -1, false, std::pmr::get_default_resource()
+            );
+            return std::vector<int>(res.begin(), res.end());
+        }
+
+        const RadarPlanner& GetPlanner() const { return Planner; }
+
+    private:
+        const Proto::Parameters Params;
+        const RuntimeParams Runtime;
+        RotationTimeCache RotationTimes;
+        RadarPlanner Planner;
+    };
+
+}
+
+
+TEST(RadarPlanner, BuildsWindowsOfViewWidth) {
+    auto params = MakeParams();
+    PrepareParams(params);
+    PlannerRunner runner(params);
+
+    // the first two tracks fit in one window, the third one is too far
+    std::vector<RadarPlanner::Track> tracks = {MakeTrack(1, 90, 1), MakeTrack(2, 130, 1), MakeTrack(3, 150, 1)};
+    EXPECT_EQ(runner.Plan(tracks), std::vector<int>({0, 1}));
+
+    tracks[2].Weight = 3;
+    EXPECT_EQ(runner.Plan(tracks), std::vector<int>({1, 2}));
+
+    // track wider than window is never served
+    tracks = {MakeTrack(1, 90, 5), MakeTrack(2, 150, 1)};
+    tracks[0].MaxAngle = tracks[0].MinAngle + M_PI / 2;
+    EXPECT_EQ(runner.Plan(tracks), std::vector<int>({1}));
+}
+
+TEST(RadarPlanner, ServesOnlyTracksMeasuredInTime) {
+    auto params = MakeParams();
+    PrepareParams(params);
+    PlannerRunner runner(params);
+
+    // heavy track can't be measured before its deadline
+    std::vector<RadarPlanner::Track> tracks = {MakeTrack(1, 90, 5), MakeTrack(2, 150, 1)};
+    tracks[0].Deadline = 50;
+    EXPECT_EQ(runner.Plan(tracks), std::vector<int>({1}));
+
+    // heavy track becomes ready after planning horizon
+    tracks[0].Deadline = NO_DEADLINE;
+    tracks[0].ReadyTime = 20000;
+    EXPECT_EQ(runner.Plan(tracks), std::vector<int>({1}));
+
+    tracks[0].ReadyTime = 5000;
+    EXPECT_EQ(runner.Plan(tracks), std::vector<int>({0}));
+
+    // nothing may be served
+    tracks[1].Deadline = 50;
+    tracks[0].ReadyTime = 20000;
+    EXPECT_TRUE(runner.Plan(tracks).empty());
+}
+
+TEST(RadarPlanner, KeepsPinnedTracksInView) {
+    auto params = MakeParams();
+    PrepareParams(params);
+    PlannerRunner runner(params);
+
+    // rocket is guided to track, which doesn't need measurements anymore
+    std::vector<RadarPlanner::Track> tracks = {MakeTrack(1, 90, 1), MakeTrack(2, 100, 1), MakeTrack(3, 150, 0)};
+    tracks[2].IsPinned = true;
+    EXPECT_EQ(runner.Plan(tracks), std::vector<int>({2}));
+}
+
+TEST(RadarPlanner, ReusesPreviousPlan) {
+    auto params = MakeParams();
+    params.mutable_general()->set_planner_max_depth(3);
+    PrepareParams(params);
+    PlannerRunner runner(params);
+
+    // plan serves all tracks in some order, which must be kept on the next tick
+    const std::vector<RadarPlanner::Track> tracks = {
+        MakeTrack(1, 20, 1), MakeTrack(2, 90, 1), MakeTrack(3, 160, 1)
+    };
+    const auto first = runner.Plan(tracks);
+    ASSERT_EQ(first.size(), 1);
+    EXPECT_EQ(runner.GetPlanner().GetReusedPlansCount(), 0);
+
+    EXPECT_EQ(runner.Plan(tracks), first);
+    EXPECT_EQ(runner.GetPlanner().GetPlansCount(), 2);
+    EXPECT_EQ(runner.GetPlanner().GetReusedPlansCount(), 1);
+}
+
+TEST(RadarPlanner, SchedulerDoesNotChangePlans) {
+    auto params = MakeParams();
+    params.mutable_general()->set_planner_max_depth(3);
+    PrepareParams(params);
+    TaskScheduler scheduler(3);
+    PlannerRunner serial(params);
+    PlannerRunner parallel(params, &scheduler);
+
+    std::srand(5);
+    for (int tick = 0; tick < 20; ++tick) {
+        std::vector<RadarPlanner::Track> tracks;
+        for (int i = 0; i < 30; ++i) {
+            auto track = MakeTrack(tick * 100 + i, std::rand() % 180, std::rand() % 3);
+            track.ReadyTime = std::rand() % 3000;
+            track.MeasureTime = 100 + std::rand() % 2000;
+            track.Deadline = 1000 + std::rand() % 10000;
+            track.IsPinned = std::rand() % 20 == 0;
+            tracks.push_back(track);
+        }
+        EXPECT_EQ(serial.Plan(tracks), parallel.Plan(tracks));
+    }
+    EXPECT_EQ(serial.GetPlanner().GetReusedPlansCount(), parallel.GetPlanner().GetReusedPlansCount());
+}
@@ -0,0 +1,48 @@
+#include "radar_control/calculations.h"
+
+#include <gtest/gtest.h>
+
+
+const double WIDTH = 50;
+
+
+TEST(SelectAngleWindow, Empty) {
+    EXPECT_TRUE(SelectAngleWindow({}, WIDTH, 0).empty());
+}
+
+TEST(SelectAngleWindow, MaxWeight) {
+    std::pmr::vector<AngleWindowCandidate> candidates = {
+        {.MinAngle = 0, .MaxAngle = 10, .Weight = 1},
+        {.MinAngle = 20, .MaxAngle = 30, .Weight = 1},
+        {.MinAngle = 60, .MaxAngle = 70, .Weight = 3},
+        {.MinAngle = 90, .MaxAngle = 100, .Weight = 2},
+    };
+    EXPECT_EQ(SelectAngleWindow(candidates, WIDTH, 0), std::pmr::vector<int>({2, 3}));
+}
+
+TEST(SelectAngleWindow, MaxCount) {
+    std::pmr::vector<AngleWindowCandidate> candidates = {
+        {.MinAngle = 0, .MaxAngle = 10, .Weight = 1},
+        {.MinAngle = 20, .MaxAngle = 30, .Weight = 1},
+        {.MinAngle = 45, .MaxAngle = 48, .Weight = 1},
+        {.MinAngle = 90, .MaxAngle = 100, .Weight = 1},
+    };
+    EXPECT_EQ(SelectAngleWindow(candidates, WIDTH, 0), std::pmr::vector<int>({0, 1, 2}));
+}
+
+TEST(SelectAngleWindow, TooWideCandidate) {
+    std::pmr::vector<AngleWindowCandidate> candidates = {
+        {.MinAngle = 0, .MaxAngle = 60, .Weight = 10},
+        {.MinAngle = 70, .MaxAngle = 80, .Weight = 1},
+    };
+    EXPECT_EQ(SelectAngleWindow(candidates, WIDTH, 0), std::pmr::vector<int>({1}));
+}
+
+TEST(SelectAngleWindow, TieClosestToPreferredStart) {
+    std::pmr::vector<AngleWindowCandidate> candidates = {
+        {.MinAngle = 0, .MaxAngle = 10, .Weight = 1},
+        {.MinAngle = 100, .MaxAngle = 110, .Weight = 1},
+    };
+    EXPECT_EQ(SelectAngleWindow(candidates, WIDTH, 0), std::pmr::vector<int>({0}));
+    EXPECT_EQ(SelectAngleWindow(candidates, WIDTH, 90), std::pmr::vector<int>({1}));
+}
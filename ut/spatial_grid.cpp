@@ -0,0 +1,98 @@
+#include "util/spatial_grid.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+
+namespace {
+
+    double Random(double from, double to) {
+        return from + (to - from) * std::rand() / RAND_MAX;
+    }
+
+    Vector3d RandomPoint(double size) {
+        return Vector3d(Random(-size, size), Random(-size, size), Random(0, size));
+    }
+
+}
+
+
+TEST(SpatialGrid, MatchesBruteForce) {
+    std::srand(7);
+    const double radius = 3;
+    SpatialGrid grid(radius);
+
+    for (int iter = 0; iter < 20; ++iter) {
+        std::vector<Vector3d> points;
+        for (int i = 0; i < 300; ++i) {
+            points.push_back(RandomPoint(50));
+        }
+        grid.Build(points);
+
+        for (int q = 0; q < 50; ++q) {
+            const auto start = RandomPoint(50);
+            // short segments are checked by cells, long ones fall back to all points
+            const auto end = start + RandomPoint(q % 2 == 0 ? 2 : 60);
+
+            std::set<int> expected;
+            for (int i = 0; i < points.size(); ++i) {
+                if (DistancePoint2Segment(points[i], start, end) <= radius) {
+                    expected.insert(i);
+                }
+            }
+            std::set<int> found;
+            grid.ForEachNear(start, end, radius, [&](int idx, double distance) {
+                EXPECT_LE(distance, radius);
+                EXPECT_TRUE(found.insert(idx).second);
+            });
+            EXPECT_EQ(found, expected);
+        }
+    }
+}
+
+TEST(SpatialGrid, LongSegmentVisitsCrossedCells) {
+    std::srand(11);
+    const double radius = 2;
+    SpatialGrid grid(1);
+
+    std::vector<Vector3d> points;
+    for (int i = 0; i < 20000; ++i) {
+        points.push_back(RandomPoint(100));
+    }
+    grid.Build(points, radius);
+
+    for (int q = 0; q < 20; ++q) {
+        // path much longer than cell, as rocket path per tick
+        const auto start = RandomPoint(100);
+        const auto end = start + RandomPoint(50) - RandomPoint(50);
+
+        std::set<int> expected;
+        for (int i = 0; i < points.size(); ++i) {
+            if (DistancePoint2Segment(points[i], start, end) <= radius) {
+                expected.insert(i);
+            }
+        }
+        std::set<int> found;
+        const int checkedCount = grid.ForEachNear(start, end, radius, [&](int idx, double) {
+            EXPECT_TRUE(found.insert(idx).second);
+        });
+        EXPECT_EQ(found, expected);
+        // all points are checked by linear scan
+        EXPECT_LT(checkedCount, points.size() / 10);
+    }
+}
+
+TEST(SpatialGrid, PointQuery) {
+    SpatialGrid grid(1);
+    grid.Build({Vector3d(0, 0, 0), Vector3d(0.5, 0, 0), Vector3d(-2, 0, 0), Vector3d(0, 0.9, 0.9)});
+
+    std::set<int> found;
+    grid.ForEachNear(Vector3d::Zero(), Vector3d::Zero(), 1, [&](int idx, double) { found.insert(idx); });
+    EXPECT_EQ(found, std::set<int>({0, 1}));
+
+    EXPECT_THROW(SpatialGrid(0), std::invalid_argument);
+    EXPECT_THROW(grid.Build({}, 0), std::invalid_argument);
+}
@@ -0,0 +1,68 @@
+#include "util/task_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+
+namespace {
+
+    int Fibonacci(TaskScheduler& scheduler, int n) {
+        if (n < 2) {
+            return n;
+        }
+        int first = 0;
+        TaskScheduler::TaskGroup group(scheduler);
+        group.Run([&] { first = Fibonacci(scheduler, n - 1); });
+        const int second = Fibonacci(scheduler, n - 2);
+        group.Wait();
+        return first + second;
+    }
+
+}
+
+
+TEST(TaskScheduler, ParallelForVisitsEveryIndexOnce) {
+    for (int threadsCount : {0, 1, 3}) {
+        TaskScheduler scheduler(threadsCount);
+        for (int grainSize : {0, 1, 7}) {
+            std::vector<std::atomic<int>> visits(1000);
+            scheduler.ParallelFor(visits.size(), [&](int i) { ++visits[i]; }, grainSize);
+            for (const auto& count : visits) {
+                EXPECT_EQ(count, 1);
+            }
+        }
+    }
+}
+
+TEST(TaskScheduler, NestedForkJoin) {
+    TaskScheduler scheduler(3);
+    EXPECT_EQ(Fibonacci(scheduler, 15), 610);
+
+    // loops started from tasks of other loop
+    std::vector<std::atomic<int>> sums(20);
+    scheduler.ParallelFor(sums.size(), [&](int i) {
+        scheduler.ParallelFor(100, [&](int j) { sums[i] += j; }, 1);
+    }, 1);
+    for (const auto& sum : sums) {
+        EXPECT_EQ(sum, 4950);
+    }
+}
+
+TEST(TaskScheduler, RethrowsTaskException) {
+    TaskScheduler scheduler(2);
+    EXPECT_THROW(
+        scheduler.ParallelFor(100, [](int i) {
+            if (i == 42) {
+                throw std::runtime_error("task failed");
+            }
+        }, 1),
+        std::runtime_error
+    );
+    // scheduler stays usable
+    std::atomic<int> count = 0;
+    scheduler.ParallelFor(100, [&](int) { ++count; });
+    EXPECT_EQ(count, 100);
+}
@@ -0,0 +1,106 @@
+#include "radar_control/track_associator.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+    BigRadarData MakeBig(Vector3d pos) {
+        return BigRadarData{SmallRadarData{.Id = -1, .Pos = pos}, .Speed = Vector3d::Zero()};
+    }
+
+}
+
+
+TEST(TrackAssociator, KeepsTrackIds) {
+    Proto::Parameters params;
+    TrackAssociator associator(params);
+
+    std::vector<BigRadarData> bigDatas = {MakeBig(Vector3d(0, 100, 10)), MakeBig(Vector3d(30, 100, 10))};
+    std::vector<std::vector<SmallRadarData>> smallDatas(1);
+    associator.Associate(bigDatas, smallDatas);
+    ASSERT_EQ(associator.GetTracksCount(), 2);
+    const int firstId = bigDatas[0].Id;
+    const int secondId = bigDatas[1].Id;
+    EXPECT_NE(firstId, secondId);
+
+    // detections come in any order, detection out of any gate is dropped
+    smallDatas[0] = {
+        SmallRadarData{.Id = -1, .Pos = Vector3d(28, 101, 10)},
+        SmallRadarData{.Id = -1, .Pos = Vector3d(200, 100, 10)},
+        SmallRadarData{.Id = -1, .Pos = Vector3d(2, 101, 10)}
+    };
+    for (auto& data : bigDatas) {
+        data.Id = -1;
+    }
+    associator.Associate(bigDatas, smallDatas);
+    ASSERT_EQ(smallDatas[0].size(), 2);
+    EXPECT_EQ(smallDatas[0][0].Id, secondId);
+    EXPECT_EQ(smallDatas[0][1].Id, firstId);
+    EXPECT_EQ(bigDatas[0].Id, firstId);
+    EXPECT_EQ(bigDatas[1].Id, secondId);
+
+    // new big radar detection initiates track
+    bigDatas.push_back(MakeBig(Vector3d(0, 300, 10)));
+    smallDatas[0].clear();
+    associator.Associate(bigDatas, smallDatas);
+    EXPECT_EQ(associator.GetTracksCount(), 3);
+    EXPECT_NE(bigDatas[2].Id, firstId);
+    EXPECT_NE(bigDatas[2].Id, secondId);
+}
+
+TEST(TrackAssociator, ResolvesCloseTracks) {
+    Proto::Parameters params;
+    TrackAssociator associator(params);
+
+    // groups of targets are closer than gate, so each detection falls into several gates
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<double> noise(-0.5, 0.5);
+    std::vector<Vector3d> positions;
+    for (int i = 0; i < 25; ++i) {
+        for (int j = 0; j < 25; ++j) {
+            const Vector3d group(i * 30, 100 + j * 30, 10);
+            positions.push_back(group);
+            positions.push_back(group + Vector3d(4, 0, 0));
+            positions.push_back(group + Vector3d(0, 3, 2));
+        }
+    }
+    std::vector<BigRadarData> bigDatas;
+    for (const auto& pos : positions) {
+        bigDatas.push_back(MakeBig(pos));
+    }
+    std::vector<std::vector<SmallRadarData>> smallDatas(2);
+    associator.Associate(bigDatas, smallDatas);
+    ASSERT_EQ(associator.GetTracksCount(), positions.size());
+
+    std::vector<int> order(positions.size());
+    for (int i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    for (auto& datas : smallDatas) {
+        std::shuffle(order.begin(), order.end(), gen);
+        for (int idx : order) {
+            datas.push_back(SmallRadarData{
+                .Id = -1,
+                .Pos = positions[idx] + Vector3d(noise(gen), noise(gen), noise(gen))
+            });
+        }
+    }
+    const auto sent = smallDatas;
+    associator.Associate(bigDatas, smallDatas);
+
+    for (int radar = 0; radar < smallDatas.size(); ++radar) {
+        ASSERT_EQ(smallDatas[radar].size(), positions.size());
+        for (int i = 0; i < positions.size(); ++i) {
+            const auto& pos = sent[radar][i].Pos;
+            const auto it = std::find_if(positions.begin(), positions.end(), [&pos](const Vector3d& p) {
+                return Distance(p, pos) < 1;
+            });
+            EXPECT_EQ(smallDatas[radar][i].Id, bigDatas[it - positions.begin()].Id);
+        }
+    }
+}
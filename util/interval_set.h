@@ -0,0 +1,142 @@
+#ifndef INTERVAL_SET_H
+#define INTERVAL_SET_H
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+
+// Sorted set of closed segments with fixed capacity, all operations work in place without allocations.
+// Segments are expected not to overlap, empty ones (start > end) are dropped.
+template <size_t Capacity>
+class IntervalSet {
+public:
+    using Segment = std::pair<double, double>;
+
+    IntervalSet() = default;
+
+    template <class T>
+    static IntervalSet FromProto(const T& protoMsg) {
+        IntervalSet res;
+        for (const auto& seg : protoMsg) {
+            res.Add(seg.start(), seg.end());
+        }
+        return res;
+    }
+
+    size_t Size() const { return Count; }
+    bool Empty() const { return Count == 0; }
+    void Clear() { Count = 0; }
+
+    const Segment& operator[](size_t i) const { return Segments[i]; }
+    const Segment* begin() const { return Segments.data(); }
+    const Segment* end() const { return Segments.data() + Count; }
+
+    void Add(double start, double end) {
+        if (start > end) {
+            return;
+        }
+        if (Count == Capacity) {
+            throw std::length_error("Interval set capacity " + std::to_string(Capacity) + " exceeded");
+        }
+        size_t i = Count++;
+        for (; i > 0 && Segments[i - 1].first > start; --i) {
+            Segments[i] = Segments[i - 1];
+        }
+        Segments[i] = {start, end};
+    }
+
+    void Shift(double shift) {
+        for (size_t i = 0; i < Count; ++i) {
+            Segments[i].first += shift;
+            Segments[i].second += shift;
+        }
+    }
+
+    // mirrors every segment around point: [a, b] becomes [point - b, point - a]
+    void Reflect(double point) {
+        std::reverse(Segments.begin(), Segments.begin() + Count);
+        for (size_t i = 0; i < Count; ++i) {
+            Segments[i] = {point - Segments[i].second, point - Segments[i].first};
+        }
+    }
+
+    // replaces segments with gaps between them, shrinked by margin,
+    // gaps before first and after last segment have length edgeSegmentLen
+    void Invert(double edgeSegmentLen, double margin) {
+        if (Count == 0) {
+            Add(-edgeSegmentLen / 2, edgeSegmentLen / 2);
+            return;
+        }
+        if (Count == Capacity) {
+            throw std::length_error("Interval set capacity " + std::to_string(Capacity) + " exceeded");
+        }
+        const double lastEnd = Segments[Count - 1].second;
+        double gapStart = Segments[0].first - edgeSegmentLen;
+        size_t size = 0;
+        for (size_t i = 0; i < Count; ++i) {
+            // i-th segment is read before (size <= i)-th one is written
+            const auto gap = Segment{gapStart, Segments[i].first - margin};
+            gapStart = Segments[i].second + margin;
+            if (gap.first <= gap.second) {
+                Segments[size++] = gap;
+            }
+        }
+        Segments[size++] = {lastEnd + margin, lastEnd + edgeSegmentLen};
+        Count = size;
+    }
+
+    void Intersect(const IntervalSet& other) {
+        std::array<Segment, Capacity> result;
+        size_t size = 0;
+        size_t i = 0, j = 0;
+        while (i < Count && j < other.Count) {
+            const double start = std::max(Segments[i].first, other.Segments[j].first);
+            const double end = std::min(Segments[i].second, other.Segments[j].second);
+            if (start <= end) {
+                if (size == Capacity) {
+                    throw std::length_error("Interval set capacity " + std::to_string(Capacity) + " exceeded");
+                }
+                result[size++] = {start, end};
+            }
+            if (Segments[i].second < other.Segments[j].second) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+        std::copy(result.begin(), result.begin() + size, Segments.begin());
+        Count = size;
+    }
+
+    // index of segment containing point, -1 if there is no such one
+    int Find(double point) const {
+        auto it = std::upper_bound(
+            begin(),
+            end(),
+            point,
+            [](double p, const Segment& seg) { return p < seg.first; }
+        );
+        if (it == begin() || (it - 1)->second < point) {
+            return -1;
+        }
+        return it - 1 - begin();
+    }
+
+    bool Contains(double point) const {
+        return Find(point) != -1;
+    }
+
+private:
+    std::array<Segment, Capacity> Segments;
+    size_t Count = 0;
+};
+
+// dead zones and zones between them
+const size_t MAX_ANGLE_SEGMENTS = 16;
+using AngleSegments = IntervalSet<MAX_ANGLE_SEGMENTS>;
+
+
+#endif // INTERVAL_SET_H
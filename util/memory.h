@@ -0,0 +1,41 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <cstddef>
+#include <memory_resource>
+
+
+// Forwards allocations to upstream resource and counts them.
+// Used as upstream of arenas, so every allocation it sees means arena was too small.
+class CountingMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit CountingMemoryResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : Upstream(upstream)
+    {}
+
+    long long GetAllocationsCount() const { return AllocationsCount; }
+    size_t GetAllocatedBytes() const { return AllocatedBytes; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++AllocationsCount;
+        AllocatedBytes += bytes;
+        return Upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        Upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    std::pmr::memory_resource* Upstream;
+    long long AllocationsCount = 0;
+    size_t AllocatedBytes = 0;
+};
+
+
+#endif // MEMORY_H
@@ -1,19 +1,20 @@
 #ifndef POINTS_H
 #define POINTS_H
 
+#include <cmath>
 #include <string>
 
 
 const double EPS = 1e-6;
 
 struct Vector2d {
-    Vector2d()
+    constexpr Vector2d()
         : X(0), Y(0) {}
-    Vector2d(double x, double y)
+    constexpr Vector2d(double x, double y)
         : X(x), Y(y) {}
 
     std::string DebugString() const;
-    static Vector2d Zero() {
+    static constexpr Vector2d Zero() {
         return Vector2d(0, 0);
     };
 
@@ -21,42 +22,120 @@ struct Vector2d {
     double Y;
 };
 
+// With RC_PADDED_VECTORS vector is padded to 4 aligned lanes, so compiler can process it with one SIMD register.
+// Padding changes size of radar data records, so all binaries exchanging them must be built with the same layout.
+#ifdef RC_PADDED_VECTORS
+struct alignas(4 * sizeof(double)) Vector3d {
+#else
 struct Vector3d {
-    Vector3d()
+#endif
+    constexpr Vector3d()
         : X(0), Y(0), Z(0) {}
-    Vector3d(double x, double y, double z)
+    constexpr Vector3d(double x, double y, double z)
         : X(x), Y(y), Z(z) {}
-    Vector3d(double x, double y)
+    constexpr Vector3d(double x, double y)
         : X(x), Y(y), Z(0) {}
 
     std::string DebugString() const;
-    static Vector3d Zero() {
+    static constexpr Vector3d Zero() {
         return Vector3d(0, 0, 0);
     };
 
     double X;
     double Y;
     double Z;
+#ifdef RC_PADDED_VECTORS
+    double W = 0; // padding lane, always zero
+#endif
 };
 
-Vector3d operator+(const Vector3d& p1, const Vector3d& p2);
-Vector3d& operator+=(Vector3d& p1, const Vector3d& p2);
-Vector3d operator-(const Vector3d& p1, const Vector3d& p2);
-Vector3d& operator-=(Vector3d& p1, const Vector3d& p2);
-Vector3d operator*(const Vector3d& p1, double p2);
-Vector3d& operator*=(Vector3d& p1, double p2);
-Vector3d operator*(const Vector3d& p1, const Vector3d& p2);
-Vector3d& operator*=(Vector3d& p1, const Vector3d& p2);
-Vector3d operator/(const Vector3d& p1, double p2);
-Vector3d& operator/=(Vector3d& p1, const Vector3d& p2);
-bool operator==(const Vector3d& p1, const Vector3d& p2);
-bool operator!=(const Vector3d& p1, const Vector3d& p2);
+constexpr Vector3d operator+(const Vector3d& p1, const Vector3d& p2) {
+    return Vector3d(p1.X + p2.X, p1.Y + p2.Y, p1.Z + p2.Z);
+}
+
+constexpr Vector3d& operator+=(Vector3d& p1, const Vector3d& p2) {
+    p1 = p1 + p2;
+    return p1;
+}
+
+constexpr Vector3d operator-(const Vector3d& p1, const Vector3d& p2) {
+    return Vector3d(p1.X - p2.X, p1.Y - p2.Y, p1.Z - p2.Z);
+}
+
+constexpr Vector3d& operator-=(Vector3d& p1, const Vector3d& p2) {
+    p1 = p1 - p2;
+    return p1;
+}
+
+constexpr Vector3d operator*(const Vector3d& p1, double p2) {
+    return Vector3d(p1.X * p2, p1.Y * p2, p1.Z * p2);
+}
+
+constexpr Vector3d& operator*=(Vector3d& p1, double p2) {
+    p1 = p1 * p2;
+    return p1;
+}
+
+constexpr Vector3d operator*(const Vector3d& p1, const Vector3d& p2) {
+    return Vector3d(p1.X * p2.X, p1.Y * p2.Y, p1.Z * p2.Z);
+}
+
+constexpr Vector3d& operator*=(Vector3d& p1, const Vector3d& p2) {
+    p1 = p1 * p2;
+    return p1;
+}
+
+constexpr Vector3d operator/(const Vector3d& p1, double p2) {
+    return Vector3d(p1.X / p2, p1.Y / p2, p1.Z / p2);
+}
+
+constexpr Vector3d& operator/=(Vector3d& p1, double p2) {
+    p1 = p1 / p2;
+    return p1;
+}
+
+constexpr bool operator==(const Vector3d& p1, const Vector3d& p2) {
+    // std::abs isn't constexpr in C++17
+    auto isNear = [](double a, double b) {
+        return a - b < EPS && b - a < EPS;
+    };
+    return isNear(p1.X, p2.X) && isNear(p1.Y, p2.Y) && isNear(p1.Z, p2.Z);
+}
+
+constexpr bool operator!=(const Vector3d& p1, const Vector3d& p2) {
+    return !(p1 == p2);
+}
 
 std::string Vector3dAsStr(const Vector3d& p);
 
-double SqrtOfSumSquares(const Vector3d& v);
-double Distance(const Vector3d& p1, const Vector3d& p2);
-bool IsSignsEqual(const Vector3d& p1, const Vector3d& p2);
+constexpr double SumSquares(const Vector3d& v) {
+    return v.X * v.X + v.Y * v.Y + v.Z * v.Z;
+}
+
+inline double SqrtOfSumSquares(const Vector3d& v) {
+    return std::sqrt(SumSquares(v));
+}
+
+inline double Distance(const Vector3d& p1, const Vector3d& p2) {
+    return SqrtOfSumSquares(p2 - p1);
+}
+
+// distance from point p to segment [a, b]
+inline double DistancePoint2Segment(const Vector3d& p, const Vector3d& a, const Vector3d& b) {
+    const auto ab = b - a;
+    const auto ap = p - a;
+    const double len2 = SumSquares(ab);
+    double t = (len2 == 0 ? 0 : (ab.X * ap.X + ab.Y * ap.Y + ab.Z * ap.Z) / len2);
+    t = (t < 0 ? 0 : (t > 1 ? 1 : t));
+    return Distance(p, a + ab * t);
+}
+
+constexpr bool IsSignsEqual(const Vector3d& p1, const Vector3d& p2) {
+    auto isSignEqual = [](double p1, double p2) {
+        return (p1 > 0 && p2 >0) || (p1 < 0 && p2 < 0);
+    };
+    return isSignEqual(p1.X, p2.X) && isSignEqual(p1.Y, p2.Y) && isSignEqual(p1.Z, p2.Z);
+}
 
 
 #endif // POINTS_H
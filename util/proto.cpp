@@ -1,47 +1,103 @@
 #include "proto.h"
 #include "util.h"
 
+#include <algorithm>
 #include <cmath>
 
 
+namespace {
+
+    void PrepareSmallRadar(Proto::Parameters::SmallRadar& radar, double playSpeed) {
+        radar.set_view_angle(DegToRad(radar.view_angle()));
+        radar.set_ang_stddev(DegToRad(radar.ang_stddev()));
+        radar.set_max_angle_speed(DegToRad(radar.max_angle_speed()));
+        radar.set_max_eps(DegToRad(radar.max_eps()));
+        radar.set_responsible_sector_start(DegToRad(radar.responsible_sector_start()));
+        radar.set_responsible_sector_end(DegToRad(radar.responsible_sector_end()));
+
+        radar.set_max_angle_speed(radar.max_angle_speed() / 1000 * playSpeed);
+        radar.set_max_eps(radar.max_eps() / 1000 / 1000 * playSpeed);
+        radar.set_frequency(radar.frequency() * playSpeed);
+    }
+
+}
+
+
 void PrepareParams(Proto::Parameters& params) {
-    params.mutable_small_radar()->set_view_angle(DegToRad(params.small_radar().view_angle()));
-    params.mutable_small_radar()->set_ang_stddev(DegToRad(params.small_radar().ang_stddev()));
-    params.mutable_small_radar()->set_max_angle_speed(DegToRad(params.small_radar().max_angle_speed()));
-    params.mutable_small_radar()->set_max_eps(DegToRad(params.small_radar().max_eps()));
-    params.mutable_small_radar()->set_responsible_sector_start(DegToRad(params.small_radar().responsible_sector_start()));
-    params.mutable_small_radar()->set_responsible_sector_end(DegToRad(params.small_radar().responsible_sector_end()));
+    PrepareSmallRadar(*params.mutable_small_radar(), params.general().play_speed());
+    for (auto& radar : *params.mutable_extra_small_radars()) {
+        PrepareSmallRadar(radar, params.general().play_speed());
+    }
+
     params.mutable_big_radar()->set_ang_stddev(DegToRad(params.big_radar().ang_stddev()));
     params.mutable_ship()->set_max_angle_speed(DegToRad(params.ship().max_angle_speed()));
     params.mutable_ship()->set_max_eps(DegToRad(params.ship().max_eps()));
     params.mutable_simulator()->set_max_deviation_angle_vertical(DegToRad(params.simulator().max_deviation_angle_vertical()));
     params.mutable_general()->set_margin_angle(DegToRad(params.general().margin_angle()));
+    params.mutable_general()->set_rotation_cache_step(DegToRad(params.general().rotation_cache_step()));
 
     for (auto& zone : *params.mutable_ship()->mutable_dead_zones()) {
         zone.set_start(DegToRad(zone.start()));
         zone.set_end(DegToRad(zone.end()));
     }
 
-    params.mutable_small_radar()->set_max_angle_speed(params.small_radar().max_angle_speed() / 1000);
-    params.mutable_small_radar()->set_max_eps(params.small_radar().max_eps() / 1000 / 1000);
     params.mutable_ship()->set_max_angle_speed(params.ship().max_angle_speed() / 1000);
     params.mutable_ship()->set_max_eps(params.ship().max_eps() / 1000 / 1000);
     params.mutable_simulator()->set_min_target_speed(params.simulator().min_target_speed() / 1000);
     params.mutable_simulator()->set_max_target_speed(params.simulator().max_target_speed() / 1000);
     params.mutable_defense()->set_rocket_speed(params.defense().rocket_speed() / 1000);
+    params.mutable_general()->set_geometry_speed_tolerance(params.general().geometry_speed_tolerance() / 1000);
+    params.mutable_general()->set_kalman_acceleration_stddev(params.general().kalman_acceleration_stddev() / 1000 / 1000);
+    params.mutable_general()->set_kalman_precise_speed_stddev(params.general().kalman_precise_speed_stddev() / 1000);
 
     const auto play_speed = params.general().play_speed();
-    params.mutable_small_radar()->set_max_angle_speed(params.small_radar().max_angle_speed() * play_speed);
-    params.mutable_small_radar()->set_max_eps(params.small_radar().max_eps() * play_speed);
-    params.mutable_small_radar()->set_frequency(params.small_radar().frequency() * play_speed);
     params.mutable_big_radar()->set_frequency(params.big_radar().frequency() * play_speed);
     params.mutable_ship()->set_max_angle_speed(params.ship().max_angle_speed() * play_speed);
     params.mutable_ship()->set_max_eps(params.ship().max_eps() * play_speed);
     params.mutable_general()->set_death_time(params.general().death_time() / play_speed);
     params.mutable_general()->set_margin_time(params.general().margin_time() / play_speed);
+    params.mutable_general()->set_planner_horizon(params.general().planner_horizon() / play_speed);
     params.mutable_defense()->set_time_to_launch_rocket(params.defense().time_to_launch_rocket() / play_speed);
+    params.mutable_defense()->set_reload_time(params.defense().reload_time() / play_speed);
     params.mutable_defense()->set_rocket_speed(params.defense().rocket_speed() * play_speed);
     params.mutable_simulator()->set_targets_per_minute(params.simulator().targets_per_minute() * play_speed);
     params.mutable_simulator()->set_min_target_speed(params.simulator().min_target_speed() * play_speed);
     params.mutable_simulator()->set_max_target_speed(params.simulator().max_target_speed() * play_speed);
+    params.mutable_general()->set_geometry_speed_tolerance(params.general().geometry_speed_tolerance() * play_speed);
+    params.mutable_general()->set_kalman_acceleration_stddev(
+        params.general().kalman_acceleration_stddev() * play_speed * play_speed
+    );
+    params.mutable_general()->set_kalman_precise_speed_stddev(params.general().kalman_precise_speed_stddev() * play_speed);
+}
+
+void PrepareScenario(Proto::TargetScenario& scenario, double playSpeed) {
+    scenario.set_radar_start_angle(DegToRad(scenario.radar_start_angle()));
+    scenario.set_ship_start_angle(DegToRad(scenario.ship_start_angle()));
+
+    for (auto& launch : *scenario.mutable_launches()) {
+        launch.set_time(launch.time() * 1000. / playSpeed);
+        launch.set_angle_pos(DegToRad(launch.angle_pos()));
+        if (launch.has_angle_deviation()) {
+            launch.set_angle_deviation(DegToRad(launch.angle_deviation()));
+        }
+        if (launch.has_abs_speed()) {
+            launch.set_abs_speed(launch.abs_speed() * playSpeed / 1000);
+        }
+    }
+
+    std::stable_sort(
+        scenario.mutable_launches()->begin(),
+        scenario.mutable_launches()->end(),
+        [](const Proto::TargetScenario::Launch& l, const Proto::TargetScenario::Launch& r) {
+            return l.time() < r.time();
+        }
+    );
+}
+
+int GetSmallRadarsCount(const Proto::Parameters& params) {
+    return 1 + params.extra_small_radars_size();
+}
+
+const Proto::Parameters::SmallRadar& GetSmallRadar(const Proto::Parameters& params, int idx) {
+    return (idx == 0 ? params.small_radar() : params.extra_small_radars(idx - 1));
 }
@@ -3,6 +3,7 @@
 
 
 #include "proto/generated/params.pb.h"
+#include "proto/generated/scenario.pb.h"
 
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/text_format.h>
@@ -21,15 +22,12 @@ T ParseProtoFromFile(const std::string& filename) {
 }
 
 void PrepareParams(Proto::Parameters& params);
+// converts launches to ms, radians and distance per ms and sorts them by time, start angles to radians
+void PrepareScenario(Proto::TargetScenario& scenario, double playSpeed);
 
-template<class T>
-std::vector<std::pair<double, double>> SegmentsFromProto(const T& protoMsg) {
-    std::vector<std::pair<double, double>> res;
-    for (const auto& seg : protoMsg) {
-        res.emplace_back(seg.start(), seg.end());
-    }
-    return res;
-}
+// small_radar and extra_small_radars, main small radar has index 0
+int GetSmallRadarsCount(const Proto::Parameters& params);
+const Proto::Parameters::SmallRadar& GetSmallRadar(const Proto::Parameters& params, int idx);
 
 
 #endif // PROTO_H
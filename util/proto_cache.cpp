@@ -0,0 +1,146 @@
+#include "proto_cache.h"
+#include "proto.h"
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/text_format.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+#include <utility>
+
+
+// hash of conversion and cache sources, set by build, so entries prepared by old code aren't read
+#ifndef RC_PROTO_CACHE_BUILD_ID
+#define RC_PROTO_CACHE_BUILD_ID ""
+#endif
+
+
+namespace {
+
+    // FNV-1a, unlike std::hash it is the same for all builds sharing cache
+    uint64_t Hash(const std::string& data, uint64_t hash = 14695981039346656037ull) {
+        for (unsigned char c : data) {
+            hash ^= c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    uint64_t Hash(double value, uint64_t hash) {
+        std::string bytes(sizeof(value), '\0');
+        std::memcpy(bytes.data(), &value, sizeof(value));
+        return Hash(bytes, hash);
+    }
+
+    std::string ReadFile(const std::string& filename) {
+        std::ifstream in(filename, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Can't read file " + filename);
+        }
+        std::ostringstream out;
+        out << in.rdbuf();
+        return out.str();
+    }
+
+    std::string ToHex(uint64_t value) {
+        std::ostringstream out;
+        out << std::hex << value;
+        return out.str();
+    }
+
+    // entry is serialized message preceded by its size and hash, so truncated or corrupted entry isn't parsed
+    struct EntryHeader {
+        uint64_t Size;
+        uint64_t Hash;
+    };
+
+    std::string MakeEntry(const std::string& data) {
+        const EntryHeader header{.Size = data.size(), .Hash = Hash(data)};
+        std::string res(sizeof(header), '\0');
+        std::memcpy(res.data(), &header, sizeof(header));
+        return res + data;
+    }
+
+    // false if entry is broken
+    bool ParseEntry(const std::string& entry, google::protobuf::Message& res) {
+        EntryHeader header;
+        if (entry.size() < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, entry.data(), sizeof(header));
+        const auto data = entry.substr(sizeof(header));
+        return header.Size == data.size() && header.Hash == Hash(data) && res.ParseFromString(data);
+    }
+
+}
+
+
+ProtoCache::ProtoCache(std::string cacheDir)
+    : CacheDir(std::move(cacheDir))
+{}
+
+Proto::Parameters ProtoCache::LoadParams(const std::string& filename) {
+    return Load<Proto::Parameters>(filename, 0, [](Proto::Parameters& params) {
+        PrepareParams(params);
+    });
+}
+
+Proto::TargetScenario ProtoCache::LoadScenario(const std::string& filename, const Proto::Parameters& params) {
+    const double playSpeed = params.general().play_speed();
+    return Load<Proto::TargetScenario>(filename, Hash(playSpeed, 0), [playSpeed](Proto::TargetScenario& scenario) {
+        PrepareScenario(scenario, playSpeed);
+    });
+}
+
+template<class T, class Prepare>
+T ProtoCache::Load(const std::string& filename, uint64_t salt, Prepare prepare) {
+    const auto text = ReadFile(filename);
+    T res;
+
+    std::string entryPath;
+    if (!CacheDir.empty()) {
+        uint64_t key = Hash(T::descriptor()->file()->DebugString(), Hash(RC_PROTO_CACHE_BUILD_ID));
+        key = Hash(text, key ^ salt);
+        entryPath = CacheDir + "/" + std::filesystem::path(filename).stem().string() + "-" + ToHex(key) + ".binpb";
+
+        std::ifstream entry(entryPath, std::ios::binary);
+        if (entry) {
+            std::ostringstream data;
+            data << entry.rdbuf();
+            if (ParseEntry(data.str(), res)) {
+                ++HitsCount;
+                return res;
+            }
+            res.Clear();
+        }
+    }
+    ++MissesCount;
+
+    if (!google::protobuf::TextFormat::ParseFromString(text, &res)) {
+        throw std::invalid_argument("Can't parse " + filename);
+    }
+    prepare(res);
+
+    // failed write only costs parsing next time
+    if (!CacheDir.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(CacheDir, error);
+        const auto tmpPath = entryPath + ".tmp" + std::to_string(getpid());
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        out << MakeEntry(res.SerializeAsString());
+        // buffered data may fail to be written only on close
+        out.close();
+        const bool isWritten = out.good();
+        if (isWritten) {
+            std::filesystem::rename(tmpPath, entryPath, error);
+        }
+        if (!isWritten || error) {
+            std::filesystem::remove(tmpPath, error);
+        }
+    }
+    return res;
+}
@@ -0,0 +1,43 @@
+#ifndef PROTO_CACHE_H
+#define PROTO_CACHE_H
+
+#include "proto/generated/params.pb.h"
+#include "proto/generated/scenario.pb.h"
+
+#include <cstdint>
+#include <string>
+
+
+// Binary cache of prepared configs and scenarios, so repeated runs skip text parsing and unit conversions.
+// Entry name is a hash of text file contents, proto schema, conversion inputs and build id, so edited file,
+// changed schema, other play speed or changed conversion code get new entry,
+// stale entries are never read and may be deleted any time.
+// Entries are written to temporary file and renamed, so concurrent runs sharing directory don't see partial ones.
+// Entry stores size and hash of message, broken entry is parsed from text again as missing one.
+class ProtoCache {
+public:
+    // empty cacheDir - cache is disabled, files are always parsed
+    explicit ProtoCache(std::string cacheDir);
+
+    // config prepared by PrepareParams
+    Proto::Parameters LoadParams(const std::string& filename);
+    // scenario prepared by PrepareScenario for params, which are already prepared
+    Proto::TargetScenario LoadScenario(const std::string& filename, const Proto::Parameters& params);
+
+    int GetHitsCount() const { return HitsCount; }
+    int GetMissesCount() const { return MissesCount; }
+
+private:
+    // prepare is called for text parsed message, which is stored then
+    template<class T, class Prepare>
+    T Load(const std::string& filename, uint64_t salt, Prepare prepare);
+
+private:
+    const std::string CacheDir;
+
+    int HitsCount = 0;
+    int MissesCount = 0;
+};
+
+
+#endif // PROTO_CACHE_H
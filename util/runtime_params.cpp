@@ -0,0 +1,61 @@
+#include "runtime_params.h"
+
+
+RuntimeParams CompileParams(const Proto::Parameters& params) {
+    const auto& smallRadar = params.small_radar();
+    const auto& general = params.general();
+    const auto& defense = params.defense();
+    const double smallRadarPeriod = 1000. / smallRadar.frequency();
+
+    return RuntimeParams{
+        .SmallRadarRadius = smallRadar.radius(),
+        .SmallRadarViewAngle = smallRadar.view_angle(),
+        .SmallRadarHalfViewAngle = smallRadar.view_angle() / 2,
+        .SmallRadarMaxAngleSpeed = smallRadar.max_angle_speed(),
+        .SmallRadarMaxEps = smallRadar.max_eps(),
+        .SmallRadarPeriod = smallRadarPeriod,
+        .ResponsibleSectorStart = smallRadar.responsible_sector_start(),
+        .ResponsibleSectorEnd = smallRadar.responsible_sector_end(),
+        .SmallRadarStddev = Vector3d(smallRadar.rad_stddev(), smallRadar.ang_stddev(), smallRadar.h_stddev()),
+
+        .BigRadarRadius = params.big_radar().radius(),
+        .BigRadarPeriod = 1000. / params.big_radar().frequency(),
+        .BigRadarStddev = Vector3d(
+            params.big_radar().rad_stddev(),
+            params.big_radar().ang_stddev(),
+            params.big_radar().h_stddev()
+        ),
+
+        .ShipMaxAngleSpeed = params.ship().max_angle_speed(),
+        .ShipMaxEps = params.ship().max_eps(),
+        .DeadZones = AngleSegments::FromProto(params.ship().dead_zones()),
+
+        .TargetSelection = general.target_selection(),
+        .DeathTime = general.death_time(),
+        .MarginAngle = general.margin_angle(),
+        .MarginTime = general.margin_time(),
+        .KinematicsStep = general.kinematics_step(),
+        .RotationCacheStep = general.rotation_cache_step(),
+        .ProcessBudget = general.process_budget_share() * smallRadarPeriod,
+        .GeometryPosTolerance = general.geometry_pos_tolerance(),
+        .GeometrySpeedTolerance = general.geometry_speed_tolerance(),
+        .GeometryParallelThreshold = general.geometry_parallel_threshold(),
+        .TimeToPreciseSpeed = general.small_radar_measure_cnt() * smallRadarPeriod,
+
+        .HasLaunchers = defense.has_launchers_count(),
+        .LaunchersCount = (int) defense.launchers_count(),
+        .MagazineSize = (int) defense.magazine_size(),
+        .PlannedLaunchesPerLauncher = (int) defense.planned_launches_per_launcher(),
+        .ReloadTime = defense.reload_time(),
+        .TimeToLaunchRocket = defense.time_to_launch_rocket(),
+        .RocketSpeed = defense.rocket_speed(),
+        .KillRadius = defense.kill_radius(),
+
+        .MaxTargetSpeed = params.simulator().max_target_speed(),
+        .MaxHeight = params.simulator().max_height(),
+        .IsStrippingIds = params.simulator().strip_ids(),
+
+        .TargetRadius = (float) params.visualizer().target_radius(),
+        .IsDrawingEntryPoints = params.visualizer().draw_entry_points()
+    };
+}
@@ -0,0 +1,64 @@
+#ifndef RUNTIME_PARAMS_H
+#define RUNTIME_PARAMS_H
+
+#include "interval_set.h"
+#include "points.h"
+#include "proto/generated/params.pb.h"
+
+
+// Parameters read every tick, compiled from prepared Proto::Parameters once, when component is constructed.
+// Loops read plain fields instead of nested protobuf accessors, values derived from several parameters
+// are calculated here. Units are the same as after PrepareParams: radians, ms and distance per ms.
+struct alignas(64) RuntimeParams {
+    // small_radar of given parameters, controller gets parameters with its own radar there
+    double SmallRadarRadius;
+    double SmallRadarViewAngle;
+    double SmallRadarHalfViewAngle;
+    double SmallRadarMaxAngleSpeed;
+    double SmallRadarMaxEps;
+    double SmallRadarPeriod; // ms between measurements
+    double ResponsibleSectorStart;
+    double ResponsibleSectorEnd;
+    Vector3d SmallRadarStddev; // of radius, angle and height
+
+    double BigRadarRadius;
+    double BigRadarPeriod;
+    Vector3d BigRadarStddev; // of radius, angle and height
+
+    double ShipMaxAngleSpeed;
+    double ShipMaxEps;
+    AngleSegments DeadZones; // relative to ship
+
+    Proto::Parameters::General::TargetSelection TargetSelection;
+    double DeathTime;
+    double MarginAngle;
+    double MarginTime;
+    double KinematicsStep;
+    double RotationCacheStep; // 0 - no cache
+    double ProcessBudget; // ms, 0 - no budget
+    double GeometryPosTolerance;
+    double GeometrySpeedTolerance;
+    int GeometryParallelThreshold;
+    double TimeToPreciseSpeed; // ms of small radar measurements until speed is precise
+
+    bool HasLaunchers;
+    int LaunchersCount;
+    int MagazineSize;
+    int PlannedLaunchesPerLauncher;
+    double ReloadTime;
+    double TimeToLaunchRocket;
+    double RocketSpeed;
+    double KillRadius;
+
+    double MaxTargetSpeed;
+    double MaxHeight;
+    bool IsStrippingIds;
+
+    float TargetRadius;
+    bool IsDrawingEntryPoints;
+};
+
+RuntimeParams CompileParams(const Proto::Parameters& params);
+
+
+#endif // RUNTIME_PARAMS_H
@@ -0,0 +1,30 @@
+#include "spatial_grid.h"
+
+#include <stdexcept>
+
+
+SpatialGrid::SpatialGrid(double cellSize)
+    : CellSize(cellSize)
+{
+    if (cellSize <= 0) {
+        throw std::invalid_argument("Cell size of spatial grid must be positive");
+    }
+}
+
+void SpatialGrid::Build(const std::vector<Vector3d>& points, double cellSize) {
+    if (cellSize <= 0) {
+        throw std::invalid_argument("Cell size of spatial grid must be positive");
+    }
+    CellSize = cellSize;
+    Build(points);
+}
+
+void SpatialGrid::Build(const std::vector<Vector3d>& points) {
+    Points.assign(points.begin(), points.end());
+    Entries.resize(Points.size());
+    for (int i = 0; i < Points.size(); ++i) {
+        const auto cell = GetCell(Points[i]);
+        Entries[i] = {GetKey(cell.X, cell.Y, cell.Z), i};
+    }
+    std::sort(Entries.begin(), Entries.end());
+}
@@ -0,0 +1,147 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "points.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+
+// Uniform grid over points for proximity queries, points are referred by their indices.
+// Grid is rebuilt from scratch, as points move every tick, buffers are reused between builds.
+class SpatialGrid {
+public:
+    explicit SpatialGrid(double cellSize);
+
+    void Build(const std::vector<Vector3d>& points);
+    // cell size close to query radius makes queries visit fewest cells
+    void Build(const std::vector<Vector3d>& points, double cellSize);
+
+    // Calls func(idx, distance) for every point within radius of segment [start, end],
+    // segment of zero length is a point. Returns number of points, which distance was checked.
+    template <class Func>
+    int ForEachNear(Vector3d start, Vector3d end, double radius, Func&& func) const {
+        int checkedCount = 0;
+        auto check = [&](int idx) {
+            ++checkedCount;
+            const double distance = DistancePoint2Segment(Points[idx], start, end);
+            if (distance <= radius) {
+                func(idx, distance);
+            }
+        };
+
+        const Cell startCell = GetCell(start);
+        const Cell endCell = GetCell(end);
+        int cell[3] = {startCell.X, startCell.Y, startCell.Z};
+        int stepsLeft[3] = {
+            std::abs(endCell.X - startCell.X),
+            std::abs(endCell.Y - startCell.Y),
+            std::abs(endCell.Z - startCell.Z)
+        };
+        // cells within ring of any cell crossed by segment contain all points within radius
+        const int ring = (int) std::ceil(radius / CellSize);
+        const double side = 2 * ring + 1;
+        const double cellsCount = side * side * side + (stepsLeft[0] + stepsLeft[1] + stepsLeft[2]) * side * side;
+        // long segment visits more cells than there are points
+        if (cellsCount > Points.size()) {
+            for (int i = 0; i < Points.size(); ++i) {
+                check(i);
+            }
+            return checkedCount;
+        }
+
+        auto checkBlock = [&](const int (&low)[3], const int (&high)[3]) {
+            for (int x = low[0]; x <= high[0]; ++x) {
+                for (int y = low[1]; y <= high[1]; ++y) {
+                    for (int z = low[2]; z <= high[2]; ++z) {
+                        const auto key = GetKey(x, y, z);
+                        auto it = std::lower_bound(Entries.begin(), Entries.end(), std::make_pair(key, -1));
+                        for (; it != Entries.end() && it->first == key; ++it) {
+                            check(it->second);
+                        }
+                    }
+                }
+            }
+        };
+        int low[3];
+        int high[3];
+        for (int a = 0; a < 3; ++a) {
+            low[a] = cell[a] - ring;
+            high[a] = cell[a] + ring;
+        }
+        checkBlock(low, high);
+
+        // Cells crossed by segment are walked in order (3D DDA), each step enters neighbour cell along one axis.
+        // Walk never goes back along any axis, so only the far face of ring around entered cell is new.
+        const double from[3] = {start.X, start.Y, start.Z};
+        const double dir[3] = {end.X - start.X, end.Y - start.Y, end.Z - start.Z};
+        int step[3];
+        double nextT[3]; // segment parameter of next cell boundary along axis
+        double deltaT[3];
+        for (int a = 0; a < 3; ++a) {
+            step[a] = (dir[a] > 0 ? 1 : -1);
+            if (stepsLeft[a] == 0) {
+                nextT[a] = deltaT[a] = 0;
+                continue;
+            }
+            const double boundary = (cell[a] + (step[a] > 0 ? 1 : 0)) * CellSize;
+            nextT[a] = (boundary - from[a]) / dir[a];
+            deltaT[a] = CellSize / std::abs(dir[a]);
+        }
+        while (stepsLeft[0] + stepsLeft[1] + stepsLeft[2] > 0) {
+            int axis = -1;
+            for (int a = 0; a < 3; ++a) {
+                if (stepsLeft[a] > 0 && (axis == -1 || nextT[a] < nextT[axis])) {
+                    axis = a;
+                }
+            }
+            cell[axis] += step[axis];
+            nextT[axis] += deltaT[axis];
+            --stepsLeft[axis];
+
+            for (int a = 0; a < 3; ++a) {
+                low[a] = cell[a] - ring;
+                high[a] = cell[a] + ring;
+            }
+            low[axis] = high[axis] = cell[axis] + step[axis] * ring;
+            checkBlock(low, high);
+        }
+        return checkedCount;
+    }
+
+    size_t Size() const { return Points.size(); }
+
+private:
+    struct Cell {
+        int X;
+        int Y;
+        int Z;
+    };
+
+    Cell GetCell(Vector3d p) const {
+        return Cell{
+            (int) std::floor(p.X / CellSize),
+            (int) std::floor(p.Y / CellSize),
+            (int) std::floor(p.Z / CellSize)
+        };
+    }
+
+    // 21 bits per coordinate, cells of coordinates far beyond simulation area may share keys,
+    // it only makes query check more points
+    static uint64_t GetKey(int x, int y, int z) {
+        const uint64_t mask = (1 << 21) - 1;
+        return ((uint64_t(x) & mask) << 42) | ((uint64_t(y) & mask) << 21) | (uint64_t(z) & mask);
+    }
+
+private:
+    double CellSize;
+    std::vector<Vector3d> Points;
+    std::vector<std::pair<uint64_t, int>> Entries; // cell key and point index, sorted
+};
+
+
+#endif // SPATIAL_GRID_H
@@ -0,0 +1,182 @@
+#include "task_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace {
+
+    // queue of current thread, threads outside of any pool have none
+    thread_local const TaskScheduler* CurrentScheduler = nullptr;
+    thread_local int CurrentQueue = -1;
+
+    // parts per thread, so threads finishing early have something to steal
+    const int PARTS_PER_THREAD = 8;
+
+}
+
+
+TaskScheduler::TaskGroup::TaskGroup(TaskScheduler& scheduler)
+    : Scheduler(scheduler)
+{}
+
+void TaskScheduler::TaskGroup::Run(std::function<void()> task) {
+    ++PendingCount;
+    Scheduler.Push(Task{.Func = std::move(task), .Group = this});
+}
+
+void TaskScheduler::TaskGroup::Wait() {
+    while (PendingCount > 0) {
+        if (!Scheduler.TryRunTask()) {
+            std::this_thread::yield();
+        }
+    }
+    std::exception_ptr error;
+    {
+        std::lock_guard lock(ErrorMutex);
+        error = std::exchange(Error, nullptr);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+TaskScheduler::TaskGroup::~TaskGroup() {
+    while (PendingCount > 0) {
+        if (!Scheduler.TryRunTask()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+
+TaskScheduler::TaskScheduler(int threadsCount, bool isPinned)
+    : Queues(std::max(threadsCount, 0) + 1)
+{
+    for (int i = 0; i < threadsCount; ++i) {
+        Threads.emplace_back(&TaskScheduler::WorkerLoop, this, i, isPinned);
+    }
+}
+
+void TaskScheduler::ParallelFor(int count, const std::function<void(int)>& func, int grainSize) {
+    if (count <= 0) {
+        return;
+    }
+    if (grainSize <= 0) {
+        grainSize = std::max(1, count / (PARTS_PER_THREAD * (GetThreadsCount() + 1)));
+    }
+    if (Threads.empty() || count <= grainSize) {
+        for (int i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    TaskGroup group(*this);
+    // upper half is forked, lower one is split further by the same thread
+    std::function<void(int, int)> split = [&](int begin, int end) {
+        while (end - begin > grainSize) {
+            const int middle = begin + (end - begin) / 2;
+            group.Run([&split, middle, end] { split(middle, end); });
+            end = middle;
+        }
+        for (int i = begin; i < end; ++i) {
+            func(i);
+        }
+    };
+    group.Run([&split, count] { split(0, count); });
+    group.Wait();
+}
+
+void TaskScheduler::Push(Task task) {
+    const int queueIdx = (CurrentScheduler == this ? CurrentQueue : Queues.size() - 1);
+    {
+        std::lock_guard lock(Queues[queueIdx].Mutex);
+        Queues[queueIdx].Tasks.push_back(std::move(task));
+    }
+    ++QueuedCount;
+    {
+        // sleeping worker checks QueuedCount under this mutex, so notification isn't lost
+        std::lock_guard lock(SleepMutex);
+    }
+    SleepCv.notify_one();
+}
+
+bool TaskScheduler::TryRunTask() {
+    const int ownQueue = (CurrentScheduler == this ? CurrentQueue : Queues.size() - 1);
+    Task task;
+    bool isFound = false;
+    for (int i = 0; i < Queues.size() && !isFound; ++i) {
+        const int queueIdx = (ownQueue + i) % Queues.size();
+        auto& queue = Queues[queueIdx];
+        std::lock_guard lock(queue.Mutex);
+        if (queue.Tasks.empty()) {
+            continue;
+        }
+        // own tasks are taken from the newest, as their data is hot, stolen ones from the oldest, as they are bigger
+        if (queueIdx == ownQueue) {
+            task = std::move(queue.Tasks.back());
+            queue.Tasks.pop_back();
+        } else {
+            task = std::move(queue.Tasks.front());
+            queue.Tasks.pop_front();
+        }
+        isFound = true;
+    }
+    if (!isFound) {
+        return false;
+    }
+    --QueuedCount;
+
+    try {
+        task.Func();
+    } catch (...) {
+        std::lock_guard lock(task.Group->ErrorMutex);
+        if (!task.Group->Error) {
+            task.Group->Error = std::current_exception();
+        }
+    }
+    --task.Group->PendingCount;
+    return true;
+}
+
+void TaskScheduler::WorkerLoop(int idx, bool isPinned) {
+    CurrentScheduler = this;
+    CurrentQueue = idx;
+#ifdef __linux__
+    if (isPinned) {
+        const int coresCount = std::max(1u, std::thread::hardware_concurrency());
+        cpu_set_t cores;
+        CPU_ZERO(&cores);
+        CPU_SET((idx + 1) % coresCount, &cores);
+        pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores);
+    }
+#endif
+
+    while (true) {
+        if (TryRunTask()) {
+            continue;
+        }
+        std::unique_lock lock(SleepMutex);
+        SleepCv.wait(lock, [this] { return IsStopping || QueuedCount > 0; });
+        if (IsStopping) {
+            return;
+        }
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard lock(SleepMutex);
+        IsStopping = true;
+    }
+    SleepCv.notify_all();
+    for (auto& thread : Threads) {
+        thread.join();
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Work stealing pool of persistent threads, shared by all parallel stages of simulation.
+// Every worker has its own queue, it takes the newest task of its queue and, when queue is empty,
+// steals the oldest task of another queue. Threads outside of pool push tasks to one shared queue.
+// Thread waiting for its tasks runs queued tasks meanwhile, so tasks may fork and wait for nested tasks.
+class TaskScheduler {
+public:
+    // fork-join set of tasks, must outlive its tasks, so destructor waits for them
+    class TaskGroup {
+    public:
+        explicit TaskGroup(TaskScheduler& scheduler);
+
+        void Run(std::function<void()> task);
+        // returns when all tasks of group are finished, first exception thrown by them is rethrown
+        void Wait();
+
+        ~TaskGroup();
+
+    private:
+        friend class TaskScheduler;
+
+        TaskScheduler& Scheduler;
+        std::atomic<int> PendingCount = 0;
+        std::mutex ErrorMutex;
+        std::exception_ptr Error;
+    };
+
+    // threadsCount - workers besides calling thread, with 0 tasks are run by waiting thread,
+    // pinned workers are bound to cores starting from 1, core 0 is left to main thread
+    explicit TaskScheduler(int threadsCount, bool isPinned = false);
+
+    // calls func(i) for every i in [0, count) and returns when all calls are finished, range is split in halves
+    // down to grainSize, so idle workers steal big parts first, 0 - grain is chosen by threads count
+    void ParallelFor(int count, const std::function<void(int)>& func, int grainSize = 0);
+
+    int GetThreadsCount() const { return Threads.size(); }
+
+    ~TaskScheduler();
+
+private:
+    struct Task {
+        std::function<void()> Func;
+        TaskGroup* Group;
+    };
+
+    struct Queue {
+        std::mutex Mutex;
+        std::deque<Task> Tasks;
+    };
+
+    void Push(Task task);
+    // runs one task of own queue or stolen one, false if all queues are empty
+    bool TryRunTask();
+    void WorkerLoop(int idx, bool isPinned);
+
+private:
+    std::deque<Queue> Queues; // per worker, the last one is shared by threads outside of pool
+    std::vector<std::thread> Threads;
+
+    std::atomic<int> QueuedCount = 0;
+    std::mutex SleepMutex;
+    std::condition_variable SleepCv;
+    bool IsStopping = false;
+};
+
+
+#endif // TASK_SCHEDULER_H
@@ -0,0 +1,41 @@
+#include "tick_scheduler.h"
+#include "util.h"
+
+#include <cmath>
+#include <sstream>
+
+
+TickScheduler::TickScheduler(double periodMs)
+    : PeriodMs(periodMs)
+    , LastTickTime(-periodMs)
+    , NextTickTime(0)
+{}
+
+int TickScheduler::PollTick() {
+    double now = Timer.GetElapsedTimeAsPreciseMs();
+    if (now < NextTickTime) {
+        return 0;
+    }
+
+    int periods = std::floor((now - NextTickTime) / PeriodMs) + 1;
+    MissedTicksCount += periods - 1;
+    ++TicksCount;
+
+    LastTickTime = NextTickTime + (periods - 1) * PeriodMs;
+    NextTickTime = LastTickTime + PeriodMs;
+    MaxLatenessMs = std::max(MaxLatenessMs, now - LastTickTime);
+    return periods;
+}
+
+double TickScheduler::GetInterpolationFactor() const {
+    return Clip((Timer.GetElapsedTimeAsPreciseMs() - LastTickTime) / PeriodMs, 0., 1.);
+}
+
+std::string TickScheduler::GetStatistics() const {
+    std::ostringstream out;
+    out << "Missed controller ticks:       " << MissedTicksCount << "/" << TicksCount + MissedTicksCount << " "
+        << AsPercents(TicksCount + MissedTicksCount != 0 ? (double) MissedTicksCount / (TicksCount + MissedTicksCount) : 0)
+        << "\n"
+        << "Max tick lateness:             " << MaxLatenessMs << " ms";
+    return out.str();
+}
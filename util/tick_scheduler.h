@@ -0,0 +1,41 @@
+#ifndef TICK_SCHEDULER_H
+#define TICK_SCHEDULER_H
+
+#include "timer.h"
+
+#include <string>
+
+
+// Runs fixed-rate ticks independently of the caller's loop rate.
+// Ticks which deadline passed while previous tick wasn't finished are skipped and counted as missed.
+class TickScheduler {
+public:
+    TickScheduler(double periodMs);
+
+    // returns number of periods elapsed since previous tick, 0 if next tick isn't due yet
+    int PollTick();
+
+    // position of current moment between previous tick and next one, in [0, 1]
+    double GetInterpolationFactor() const;
+
+    double GetPeriodMs() const { return PeriodMs; }
+    int GetTicksCount() const { return TicksCount; }
+    int GetMissedTicksCount() const { return MissedTicksCount; }
+    double GetMaxLatenessMs() const { return MaxLatenessMs; }
+
+    std::string GetStatistics() const;
+
+private:
+    const double PeriodMs;
+    SimpleTimer Timer;
+
+    double LastTickTime;
+    double NextTickTime;
+
+    int TicksCount = 0;
+    int MissedTicksCount = 0;
+    double MaxLatenessMs = 0;
+};
+
+
+#endif // TICK_SCHEDULER_H
@@ -15,10 +15,21 @@ public:
         LastTime = Clock::now();
     }
 
+    // as if timer was restarted elapsedMs ago
+    inline void Restart(double elapsedMs) {
+        LastTime = Clock::now() - std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::milli>(elapsedMs)
+        );
+    }
+
     inline unsigned int GetElapsedTimeAsMs() const {
         return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - LastTime).count();
     }
 
+    inline double GetElapsedTimeAsPreciseMs() const {
+        return std::chrono::duration<double, std::milli>(Clock::now() - LastTime).count();
+    }
+
 private:
     Clock::time_point LastTime;
 };
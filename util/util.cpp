@@ -1,6 +1,7 @@
 #include "util.h"
 #include "util/points.h"
 
+#include <cfloat>
 #include <chrono>
 #include <ctime>
 #include <iomanip>
@@ -46,7 +47,25 @@ Vector3d CartesianToCylindrical(const Vector3d& p) {
 
 double CalculateAngle(Vector3d p, Vector3d center) {
     p = p - center;
-    return CartesianToCylindrical(p).Y;
+    return std::atan2(p.Y, p.X);
+}
+
+void CalculateAngles(const double* xs, const double* ys, double* angles, size_t count) {
+    // selects and quiet comparisons only, so loop is if-converted and vectorized
+    for (size_t i = 0; i < count; ++i) {
+        const double x = xs[i], y = ys[i];
+        const double absX = std::abs(x), absY = std::abs(y);
+        const bool isSwapped = std::isgreater(absY, absX);
+        const bool isNegativeX = std::isless(x, 0.);
+        // a is in [0, 1], where polynomial of Abramowitz and Stegun 4.4.49 approximates atan
+        const double a = (isSwapped ? absX : absY) / ((isSwapped ? absY : absX) + DBL_MIN);
+        const double s = a * a;
+        const double r = a * (1. + s * (-0.3333314528 + s * (0.1999355085 + s * (-0.1420889944 + s * (0.1065626393
+            + s * (-0.0752896400 + s * (0.0429096138 + s * (-0.0161657367 + s * 0.0028662257))))))));
+        const double firstQuarter = (isSwapped ? M_PI_2 : 0.) + (isSwapped ? -r : r);
+        const double upperHalf = (isNegativeX ? M_PI : 0.) + (isNegativeX ? -firstQuarter : firstQuarter);
+        angles[i] = std::copysign(upperHalf, y);
+    }
 }
 
 bool GetRandomTrue(float probability) {
@@ -141,63 +160,6 @@ bool IsInSegment(double c, double a, double b) {
     return (a <= b && a <= c && c <= b) || (b <= a && b <= c && c <= a);
 }
 
-bool IsInSegment(const std::vector<double>& c, double a, double b) {
-    for (auto i : c) {
-        if (!IsInSegment(i, a ,b)) {
-            return false;
-        }
-    }
-    return true;
-}
-
-bool IsInAnySegment(const std::vector<std::pair<double, double>>& segments, double point) {
-    for (const auto& seg : segments) {
-        if (IsInSegment(point, seg.first, seg.second)) {
-            return true;
-        }
-    }
-    return false;
-}
-
-bool IsInAnySegment(const std::vector<std::pair<double, double>>& segments, const std::vector<double>& points) {
-    for (auto point : points) {
-        if (!IsInAnySegment(segments, point)) {
-            return false;
-        }
-    }
-    return true;
-}
-
-int InWhichSegment(const std::vector<std::pair<double, double>>& segments, double point) {
-    for (int i = 0; i < segments.size(); i++) {
-        if (IsInSegment(point, segments[i].first, segments[i].second)) {
-            return i;
-        }
-    }
-    return -1;
-}
-
-std::vector<std::pair<double, double>> ShiftSegments(
-    const std::vector<std::pair<double, double>>& segments,
-    double shift
-) {
-    std::vector<std::pair<double, double>> res;
-    for (const auto& seg : segments) {
-        res.emplace_back(seg.first + shift, seg.second + shift);
-    }
-    return res;
-}
-
-void ShiftSegmentsInPlace(
-    std::vector<std::pair<double, double>>& segments,
-    double shift
-) {
-    for (auto& seg : segments) {
-        seg.first += shift;
-        seg.second += shift;
-    }
-}
-
 std::string AsPercents(double value) {
     std::ostringstream out;
     out << std::fixed << std::setprecision(2);
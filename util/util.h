@@ -20,6 +20,8 @@ Vector3d CartesianToCylindrical(double x, double y, double z);
 Vector3d CartesianToCylindrical(const Vector3d& p);
 
 double CalculateAngle(Vector3d p, Vector3d center = Vector3d::Zero());
+// atan2 of count points with error below 1e-7, vectorized by compiler
+void CalculateAngles(const double* xs, const double* ys, double* angles, size_t count);
 
 bool GetRandomTrue(float probability);
 double GetRandomDouble(double min, double max);
@@ -39,26 +41,21 @@ std::string CurrentTimeToString();
 std::string MillisecondsToString(double ms);
 
 bool IsInSegment(double c, double a, double b);
-bool IsInSegment(const std::vector<double>& c, double a, double b);
 
-bool IsInAnySegment(const std::vector<std::pair<double, double>>& segments, double point);
-bool IsInAnySegment(const std::vector<std::pair<double, double>>& segments, const std::vector<double>& points);
-
-int InWhichSegment(const std::vector<std::pair<double, double>>& segments, double point);
-
-std::vector<std::pair<double, double>> ShiftSegments(
-    const std::vector<std::pair<double, double>>& segments,
-    double shift
-);
-void ShiftSegmentsInPlace(
-    std::vector<std::pair<double, double>>& segments,
-    double shift
-);
+template<class Container>
+bool IsInSegment(const Container& c, double a, double b) {
+    for (auto i : c) {
+        if (!IsInSegment(i, a ,b)) {
+            return false;
+        }
+    }
+    return true;
+}
 
 std::string AsPercents(double value);
 
-template<class T>
-bool IsInVector(const std::vector<T>& vec, const T& i) {
+template<class Container, class T>
+bool IsInVector(const Container& vec, const T& i) {
     return std::find(vec.begin(), vec.end(), i) != vec.end();
 }
 
@@ -72,8 +69,8 @@ std::string VectorToString(const std::vector<T>& vec, const std::string& sep = "
     return res.str();
 }
 
-template<class T>
-void JoinToVector(std::vector<T>& a, const std::vector<T>& b) {
+template<class ContainerA, class ContainerB>
+void JoinToVector(ContainerA& a, const ContainerB& b) {
     for (auto i : b) {
         a.push_back(i);
     }
@@ -96,10 +93,5 @@ T Clip(T x, T low, T up) {
     return std::max(low, std::min(up, x));
 }
 
-template <class T>
-std::vector<std::pair<double, double>> ShiftedSegmentsFromProto(const T& protoMsg, double shift) {
-    return ShiftSegments(SegmentsFromProto(protoMsg), shift);
-}
-
 
 #endif // UTIL_H